@@ -144,10 +144,19 @@ public:
      */
     CPUModel get_cpu_model(unsigned int cpuid) const;
     /** Gets the current thread's cpu model
+     *
+     * @note Returns the model of the core set with @ref set_thread_cpu, if any
      *
      * @return Current thread's @ref CPUModel
      */
     CPUModel get_cpu_model() const;
+    /** Makes @ref get_cpu_model report the model of a given core on the calling thread
+     *
+     * Lets functions configured from one cluster select the kernels and blocking parameters of the cluster they will run on.
+     *
+     * @param[in] cpuid Id of the core to report the model of, or -1 to report the core the calling thread runs on
+     */
+    static void set_thread_cpu(int cpuid);
     /** Gets the L1 cache size
      *
      * @return the size of the L1 cache
@@ -1618,6 +1618,7 @@ struct FullyConnectedLayerInfo
     bool                retain_internal_weights{ false };           /**<  Retain internal reshaped weights. */
     bool                fp_mixed_precision{ false };                /**<  Use wider accumulators (32 bit instead of 16 for FP16) to improve accuracy. */
     ActivationLayerInfo activation_info{};                          /**<  Fused activation to apply after the matrix multiplication. */
+    DataType            gemv_weights_type{ DataType::UNKNOWN };     /**<  Data type the weights of a single F32 input vector are stored in: F32, F16 or QSYMM8_PER_CHANNEL. UNKNOWN stores them in F32. */
 
     /** Sets the weights trained data layout
      *
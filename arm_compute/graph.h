@@ -25,6 +25,7 @@
 #define ARM_COMPUTE_GRAPH_H
 
 // IR
+#include "arm_compute/graph/ConvolutionMethodTable.h"
 #include "arm_compute/graph/Edge.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphBuilder.h"
@@ -34,6 +35,7 @@
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/INodeVisitor.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/QuantizationTable.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/TensorDescriptor.h"
 #include "arm_compute/graph/TypePrinter.h"
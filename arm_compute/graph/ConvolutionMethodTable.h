@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_CONVOLUTION_METHOD_TABLE_H
+#define ARM_COMPUTE_GRAPH_CONVOLUTION_METHOD_TABLE_H
+
+#include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/graph/Types.h"
+#include "support/Mutex.h"
+
+#include <map>
+#include <string>
+#include <tuple>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Table of the fastest convolution method of each convolution layer configuration
+ *
+ * Methods are recorded per cluster and number of threads, as the fastest method on the big cores is not
+ * necessarily the fastest on the little ones. The table is loaded from and appended to a text file with one
+ * "cluster;num_threads;layer;method" entry per line, so measurements are shared between runs and pipeline stages.
+ * Malformed lines of the file are skipped with a warning.
+ */
+class ConvolutionMethodTable final
+{
+public:
+    /** Gets table instance
+     *
+     * @return Table instance
+     */
+    static ConvolutionMethodTable &get();
+    /** Loads the entries of a file, once per file
+     *
+     * @param[in] filename File to load and to append new entries to. Entries of a missing file are measured and recorded
+     */
+    void load(const std::string &filename);
+    /** Looks up the fastest method of a convolution layer configuration
+     *
+     * @param[in]  layer       Layer configuration, as returned by @ref layer_key
+     * @param[in]  cluster     Cluster the layer runs on
+     * @param[in]  num_threads Number of threads the layer runs with
+     * @param[out] method      Fastest method, if found
+     *
+     * @return True if the configuration is in the table
+     */
+    bool find(const std::string &layer, int cluster, int num_threads, ConvolutionMethod &method);
+    /** Records the fastest method of a convolution layer configuration
+     *
+     * @param[in] layer       Layer configuration, as returned by @ref layer_key
+     * @param[in] cluster     Cluster the layer runs on
+     * @param[in] num_threads Number of threads the layer runs with
+     * @param[in] method      Fastest method
+     */
+    void insert(const std::string &layer, int cluster, int num_threads, ConvolutionMethod method);
+    /** Describes a convolution layer configuration
+     *
+     * @param[in] input     Input tensor info
+     * @param[in] weights   Weights tensor info
+     * @param[in] conv_info Padding and stride information
+     * @param[in] dilation  Dilation, in elements, across x and y
+     * @param[in] fused_act Fused activation information
+     * @param[in] fast_math True if fast math is allowed
+     *
+     * @return Key of the configuration in the table
+     */
+    static std::string layer_key(const ITensorInfo &input, const ITensorInfo &weights, const PadStrideInfo &conv_info, const Size2D &dilation,
+                                 const ActivationLayerInfo &fused_act, bool fast_math);
+
+private:
+    /** Default Constructor */
+    ConvolutionMethodTable();
+
+private:
+    std::map<std::tuple<std::string, int, int>, ConvolutionMethod> _methods;
+    std::string                                                    _filename;
+    arm_compute::Mutex                                             _mtx;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_CONVOLUTION_METHOD_TABLE_H */
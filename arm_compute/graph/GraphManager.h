@@ -88,6 +88,32 @@ public:
     //Ehsan
     void print_times(Graph &graph, int n);
     void reset(Graph &graph);
+    /** Returns a snapshot of the always-on per-task counters of a graph
+     *
+     * @note Safe to call while the graph is being executed from another thread
+     *
+     * @param[in] graph Graph to query
+     *
+     * @return Statistics of every task of the graph, in execution order
+     */
+    std::vector<ExecutionTaskStats> task_stats(const Graph &graph) const;
+    /** Clears the always-on per-task counters of a graph
+     *
+     * @param[in] graph Graph to reset the counters of
+     */
+    void reset_task_stats(Graph &graph);
+    /** Returns the mean time of every layer of a graph
+     *
+     * A layer is the group of tasks closed by an ending task (see the blocking set), so
+     * the last group is the one that would move first when shifting a pipeline cut.
+     * Times come from the per-layer timing when it was enabled, else from the always-on counters.
+     *
+     * @param[in] graph Graph to query
+     * @param[in] n     Number of timed executions
+     *
+     * @return Mean time in seconds of each layer, empty when neither timing source is available
+     */
+    std::vector<double> layer_times(Graph &graph, int n);
 
     void set_input_time(double t){
     	input_time=t;
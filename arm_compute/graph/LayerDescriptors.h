@@ -130,6 +130,28 @@ struct DeconvolutionLayerDescriptor
     PadStrideInfo    info;           /**< Padding and stride information */
     QuantizationInfo out_quant_info; /**< Output quantization information */
 };
+
+/** Descriptor of a layer of a tiled layer chain */
+struct TiledLayerDescriptor
+{
+    /** Constructor
+     *
+     * @param[in] type Type of the layer: ConvolutionLayer, ActivationLayer, NormalizationLayer or PoolingLayer
+     * @param[in] name (Optional) Name of the node the layer comes from
+     */
+    TiledLayerDescriptor(NodeType type, std::string name = "")
+        : type(type), name(std::move(name)), conv_info(), act_info(), norm_info(NormType::CROSS_MAP), pool_info(), epsilon(0.f)
+    {
+    }
+
+    NodeType               type;      /**< Type of the layer */
+    std::string            name;      /**< Name of the node the layer comes from */
+    PadStrideInfo          conv_info; /**< Convolution padding and stride information */
+    ActivationLayerInfo    act_info;  /**< Activation of an activation layer, or activation fused in a convolution */
+    NormalizationLayerInfo norm_info; /**< Normalization layer information */
+    PoolingLayerInfo       pool_info; /**< Pooling layer information */
+    float                  epsilon;   /**< Epsilon of the batch normalization folded into a convolution, if any */
+};
 } // namespace descriptor
 } // namespace graph
 } // namespace arm_compute
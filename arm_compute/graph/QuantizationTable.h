@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_QUANTIZATION_TABLE_H
+#define ARM_COMPUTE_GRAPH_QUANTIZATION_TABLE_H
+
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/graph/Types.h"
+#include "support/Mutex.h"
+
+#include <map>
+#include <string>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class INode;
+
+/** Range of the values of a tensor */
+struct TensorRange
+{
+    float min{ 0.f }; /**< Lowest value seen */
+    float max{ 0.f }; /**< Highest value seen */
+
+    /** Asymmetric 8-bit quantization covering the range, which is widened to include zero
+     *
+     * @return Quantization info of the range
+     */
+    QuantizationInfo quantization_info() const;
+};
+
+/** Table of the ranges of the tensors of the graphs, collected by running them in float
+ *
+ * Tensors are identified by the name of the node producing them, so the float graph the table is
+ * calibrated on and the quantized graph it is applied to only need to be built by the same code.
+ * Every pipeline stage records to and reads from the same table. The table is stored in a text file
+ * with one "tensor;min;max" entry per line.
+ */
+class QuantizationTable final
+{
+public:
+    /** Gets table instance
+     *
+     * @return Table instance
+     */
+    static QuantizationTable &get();
+    /** Loads the entries of a file, once per file
+     *
+     * @param[in] filename File to load
+     *
+     * @return True if the file could be read
+     */
+    bool load(const std::string &filename);
+    /** Writes all the entries of the table to a file
+     *
+     * @param[in] filename File to write, overwritten
+     */
+    void save(const std::string &filename);
+    /** Looks up the range of a tensor
+     *
+     * @param[in]  tensor Tensor, as returned by @ref tensor_key
+     * @param[out] range  Range of the tensor, if found
+     *
+     * @return True if the tensor is in the table
+     */
+    bool find(const std::string &tensor, TensorRange &range);
+    /** Widens the range of a tensor to include the given values
+     *
+     * @param[in] tensor Tensor, as returned by @ref tensor_key
+     * @param[in] range  Range of the values seen
+     */
+    void record(const std::string &tensor, const TensorRange &range);
+    /** Names an output tensor of a node
+     *
+     * @param[in] node Node producing the tensor
+     * @param[in] idx  Output index of the tensor
+     *
+     * @return Key of the tensor in the table, empty if the node is not named
+     */
+    static std::string tensor_key(const INode &node, size_t idx);
+
+private:
+    /** Default Constructor */
+    QuantizationTable();
+
+private:
+    std::map<std::string, TensorRange> _ranges;
+    std::string                        _filename;
+    arm_compute::Mutex                 _mtx;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_QUANTIZATION_TABLE_H */
@@ -116,9 +116,18 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::FusedConvolutionBatchNormalizationLayer:
             os << "FusedConvolutionBatchNormalizationLayer";
             break;
+        case NodeType::FusedConvolutionEltwiseLayer:
+            os << "FusedConvolutionEltwiseLayer";
+            break;
+        case NodeType::FusedConvolutionPoolingLayer:
+            os << "FusedConvolutionPoolingLayer";
+            break;
         case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
             os << "FusedDepthwiseConvolutionBatchNormalizationLayer";
             break;
+        case NodeType::FusedDepthwisePointwiseConvolutionLayer:
+            os << "FusedDepthwisePointwiseConvolutionLayer";
+            break;
         case NodeType::GenerateProposalsLayer:
             os << "GenerateProposalsLayer";
             break;
@@ -182,6 +191,9 @@ inline ::std::ostream &operator<<(::std::ostream &os, const NodeType &node_type)
         case NodeType::StridedSliceLayer:
             os << "StridedSliceLayer";
             break;
+        case NodeType::TiledLayerChain:
+            os << "TiledLayerChain";
+            break;
         case NodeType::UpsampleLayer:
             os << "UpsampleLayer";
             break;
@@ -76,6 +76,14 @@ constexpr EdgeID EmptyEdgeID = std::numeric_limits<EdgeID>::max();
 
 // Forward declarations
 struct TensorDescriptor;
+
+/** Arithmetic precision of the GEMM based layers of an F32 graph */
+enum class PrecisionPolicy
+{
+    F32,  /**< F32 inputs, weights and accumulation */
+    BF16, /**< Inputs and weights converted to BF16, F32 accumulation and output */
+};
+
 /** Graph configuration structure */
 struct GraphConfig
 {
@@ -93,6 +101,23 @@ struct GraphConfig
     int			big_cores{4};
     int			little_cores{2};
     bool		first_big{false};
+    int         kernel_counters{ 0 };                  /**< Sample the always-on per-task counters every N-th execution, 0 disables them */
+    bool        pmu_counters{ false };                 /**< Count CPU hardware events (cycles, instructions, cache and branch misses) per task */
+    bool        tile_layers{ false };                  /**< Run chains of spatially local layers band by band so their intermediates stay in cache */
+    bool        use_conv_method_table{ false };        /**< Pick the fastest method of each convolution for the cluster and number of threads, measured or read from conv_table_file */
+    std::string conv_table_file{ "conv_methods.csv" }; /**< File to load/store the fastest convolution methods from */
+    bool        parallel_branches{ false };            /**< Run independent branches of the graph concurrently, each on a sub-pool of the cores of the stage */
+    std::string co_execute_layers{};                   /**< Comma-separated names of the convolution and fully connected layers whose output channels are split with the other cluster, layers merged into fused nodes are not split */
+    bool        plan_layouts{ false };                 /**< Run the graph in the preferred data layout of its target, permuting only around layers that cannot be converted */
+    bool        static_memory_plan{ false };           /**< Place the transition tensors at fixed offsets of one arena planned once, instead of mapping memory pools every run */
+    bool        calibrate{ false };                    /**< Record the range of every float tensor while running, in the @ref QuantizationTable */
+    std::string quant_table_file{};                    /**< Ranges to quantize the synthetic uint8 graph with, synthetic ranges are used when empty */
+    PrecisionPolicy precision_policy{ PrecisionPolicy::F32 }; /**< Arithmetic of the GEMM based convolutions of F32 graphs */
+    std::string bf16_layers{};                         /**< Comma-separated names of the convolutions the BF16 policy applies to, all of them when empty */
+    bool        report_kernels{ false };               /**< Print the function and assembly kernels chosen for each layer at finalize time */
+    std::string sparse_fc_layers{};                    /**< Comma-separated names of the pruned fully connected layers to run with block-sparse weights */
+    unsigned int sparse_block_height{ 1 };             /**< Outputs per block of the sparse fully connected layers, 1 or 4 */
+    DataType    gemv_weights_type{ DataType::UNKNOWN }; /**< Data type the weights of the batch-1 F32 fully connected layers are stored in, see @ref FullyConnectedLayerInfo::gemv_weights_type */
 };
 
 /**< Device target types */
@@ -163,7 +188,10 @@ enum class NodeType
     FlattenLayer,
     FullyConnectedLayer,
     FusedConvolutionBatchNormalizationLayer,
+    FusedConvolutionEltwiseLayer,
+    FusedConvolutionPoolingLayer,
     FusedDepthwiseConvolutionBatchNormalizationLayer,
+    FusedDepthwisePointwiseConvolutionLayer,
     GenerateProposalsLayer,
     L2NormalizeLayer,
     NormalizationLayer,
@@ -185,6 +213,7 @@ enum class NodeType
     SplitLayer,
     StackLayer,
     StridedSliceLayer,
+    TiledLayerChain,
     UpsampleLayer,
     UnaryEltwiseLayer,
 
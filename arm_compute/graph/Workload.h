@@ -28,10 +28,21 @@
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/IMemoryRegion.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <string>
 #include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif /* defined(__x86_64__) || defined(__i386__) */
 //extern std::map<std::string,double> task_times;
 
 namespace arm_compute
@@ -45,6 +56,165 @@ class Graph;
 
 struct ExecutionTask;
 
+namespace detail
+{
+class BranchExecutor;
+class WorkloadPMU;
+} // namespace detail
+
+/** Reads a free-running timestamp counter without serializing the pipeline
+ *
+ * Uses the virtual counter (cntvct) on Arm and the TSC on x86. Other
+ * architectures fall back to the steady clock in nanoseconds.
+ *
+ * @return Current counter value in ticks
+ */
+inline uint64_t read_timestamp_counter()
+{
+#if defined(__aarch64__)
+    uint64_t value;
+    __asm__ __volatile__("mrs %0, cntvct_el0"
+                         : "=r"(value));
+    return value;
+#elif defined(__arm__)
+    uint32_t low;
+    uint32_t high;
+    __asm__ __volatile__("mrrc p15, 1, %0, %1, c14"
+                         : "=r"(low), "=r"(high));
+    return (static_cast<uint64_t>(high) << 32) | low;
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/** Frequency of the counter returned by @ref read_timestamp_counter
+ *
+ * @note Calibrated once against the steady clock when the architecture does not expose it.
+ *
+ * @return Ticks per second
+ */
+double timestamp_counter_frequency();
+
+/** Rolling per-task counters
+ *
+ * Updated only by the thread executing the task; readers on other threads get a
+ * relaxed (possibly slightly torn across fields) snapshot, which is fine for monitoring.
+ */
+struct ExecutionTaskCounters
+{
+    /** Constructor
+     *
+     * @param[in] sampling_period Sample one out of every @p sampling_period executions
+     */
+    explicit ExecutionTaskCounters(unsigned int sampling_period)
+        : period(sampling_period > 0 ? sampling_period : 1)
+    {
+    }
+    /** Checks whether the next execution should be sampled
+     *
+     * @return True if the execution must be timed
+     */
+    bool sample()
+    {
+        calls.store(calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if(++countdown < period)
+        {
+            return false;
+        }
+        countdown = 0;
+        return true;
+    }
+    /** Accumulates a sampled execution
+     *
+     * @param[in] ticks Elapsed counter ticks
+     */
+    void record(uint64_t ticks);
+    /** Clears all the aggregates */
+    void reset();
+
+    static constexpr double ewma_weight = 0.125; /**< Weight of the newest sample in the moving average */
+
+    const unsigned int    period;                                             /**< Sampling period */
+    unsigned int          countdown{ 0 };                                     /**< Executions since the last sample */
+    std::atomic<uint64_t> calls{ 0 };                                         /**< Total executions */
+    std::atomic<uint64_t> samples{ 0 };                                       /**< Sampled executions */
+    std::atomic<uint64_t> total_ticks{ 0 };                                   /**< Sum of the sampled ticks */
+    std::atomic<uint64_t> min_ticks{ std::numeric_limits<uint64_t>::max() }; /**< Fastest sample */
+    std::atomic<uint64_t> max_ticks{ 0 };                                     /**< Slowest sample */
+    std::atomic<uint64_t> last_ticks{ 0 };                                    /**< Latest sample */
+    std::atomic<double>   ewma_ticks{ 0 };                                    /**< Exponential moving average of the samples */
+};
+
+/** Hardware events counted per task when the PMU profiling is enabled */
+enum class PMUEvent
+{
+    Cycles,       /**< CPU cycles */
+    Instructions, /**< Retired instructions */
+    CacheMisses,  /**< Last level cache misses */
+    BranchMisses, /**< Mispredicted branches */
+};
+
+/** Number of hardware events in @ref PMUEvent */
+constexpr size_t num_pmu_events = 4;
+
+/** Accumulated hardware counters of a task, summed over the stage thread and its worker threads */
+struct ExecutionTaskPMUCounts
+{
+    std::array<uint64_t, num_pmu_events> values{ {} }; /**< Accumulated value of each @ref PMUEvent */
+    uint64_t                             samples{ 0 }; /**< Number of profiled executions */
+
+    /** Accumulated value of an event
+     *
+     * @param[in] event Event to query
+     *
+     * @return Accumulated value
+     */
+    uint64_t operator[](PMUEvent event) const
+    {
+        return values[static_cast<size_t>(event)];
+    }
+    /** Instructions per cycle
+     *
+     * @return IPC, 0 if no cycle was counted
+     */
+    double ipc() const
+    {
+        return (*this)[PMUEvent::Cycles] != 0 ? static_cast<double>((*this)[PMUEvent::Instructions]) / (*this)[PMUEvent::Cycles] : 0.;
+    }
+    /** Cache misses per thousand instructions
+     *
+     * @return Cache MPKI, 0 if no instruction was counted
+     */
+    double cache_mpki() const
+    {
+        return (*this)[PMUEvent::Instructions] != 0 ? 1000. * (*this)[PMUEvent::CacheMisses] / (*this)[PMUEvent::Instructions] : 0.;
+    }
+    /** Branch mispredictions per thousand instructions
+     *
+     * @return Branch MPKI, 0 if no instruction was counted
+     */
+    double branch_mpki() const
+    {
+        return (*this)[PMUEvent::Instructions] != 0 ? 1000. * (*this)[PMUEvent::BranchMisses] / (*this)[PMUEvent::Instructions] : 0.;
+    }
+};
+
+/** Snapshot of the counters of a task, in milliseconds */
+struct ExecutionTaskStats
+{
+    NodeID      id{ EmptyNodeID }; /**< Node bound to the task */
+    std::string name{};            /**< Node name */
+    uint64_t    calls{ 0 };        /**< Total executions */
+    uint64_t    samples{ 0 };      /**< Sampled executions */
+    double      mean{ 0 };         /**< Mean of the sampled executions */
+    double      min{ 0 };          /**< Fastest sampled execution */
+    double      max{ 0 };          /**< Slowest sampled execution */
+    double      last{ 0 };         /**< Latest sampled execution */
+    double      ewma{ 0 };         /**< Moving average of the sampled executions */
+};
+
 //void execute_task(ExecutionTask &task, const std::map<std::string,double>& tt=std::map<std::string, double>());
 void execute_task(ExecutionTask &task);
 double execute_task2(ExecutionTask &task,int nn);
@@ -101,10 +271,19 @@ struct ExecutionTask
 
     double time(int n);
     void reset();
-    double t;
+    double t=0;
     int n=0;
     bool block=0;
     bool ending=0;
+    std::unique_ptr<ExecutionTaskCounters> counters{}; /**< Always-on sampled counters, null when disabled */
+    ExecutionTaskPMUCounts                 pmu_counts{}; /**< Hardware counters, only filled when the PMU profiling is enabled */
+    std::vector<std::string>               kernels{};    /**< Assembly kernels selected when configuring the task, only filled when the kernel report is enabled */
+
+    /** Snapshot of the always-on counters
+     *
+     * @return Counter statistics, all zero when the counters are disabled
+     */
+    ExecutionTaskStats stats() const;
 };
 
 /** Execution workload */
@@ -115,6 +294,9 @@ struct ExecutionWorkload
     std::vector<ExecutionTask> tasks   = {};          /**< Execution workload */
     Graph                     *graph   = { nullptr }; /**< Graph bound to the workload */
     GraphContext              *ctx     = { nullptr }; /**< Graph execution context */
+    std::shared_ptr<detail::WorkloadPMU> pmu = {};    /**< Per-task hardware counters, null when disabled */
+    std::shared_ptr<detail::BranchExecutor> branches = {}; /**< Concurrent executor of independent branches, null when tasks run in sequence */
+    std::shared_ptr<IMemoryRegion> transition_arena = {};  /**< Memory of the transition tensors when statically planned, null otherwise */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_BACKENDS_BANDED_CONVOLUTION_FUNCTION_H
+#define ARM_COMPUTE_GRAPH_BACKENDS_BANDED_CONVOLUTION_FUNCTION_H
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Size in bytes of the convolution output computed by one band
+ *
+ * The band output, the input rows it is computed from and the tensors of the following output stage
+ * stay small enough to be consumed from the L2 cache of either cluster.
+ */
+constexpr size_t banded_convolution_band_size = 64 * 1024;
+
+/** Computes the first row of each band covering @p size rows with bands of @p band_rows rows
+ *
+ * The last band is moved back so that it ends on the last row, overlapping the previous one if needed.
+ *
+ * @param[in] size      Number of rows to cover
+ * @param[in] band_rows Number of rows of each band
+ *
+ * @return The first row of each band
+ */
+inline std::vector<unsigned int> compute_band_starts(unsigned int size, unsigned int band_rows)
+{
+    std::vector<unsigned int> starts;
+    for(unsigned int start = 0; start + band_rows < size; start += band_rows)
+    {
+        starts.push_back(start);
+    }
+    starts.push_back(size - band_rows);
+    return starts;
+}
+
+/** Initializes a tensor as a view on @p size elements of @p parent along dimension @p dim
+ *
+ * The view shares the strides of the parent, its memory is imported with @ref import_slice_view.
+ * Its info is not resizable, so that a kernel can't extend its padding and break the aliasing with the parent.
+ *
+ * @param[out] view   Tensor to initialize
+ * @param[in]  parent Tensor the view looks into
+ * @param[in]  dim    Dimension the view is a slice of
+ * @param[in]  size   Number of elements along @p dim seen through the view
+ */
+template <typename TensorConcreteType>
+void init_slice_view(TensorConcreteType &view, const ITensor &parent, size_t dim, unsigned int size)
+{
+    const ITensorInfo &info = *parent.info();
+
+    TensorShape shape = info.tensor_shape();
+    shape.set(dim, size);
+
+    size_t total_size = info.element_size();
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        total_size += (shape[d] - 1) * info.strides_in_bytes()[d];
+    }
+
+    TensorInfo view_info;
+    view_info.init(shape, 1, info.data_type(), info.strides_in_bytes(), 0, total_size);
+    view_info.set_data_layout(info.data_layout());
+    view_info.set_quantization_info(info.quantization_info());
+    view_info.set_is_resizable(false);
+    view.allocator()->init(view_info);
+}
+
+/** Points a view initialized with @ref init_slice_view to the elements of @p parent starting at @p start along @p dim
+ *
+ * @param[in, out] view   View to update
+ * @param[in]      parent Tensor the view looks into
+ * @param[in]      dim    Dimension the view is a slice of
+ * @param[in]      start  First element along @p dim seen through the view
+ */
+template <typename TensorConcreteType>
+void import_slice_view(TensorConcreteType &view, const ITensor &parent, size_t dim, unsigned int start)
+{
+    Coordinates coords;
+    coords.set(dim, start);
+    const Status status = view.allocator()->import_memory(parent.ptr_to_element(coords));
+    if(!bool(status))
+    {
+        ARM_COMPUTE_ERROR_VAR("Failed to import a slice of a tensor: %s", status.error_description().c_str());
+    }
+}
+
+/** Initializes a tensor as a view on @p rows rows of @p parent
+ *
+ * @param[out] view   Tensor to initialize
+ * @param[in]  parent Tensor the view looks into
+ * @param[in]  rows   Number of rows seen through the view
+ */
+template <typename TensorConcreteType>
+void init_band_view(TensorConcreteType &view, const ITensor &parent, unsigned int rows)
+{
+    init_slice_view(view, parent, get_data_layout_dimension_index(parent.info()->data_layout(), DataLayoutDimension::HEIGHT), rows);
+}
+
+/** Points a view initialized with @ref init_band_view to the rows of @p parent starting at @p row
+ *
+ * @param[in, out] view   View to update
+ * @param[in]      parent Tensor the view looks into
+ * @param[in]      row    First row seen through the view
+ */
+template <typename TensorConcreteType>
+void import_band_view(TensorConcreteType &view, const ITensor &parent, unsigned int row)
+{
+    import_slice_view(view, parent, get_data_layout_dimension_index(parent.info()->data_layout(), DataLayoutDimension::HEIGHT), row);
+}
+
+/** Convolution computed one band of output rows at a time
+ *
+ * A single convolution is configured on a band of the input and writes a band of @p band_rows output rows
+ * to a scratch tensor, so the weights are transformed once however many bands there are.
+ * When the convolution is padded vertically, the rows of each band are first copied with their padding to
+ * an input scratch tensor, otherwise the band convolution reads the input in place.
+ * The input can itself be a band of the layer input, as when the convolution is a layer of a tiled chain.
+ * With @p IsDepthwise, a depthwise convolution with a depth multiplier of 1 is run on the bands instead.
+ *
+ * This is not a function on its own: the fused layers run a band, consume its output while it is
+ * still in cache and move to the next band.
+ */
+template <typename TargetInfo, typename FusedLayerTypes, bool IsDepthwise = false>
+class BandedConvolutionFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+    using ConvolutionLayer   = typename std::conditional<IsDepthwise, typename FusedLayerTypes::DepthwiseConvolutionLayer, typename FusedLayerTypes::GEMMConvolutionLayer>::type;
+
+    BandedConvolutionFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _conv_layer(memory_manager), _fused_batch_norm_layer(), _pad_layers(), _input_views(), _input_view(), _padded_input(), _output(), _fused_bias(), _input(nullptr), _band_output(nullptr), _band_input_rows(),
+          _pad_input(false), _fuse_batch_norm(false), _is_prepared(false)
+    {
+    }
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input         Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                           while every optional dimension from 4 and above represent a batch of inputs.
+     *                           Data types supported: F16/F32.
+     * @param[in]  weights       Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM], or [kernel_x, kernel_y, IFM] when depthwise.
+     *                           Data type supported: Same as @p input.
+     * @param[in]  bias          Biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  mean          Mean values tensor of a batch normalization folded into the weights, nullptr if there is none. Data types supported: Same as @p input
+     * @param[in]  var           Variance values tensor of the folded batch normalization. Data types supported: Same as @p input
+     * @param[in]  beta          Beta values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  gamma         Gamma values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  epsilon       Small value to avoid division with zero in the folded batch normalization.
+     * @param[in]  conv_info     Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  fused_act     Activation layer information in case of a fused activation.
+     * @param[in]  band_starts   First output row of each band
+     * @param[in]  band_rows     Number of output rows computed by each band
+     * @param[out] output        (Optional) Tensor of @p band_rows rows the bands are written to. Defaults to a scratch tensor owned by the function
+     * @param[in]  input_height  (Optional) Height of the layer input when @p input only holds some of its rows. Defaults to the height of @p input
+     * @param[in]  input_offsets (Optional) Row of the layer input held by the first row of @p input for each band. Defaults to 0
+     */
+    void configure(TensorType       *input,
+                   TensorType       *weights,
+                   TensorType       *bias,
+                   const TensorType *mean,
+                   const TensorType *var,
+                   const TensorType *beta,
+                   const TensorType *gamma,
+                   float epsilon, const PadStrideInfo &conv_info, const ActivationLayerInfo &fused_act,
+                   const std::vector<unsigned int> &band_starts, unsigned int band_rows,
+                   TensorType *output = nullptr, unsigned int input_height = 0, const std::vector<unsigned int> &input_offsets = std::vector<unsigned int>())
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        const DataLayout data_layout = input->info()->data_layout();
+        const size_t     idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+        const size_t     idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+        const size_t     idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+        const int input_width   = input->info()->dimension(idx_w);
+        const int layer_height  = input_height != 0 ? input_height : input->info()->dimension(idx_h);
+        const int kernel_width  = weights->info()->dimension(idx_w);
+        const int kernel_height = weights->info()->dimension(idx_h);
+
+        unsigned int output_width  = 0;
+        unsigned int output_height = 0;
+        std::tie(output_width, output_height) = scaled_dimensions(input_width, layer_height, kernel_width, kernel_height, conv_info);
+
+        const int stride_x   = conv_info.stride().first;
+        const int stride_y   = conv_info.stride().second;
+        const int pad_top    = conv_info.pad_top();
+        const int input_rows = (band_rows - 1) * stride_y + kernel_height;
+
+        // The band convolution is not padded vertically and rounds down: the right padding only covers the columns actually read
+        const int           pad_right = std::max(0, static_cast<int>(output_width - 1) * stride_x + kernel_width - input_width - static_cast<int>(conv_info.pad_left()));
+        const PadStrideInfo band_conv_info(stride_x, stride_y, conv_info.pad_left(), pad_right, 0, 0, DimensionRoundingType::FLOOR);
+
+        _input           = input;
+        _pad_input       = pad_top > 0 || static_cast<int>(output_height - 1) * stride_y + kernel_height - pad_top > layer_height;
+        _fuse_batch_norm = mean != nullptr;
+
+        const TensorType *bias_to_use = bias;
+        if(_fuse_batch_norm)
+        {
+            // As in FusedConvolutionBatchNormalizationFunction, the weights are updated in-place and a bias is created if missing
+            const FuseBatchNormalizationType fbn_type = IsDepthwise ? FuseBatchNormalizationType::DEPTHWISECONVOLUTION : FuseBatchNormalizationType::CONVOLUTION;
+            if(bias != nullptr)
+            {
+                _fused_batch_norm_layer.configure(weights, mean, var, nullptr, nullptr, bias, beta, gamma, epsilon, fbn_type);
+            }
+            else
+            {
+                _fused_batch_norm_layer.configure(weights, mean, var, nullptr, &_fused_bias, nullptr, beta, gamma, epsilon, fbn_type);
+                bias_to_use = &_fused_bias;
+            }
+        }
+
+        TensorType *conv_input = nullptr;
+        if(_pad_input)
+        {
+            TensorShape padded_shape = input->info()->tensor_shape();
+            padded_shape.set(idx_h, input_rows);
+            _padded_input.allocator()->init(TensorInfo(padded_shape, 1, input->info()->data_type(), input->info()->quantization_info()).set_data_layout(data_layout));
+
+            for(size_t band = 0; band < band_starts.size(); ++band)
+            {
+                const int first = static_cast<int>(band_starts[band]) * stride_y - pad_top;
+                const int begin = std::max(first, 0);
+                const int end   = std::min(first + input_rows, layer_height);
+
+                PaddingList padding(idx_h + 1, PaddingInfo(0, 0));
+                padding[idx_h] = PaddingInfo(begin - first, first + input_rows - end);
+
+                _input_views.emplace_back(std::make_unique<TensorConcreteType>());
+                init_band_view(*_input_views.back(), *input, end - begin);
+                _pad_layers.emplace_back(std::make_unique<typename FusedLayerTypes::PadLayer>());
+                _pad_layers.back()->configure(_input_views.back().get(), &_padded_input, padding);
+                _band_input_rows.push_back(begin - (input_offsets.empty() ? 0 : input_offsets[band]));
+            }
+            conv_input = &_padded_input;
+        }
+        else
+        {
+            init_band_view(_input_view, *input, input_rows);
+            for(size_t band = 0; band < band_starts.size(); ++band)
+            {
+                _band_input_rows.push_back(band_starts[band] * stride_y - (input_offsets.empty() ? 0 : input_offsets[band]));
+            }
+            conv_input = &_input_view;
+        }
+
+        _band_output = output;
+        if(_band_output == nullptr)
+        {
+            TensorShape output_shape = input->info()->tensor_shape();
+            output_shape.set(idx_w, output_width);
+            output_shape.set(idx_h, band_rows);
+            output_shape.set(idx_c, IsDepthwise ? input->info()->dimension(idx_c) : weights->info()->dimension(3));
+            _output.allocator()->init(TensorInfo(output_shape, 1, input->info()->data_type(), input->info()->quantization_info()).set_data_layout(data_layout));
+            _band_output = &_output;
+        }
+
+        configure_band_layer(_conv_layer, conv_input, weights, bias_to_use, _band_output, band_conv_info, fused_act);
+
+        // The band tensors are small and used back to back, so they are not handed to the memory manager
+        if(_pad_input)
+        {
+            _padded_input.allocator()->allocate();
+        }
+        if(output == nullptr)
+        {
+            _output.allocator()->allocate();
+        }
+        if(_fuse_batch_norm && bias == nullptr)
+        {
+            _fused_bias.allocator()->allocate();
+        }
+    }
+
+    /** Computes a band of output rows into @ref output
+     *
+     * @param[in] band Index of the band in the band starts passed at configuration
+     */
+    void run_band(size_t band)
+    {
+        if(_pad_input)
+        {
+            import_band_view(*_input_views[band], *_input, _band_input_rows[band]);
+            _pad_layers[band]->run();
+        }
+        else
+        {
+            import_band_view(_input_view, *_input, _band_input_rows[band]);
+        }
+        _conv_layer.run();
+    }
+
+    void prepare()
+    {
+        if(!_is_prepared)
+        {
+            // The strides of the input are only final once all the functions have been configured
+            const size_t idx_h = get_data_layout_dimension_index(_input->info()->data_layout(), DataLayoutDimension::HEIGHT);
+            for(auto &view : _input_views)
+            {
+                init_band_view(*view, *_input, view->info()->dimension(idx_h));
+            }
+            if(!_pad_input)
+            {
+                init_band_view(_input_view, *_input, _input_view.info()->dimension(idx_h));
+            }
+
+            if(_fuse_batch_norm)
+            {
+                _fused_batch_norm_layer.run();
+            }
+            _conv_layer.prepare();
+            _is_prepared = true;
+        }
+    }
+
+    /** Output of the last band computed
+     *
+     * @return The band output tensor
+     */
+    TensorType &output()
+    {
+        return *_band_output;
+    }
+
+private:
+    static void configure_band_layer(typename FusedLayerTypes::GEMMConvolutionLayer &layer, TensorType *input, TensorType *weights, const TensorType *bias, TensorType *output,
+                                     const PadStrideInfo &conv_info, const ActivationLayerInfo &fused_act)
+    {
+        layer.configure(input, weights, bias, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act);
+    }
+    static void configure_band_layer(typename FusedLayerTypes::DepthwiseConvolutionLayer &layer, TensorType *input, TensorType *weights, const TensorType *bias, TensorType *output,
+                                     const PadStrideInfo &conv_info, const ActivationLayerInfo &fused_act)
+    {
+        layer.configure(input, weights, bias, output, conv_info, 1U, fused_act);
+    }
+
+    ConvolutionLayer                                                 _conv_layer;
+    typename FusedLayerTypes::FuseBatchNormalization                 _fused_batch_norm_layer;
+    std::vector<std::unique_ptr<typename FusedLayerTypes::PadLayer>> _pad_layers;
+    std::vector<std::unique_ptr<TensorConcreteType>>                 _input_views;
+    TensorConcreteType                                               _input_view;
+    TensorConcreteType                                               _padded_input;
+    TensorConcreteType                                               _output;
+    TensorConcreteType                                               _fused_bias;
+    const TensorType                                                *_input;
+    TensorType                                                      *_band_output;
+    std::vector<unsigned int>                                        _band_input_rows;
+    bool                                                             _pad_input;
+    bool                                                             _fuse_batch_norm;
+    bool                                                             _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_BACKENDS_BANDED_CONVOLUTION_FUNCTION_H */
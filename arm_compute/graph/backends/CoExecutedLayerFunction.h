@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_BACKENDS_CO_EXECUTED_LAYER_FUNCTION_H
+#define ARM_COMPUTE_GRAPH_BACKENDS_CO_EXECUTED_LAYER_FUNCTION_H
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/backends/BandedConvolutionFunction.h"
+#include "arm_compute/graph/detail/ClusterWorker.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <array>
+#include <functional>
+#include <future>
+#include <memory>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Layer whose output channels are split between the cores of the stage and the cores of the other cluster
+ *
+ * The layer is configured twice, on slices of the weights, biases and output: the first part runs on the
+ * calling thread with the scheduler of the stage while the second part runs at the same time on a
+ * @ref detail::ClusterWorker of the other cluster. Both parts read the whole input and write their channels
+ * straight into the layer output, so there is nothing to merge.
+ *
+ * The parts are created without memory manager: their auxiliary memory can't come from the single pool
+ * of the stage as they hold it at the same time.
+ */
+template <typename TargetInfo>
+class CoExecutedLayerFunction final : public IFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+    /** Creates the function computing a part of the layer from views of the weights, biases (nullptr if there are none) and output */
+    using PartFactory = std::function<std::unique_ptr<IFunction>(TensorType *weights, TensorType *biases, TensorType *output)>;
+
+    /** Constructor
+     *
+     * @param[in] partner Worker of the cluster computing the second part of the layer
+     */
+    CoExecutedLayerFunction(detail::ClusterWorker &partner)
+        : _partner(partner), _parts(), _weights(nullptr), _biases(nullptr), _output(nullptr), _weights_dim(0), _output_dim(0), _is_prepared(false)
+    {
+    }
+
+    /** Set the weights, biases and output tensors split between the two parts.
+     *
+     * @param[in]  weights     Weights tensor. Data type supported: All.
+     * @param[in]  biases      Biases tensor of one element per output channel. Can be nullptr.
+     * @param[out] output      Destination tensor. Data type supported: All.
+     * @param[in]  weights_dim Dimension of the output channels in @p weights
+     * @param[in]  output_dim  Dimension of the output channels in @p output
+     * @param[in]  split       Number of output channels computed by the first part, the second part computes the others
+     * @param[in]  create      Creates the function of a part
+     */
+    void configure(TensorType *weights, TensorType *biases, TensorType *output, size_t weights_dim, size_t output_dim, unsigned int split, const PartFactory &create)
+    {
+        const unsigned int num_channels = output->info()->dimension(output_dim);
+        ARM_COMPUTE_ERROR_ON(split == 0 || split >= num_channels);
+        ARM_COMPUTE_ERROR_ON(weights->info()->dimension(weights_dim) != num_channels);
+
+        _weights     = weights;
+        _biases      = biases;
+        _output      = output;
+        _weights_dim = weights_dim;
+        _output_dim  = output_dim;
+
+        _parts[0].start = 0;
+        _parts[1].start = split;
+        for(size_t p = 0; p < _parts.size(); ++p)
+        {
+            Part              &part     = _parts[p];
+            const unsigned int channels = p == 0 ? split : num_channels - split;
+
+            init_slice_view(part.weights, *weights, weights_dim, channels);
+            init_slice_view(part.output, *output, output_dim, channels);
+            if(biases != nullptr)
+            {
+                init_slice_view(part.biases, *biases, 0, channels);
+            }
+            // Functions size their per-thread resources for the scheduler of the thread they are configured on
+            run_on_part_cluster(p, [&]()
+            {
+                part.func = create(&part.weights, biases != nullptr ? &part.biases : nullptr, &part.output);
+            });
+        }
+    }
+
+    // Inherited methods overridden:
+    void prepare() override
+    {
+        if(!_is_prepared)
+        {
+            for(size_t p = 0; p < _parts.size(); ++p)
+            {
+                Part &part = _parts[p];
+                import_slice_view(part.weights, *_weights, _weights_dim, part.start);
+                if(_biases != nullptr)
+                {
+                    import_slice_view(part.biases, *_biases, 0, part.start);
+                }
+                import_slice_view(part.output, *_output, _output_dim, part.start);
+                run_on_part_cluster(p, [&]()
+                {
+                    part.func->prepare();
+                });
+            }
+            // The original weights can be released once both parts run from their own transformed copies
+            if(!_parts[0].weights.is_used() && !_parts[1].weights.is_used())
+            {
+                _weights->mark_as_unused();
+            }
+            _is_prepared = true;
+        }
+    }
+
+    void run() override
+    {
+        prepare();
+
+        // The output memory can change between runs when it is a transition buffer
+        for(Part &part : _parts)
+        {
+            import_slice_view(part.output, *_output, _output_dim, part.start);
+        }
+
+        std::future<void> partner_done = _partner.submit([this]()
+        {
+            _parts[1].func->run();
+        });
+        _parts[0].func->run();
+        partner_done.get();
+    }
+
+private:
+    /** Runs @p work on the cluster of a part and waits for it
+     *
+     * @param[in] part Index of the part
+     * @param[in] work Work to run
+     */
+    void run_on_part_cluster(size_t part, const std::function<void()> &work)
+    {
+        if(part == 0)
+        {
+            work();
+        }
+        else
+        {
+            _partner.submit(work).get();
+        }
+    }
+
+    /** Part of the layer computing a range of output channels */
+    struct Part
+    {
+        TensorConcreteType         weights{};  /**< View on the weights of the channels */
+        TensorConcreteType         biases{};   /**< View on the biases of the channels */
+        TensorConcreteType         output{};   /**< View on the output channels */
+        std::unique_ptr<IFunction> func{};     /**< Function computing the channels */
+        unsigned int               start{ 0 }; /**< First output channel of the part */
+    };
+
+    detail::ClusterWorker &_partner;
+    std::array<Part, 2>    _parts;
+    TensorType            *_weights;
+    TensorType            *_biases;
+    TensorType            *_output;
+    size_t                 _weights_dim;
+    size_t                 _output_dim;
+    bool                   _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_BACKENDS_CO_EXECUTED_LAYER_FUNCTION_H */
@@ -28,21 +28,31 @@
 #ifndef ARM_COMPUTE_GRAPH_BACKENDS_DETAIL_FUNCTION_HELPERS_H
 #define ARM_COMPUTE_GRAPH_BACKENDS_DETAIL_FUNCTION_HELPERS_H
 
+#include "arm_compute/graph/ConvolutionMethodTable.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/backends/CoExecutedLayerFunction.h"
 #include "arm_compute/graph/backends/FusedConvolutionBatchNormalizationFunction.h"
+#include "arm_compute/graph/backends/FusedConvolutionEltwiseFunction.h"
+#include "arm_compute/graph/backends/FusedConvolutionPoolingFunction.h"
 #include "arm_compute/graph/backends/FusedDepthwiseConvolutionBatchNormalizationFunction.h"
+#include "arm_compute/graph/backends/FusedDepthwisePointwiseConvolutionFunction.h"
+#include "arm_compute/graph/backends/TiledLayerChainFunction.h"
 #include "arm_compute/graph/backends/Utils.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/runtime/Scheduler.h"
 #include "support/Cast.h"
 
+#include <chrono>
+#include <cstring>
+
 namespace arm_compute
 {
 namespace graph
@@ -322,6 +332,187 @@ std::unique_ptr<IFunction> create_fused_depthwise_convolution_batch_normalizatio
     return std::move(func);
 }
 
+/** Create a backend fused convolution element-wise layer function
+ *
+ * @tparam FusedLayerTypes Fused layer types
+ * @tparam TargetInfo      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused convolution element-wise layer function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_convolution_eltwise_layer(FusedConvolutionEltwiseNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 8 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *mean    = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *var     = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *beta    = get_backing_tensor<TargetInfo>(node.input(5));
+    typename TargetInfo::TensorType *gamma   = get_backing_tensor<TargetInfo>(node.input(6));
+    typename TargetInfo::TensorType *addend  = get_backing_tensor<TargetInfo>(node.input(7));
+
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const float               epsilon   = node.epsilon();
+    ARM_COMPUTE_ERROR_ON_MSG(node.eltwise_operation() != EltwiseOperation::Add, "Only addition can be fused with a convolution");
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    using FType = FusedConvolutionEltwiseFunction<TargetInfo, FusedLayerTypes>;
+
+    // Create and configure function
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+                                    std::string("FusedConvolutionEltwiseLayer"), mm, input, weights, biases, addend, output, mean, var, beta, gamma, epsilon, conv_info, fused_act);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Operation: " << node.eltwise_operation()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
+                               << std::endl);
+    return std::move(func);
+}
+
+/** Create a backend fused convolution pooling layer function
+ *
+ * @tparam FusedLayerTypes Fused layer types
+ * @tparam TargetInfo      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused convolution pooling layer function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_convolution_pooling_layer(FusedConvolutionPoolingNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 7 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *mean    = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *var     = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *beta    = get_backing_tensor<TargetInfo>(node.input(5));
+    typename TargetInfo::TensorType *gamma   = get_backing_tensor<TargetInfo>(node.input(6));
+
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const PoolingLayerInfo    pool_info = node.pooling_info();
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const float               epsilon   = node.epsilon();
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    using FType = FusedConvolutionPoolingFunction<TargetInfo, FusedLayerTypes>;
+
+    // Create and configure function
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+                                    std::string("FusedConvolutionPoolingLayer"), mm, input, weights, biases, output, mean, var, beta, gamma, epsilon, conv_info, fused_act, pool_info);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Pooling info: " << pool_info.pool_type
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
+                               << std::endl);
+    return std::move(func);
+}
+
+/** Create a backend fused depthwise convolution 1x1 convolution layer function
+ *
+ * @tparam FusedLayerTypes Fused layer types
+ * @tparam TargetInfo      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fused depthwise convolution 1x1 convolution layer function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction> create_fused_depthwise_pointwise_convolution_layer(FusedDepthwisePointwiseConvolutionNode &node, GraphContext &ctx)
+{
+    constexpr size_t pwc_idx = FusedDepthwisePointwiseConvolutionNode::pointwise_weights_idx;
+    validate_node<TargetInfo>(node, pwc_idx + 6 /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input       = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *dwc_weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *dwc_biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *dwc_mean    = get_backing_tensor<TargetInfo>(node.input(3));
+    typename TargetInfo::TensorType *dwc_var     = get_backing_tensor<TargetInfo>(node.input(4));
+    typename TargetInfo::TensorType *dwc_beta    = get_backing_tensor<TargetInfo>(node.input(5));
+    typename TargetInfo::TensorType *dwc_gamma   = get_backing_tensor<TargetInfo>(node.input(6));
+    typename TargetInfo::TensorType *pwc_weights = get_backing_tensor<TargetInfo>(node.input(pwc_idx));
+    typename TargetInfo::TensorType *pwc_biases  = get_backing_tensor<TargetInfo>(node.input(pwc_idx + 1));
+    typename TargetInfo::TensorType *pwc_mean    = get_backing_tensor<TargetInfo>(node.input(pwc_idx + 2));
+    typename TargetInfo::TensorType *pwc_var     = get_backing_tensor<TargetInfo>(node.input(pwc_idx + 3));
+    typename TargetInfo::TensorType *pwc_beta    = get_backing_tensor<TargetInfo>(node.input(pwc_idx + 4));
+    typename TargetInfo::TensorType *pwc_gamma   = get_backing_tensor<TargetInfo>(node.input(pwc_idx + 5));
+
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    const PadStrideInfo       dwc_conv_info = node.depthwise_convolution_info();
+    const ActivationLayerInfo dwc_act       = node.depthwise_fused_activation();
+    const ActivationLayerInfo pwc_act       = node.pointwise_fused_activation();
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    using FType = FusedDepthwisePointwiseConvolutionFunction<TargetInfo, FusedLayerTypes>;
+
+    // Create and configure function
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+                                    std::string("FusedDepthwisePointwiseConvolutionLayer"), mm,
+                                    input, dwc_weights, dwc_biases, dwc_mean, dwc_var, dwc_beta, dwc_gamma, node.depthwise_epsilon(), dwc_conv_info, dwc_act,
+                                    pwc_weights, pwc_biases, pwc_mean, pwc_var, pwc_beta, pwc_gamma, node.pointwise_epsilon(), pwc_act, output);
+
+    // Log info
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Depthwise weights shape: " << dwc_weights->info()->tensor_shape()
+                               << " 1x1 weights shape: " << pwc_weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << (dwc_act.enabled() ? " " + to_string(dwc_act.activation()) : "")
+                               << (pwc_act.enabled() ? " " + to_string(pwc_act.activation()) : "")
+                               << std::endl);
+    return std::move(func);
+}
+
 /** Create a backend bounding box transform layer function
  *
  * @tparam BoundingBoxTransformLayerFunction    Backend bounding box transform function
@@ -451,6 +642,179 @@ std::unique_ptr<arm_compute::IFunction> create_concatenate_layer(ConcatenateLaye
     return std::move(func);
 }
 
+/** Measures the run time of a layer function on scratch tensors shaped as the layer ones
+ *
+ * @tparam TargetInfo Target-specific information
+ *
+ * @param[in] input     Input tensor info of the layer
+ * @param[in] weights   Weights tensor info of the layer
+ * @param[in] biases    Biases tensor info of the layer, nullptr if there are none
+ * @param[in] output    Output tensor info of the layer
+ * @param[in] configure Creates the function on the scratch input, weights, biases and output, nullptr if it does not support them
+ *
+ * @return Best run time out of a few runs, the maximum duration if the function does not support the layer
+ */
+template <typename TargetInfo, typename ConfigureFunction>
+std::chrono::nanoseconds time_layer_function(const ITensorInfo &input, const ITensorInfo &weights, const ITensorInfo *biases, const ITensorInfo &output, ConfigureFunction &&configure)
+{
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+
+    // The scratch tensors don't have the padding the layer tensors might have been extended with
+    const auto init = [](TensorConcreteType & tensor, const ITensorInfo & info)
+    {
+        tensor.allocator()->init(TensorInfo(info.tensor_shape(), 1, info.data_type(), info.quantization_info()).set_data_layout(info.data_layout()));
+    };
+
+    TensorConcreteType src;
+    TensorConcreteType wei;
+    TensorConcreteType bia;
+    TensorConcreteType dst;
+    init(src, input);
+    init(wei, weights);
+    init(dst, output);
+    if(biases != nullptr)
+    {
+        init(bia, *biases);
+    }
+
+    std::unique_ptr<IFunction> func = configure(&src, &wei, biases != nullptr ? &bia : nullptr, &dst);
+    if(func == nullptr)
+    {
+        return std::chrono::nanoseconds::max();
+    }
+
+    for(TensorConcreteType *tensor : { &src, &wei, &bia, &dst })
+    {
+        if(tensor->info()->total_size() != 0)
+        {
+            tensor->allocator()->allocate();
+            std::memset(tensor->buffer(), 0, tensor->info()->total_size());
+        }
+    }
+
+    // Weights are transformed and caches warmed up out of the measured runs
+    constexpr int num_runs = 3;
+    func->prepare();
+    func->run();
+
+    std::chrono::nanoseconds best = std::chrono::nanoseconds::max();
+    for(int i = 0; i < num_runs; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func->run();
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+    }
+    return best;
+}
+
+/** Picks the fastest method of a convolution layer for the cluster and number of threads of the graph
+ *
+ * The method is read from @ref ConvolutionMethodTable, or measured on the layer shapes and recorded in it.
+ *
+ * @tparam ConvolutionLayerFunctions Backend convolution functions
+ * @tparam TargetInfo                Target-specific information
+ *
+ * @param[in] input     Input tensor info
+ * @param[in] weights   Weights tensor info
+ * @param[in] biases    Biases tensor info, nullptr if there are none
+ * @param[in] output    Output tensor info
+ * @param[in] conv_info Padding and stride information
+ * @param[in] dilation  Dilation, in elements, across x and y
+ * @param[in] fused_act Fused activation information
+ * @param[in] fast_math True if fast math is allowed
+ * @param[in] ctx       Graph context
+ *
+ * @return The fastest method, @ref ConvolutionMethod::Default if the target functions can not be timed on the host
+ */
+template <typename ConvolutionLayerFunctions, typename TargetInfo>
+ConvolutionMethod select_convolution_method(const ITensorInfo &input, const ITensorInfo &weights, const ITensorInfo *biases, const ITensorInfo &output,
+                                            const PadStrideInfo &conv_info, const Size2D &dilation, const ActivationLayerInfo &fused_act, bool fast_math, GraphContext &ctx)
+{
+    // Only Neon functions complete when run returns
+    if(TargetInfo::TargetType != Target::NEON)
+    {
+        return ConvolutionMethod::Default;
+    }
+
+    ConvolutionMethodTable &table = ConvolutionMethodTable::get();
+    table.load(ctx.config().conv_table_file);
+
+    const std::string layer       = ConvolutionMethodTable::layer_key(input, weights, conv_info, dilation, fused_act, fast_math);
+    const int         cluster     = ctx.config().cluster;
+    const int         num_threads = Scheduler::get().num_threads();
+
+    ConvolutionMethod method = ConvolutionMethod::Default;
+    if(table.find(layer, cluster, num_threads, method))
+    {
+        return method;
+    }
+
+    using TensorType = typename TargetInfo::TensorType;
+    const std::chrono::nanoseconds gemm_time = time_layer_function<TargetInfo>(input, weights, biases, output,
+                                                                                  [&](TensorType * src, TensorType * wei, TensorType * bia, TensorType * dst) -> std::unique_ptr<IFunction>
+    {
+        using FType = typename ConvolutionLayerFunctions::GEMMConvolutionLayer;
+        if(!bool(FType::validate(src->info(), wei->info(), bia != nullptr ? bia->info() : nullptr, dst->info(), conv_info, WeightsInfo(), dilation, fused_act)))
+        {
+            return nullptr;
+        }
+        auto func = std::make_unique<FType>();
+        func->configure(src, wei, bia, dst, conv_info, WeightsInfo(), dilation, fused_act);
+        return std::move(func);
+    });
+    const std::chrono::nanoseconds direct_time = time_layer_function<TargetInfo>(input, weights, biases, output,
+                                                                                    [&](TensorType * src, TensorType * wei, TensorType * bia, TensorType * dst) -> std::unique_ptr<IFunction>
+    {
+        using FType = typename ConvolutionLayerFunctions::DirectConvolutionLayer;
+        if(dilation != Size2D(1U, 1U) || !bool(FType::validate(src->info(), wei->info(), bia != nullptr ? bia->info() : nullptr, dst->info(), conv_info, fused_act)))
+        {
+            return nullptr;
+        }
+        auto func = std::make_unique<FType>();
+        func->configure(src, wei, bia, dst, conv_info, fused_act);
+        return std::move(func);
+    });
+    const std::chrono::nanoseconds winograd_time = time_layer_function<TargetInfo>(input, weights, biases, output,
+                                                                                      [&](TensorType * src, TensorType * wei, TensorType * bia, TensorType * dst) -> std::unique_ptr<IFunction>
+    {
+        using FType = typename ConvolutionLayerFunctions::WinogradConvolutionLayer;
+        if(dilation != Size2D(1U, 1U) || !bool(FType::validate(src->info(), wei->info(), bia != nullptr ? bia->info() : nullptr, dst->info(), conv_info, fused_act, fast_math)))
+        {
+            return nullptr;
+        }
+        auto func = std::make_unique<FType>();
+        func->configure(src, wei, bia, dst, conv_info, fused_act, fast_math);
+        return std::move(func);
+    });
+
+    // None of the methods supports the layer, leave it to the heuristics
+    if(std::min({ gemm_time, direct_time, winograd_time }) == std::chrono::nanoseconds::max())
+    {
+        return ConvolutionMethod::Default;
+    }
+
+    method = ConvolutionMethod::GEMM;
+    if(direct_time < gemm_time && direct_time <= winograd_time)
+    {
+        method = ConvolutionMethod::Direct;
+    }
+    else if(winograd_time < gemm_time)
+    {
+        method = ConvolutionMethod::Winograd;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Measured convolution methods of " << layer
+                               << " on cluster " << cluster << " with " << num_threads << " threads:"
+                               << " GEMM " << gemm_time.count() << "ns"
+                               << " Direct " << direct_time.count() << "ns"
+                               << " Winograd " << winograd_time.count() << "ns"
+                               << " Picked " << method
+                               << std::endl);
+
+    table.insert(layer, cluster, num_threads, method);
+    return method;
+}
+
 /** Create a backend convolution layer function
  *
  * @tparam ConvolutionLayerFunctions Backend convolution functions
@@ -481,10 +845,17 @@ std::unique_ptr<IFunction> create_convolution_layer(ConvolutionLayerNode &node,
 
     const PadStrideInfo       conv_info      = node.convolution_info();
     const unsigned int        num_groups     = node.num_groups();
-    const ConvolutionMethod   conv_algorithm = node.convolution_method();
+    ConvolutionMethod         conv_algorithm = node.convolution_method();
     const bool                fast_math      = node.fast_math_hint() == FastMathHint::Enabled;
     const ActivationLayerInfo fused_act      = node.fused_activation();
 
+    // Replace the heuristics of the default method by the method measured the fastest for the cluster and number of threads of the graph
+    if(conv_algorithm == ConvolutionMethod::Default && num_groups == 1 && ctx.config().use_conv_method_table)
+    {
+        conv_algorithm = select_convolution_method<ConvolutionLayerFunctions, TargetInfo>(*input->info(), *weights->info(), biases != nullptr ? biases->info() : nullptr, *output->info(),
+                                                                                          conv_info, Size2D(1U, 1U), fused_act, fast_math, ctx);
+    }
+
     // Create and configure function (we assume that functions have been validated before creation)
     std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
     std::unique_ptr<IFunction>      func;
@@ -1043,7 +1414,8 @@ std::unique_ptr<IFunction> create_fully_connected_layer(FullyConnectedLayerNode
     typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
     typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
     typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
-    const FullyConnectedLayerInfo    fc_info = node.info();
+    FullyConnectedLayerInfo          fc_info = node.info();
+    fc_info.gemv_weights_type                = ctx.config().gemv_weights_type;
 
     ARM_COMPUTE_ERROR_ON(input == nullptr);
     ARM_COMPUTE_ERROR_ON(weights == nullptr);
@@ -1079,6 +1451,256 @@ std::unique_ptr<IFunction> create_fully_connected_layer(FullyConnectedLayerNode
     return std::move(func);
 }
 
+/** Checks if a layer name is listed in @ref GraphConfig::co_execute_layers
+ *
+ * @param[in] name Name of the layer
+ * @param[in] ctx  Graph context
+ *
+ * @return True if @p name is one of the comma-separated co-executed layer names
+ */
+inline bool is_listed_co_executed_layer(const std::string &name, const GraphContext &ctx)
+{
+    std::stringstream names(ctx.config().co_execute_layers);
+    for(std::string listed; std::getline(names, listed, ',');)
+    {
+        if(listed == name)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Checks if a layer is one of the layers whose output channels are split with the other cluster
+ *
+ * @param[in] node Node of the layer
+ * @param[in] ctx  Graph context
+ *
+ * @return True if the node is named in @ref GraphConfig::co_execute_layers and runs on Neon
+ */
+inline bool is_co_executed_layer(const INode &node, const GraphContext &ctx)
+{
+    if(node.assigned_target() != Target::NEON || !graph::detail::ClusterWorker::is_supported())
+    {
+        return false;
+    }
+    return is_listed_co_executed_layer(node.name(), ctx);
+}
+
+/** Warns about the layers named in @ref GraphConfig::co_execute_layers that were merged into a fused node
+ *
+ * Fused and tiled nodes are named after the layers they merge, joined by '+', and run on the cores of the stage only.
+ *
+ * @param[in] node Node to check
+ * @param[in] ctx  Graph context
+ */
+inline void warn_fused_co_executed_layers(const INode &node, const GraphContext &ctx)
+{
+    if(ctx.config().co_execute_layers.empty() || node.name().find('+') == std::string::npos)
+    {
+        return;
+    }
+
+    std::stringstream layers(node.name());
+    for(std::string layer; std::getline(layers, layer, '+');)
+    {
+        if(is_listed_co_executed_layer(layer, ctx))
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Layer " << layer << " is fused in " << node.name() << " and is not co-executed with the other cluster" << std::endl);
+        }
+    }
+}
+
+/** Create a function splitting the output channels of a layer between the cores of the stage and the other cluster
+ *
+ * The channels are shared in proportion to the speed of each cluster, measured on a slice of the channels.
+ *
+ * @tparam TargetInfo Target-specific information
+ *
+ * @param[in] node        Node of the layer
+ * @param[in] ctx         Graph context
+ * @param[in] input       Input tensor
+ * @param[in] weights     Weights tensor
+ * @param[in] biases      Biases tensor, nullptr if there are none
+ * @param[in] output      Output tensor
+ * @param[in] weights_dim Dimension of the output channels in @p weights
+ * @param[in] output_dim  Dimension of the output channels in @p output
+ * @param[in] configure   Creates the layer function on the given input, weights, biases and output, nullptr if it does not support them
+ *
+ * @return The co-executed layer function, nullptr if the layer is too narrow to be split or not supported on both clusters
+ */
+template <typename TargetInfo, typename ConfigureFunction>
+std::unique_ptr<IFunction> create_co_executed_layer(INode &node, GraphContext &ctx,
+                                                    typename TargetInfo::TensorType *input,
+                                                    typename TargetInfo::TensorType *weights,
+                                                    typename TargetInfo::TensorType *biases,
+                                                    typename TargetInfo::TensorType *output,
+                                                    size_t weights_dim, size_t output_dim, ConfigureFunction &&configure)
+{
+    // Whole vectors of channels per part
+    constexpr unsigned int channel_step = 4;
+    const unsigned int     num_channels = output->info()->dimension(output_dim);
+    if(num_channels < 2 * channel_step)
+    {
+        return nullptr;
+    }
+
+    const GraphConfig            &config  = ctx.config();
+    graph::detail::ClusterWorker &partner = graph::detail::ClusterWorker::get(config, config.cluster > 0 ? 0 : 1);
+
+    // Time a quarter of the channels on both clusters, the partner one from its own thread, so the
+    // scratch weights of the two measurements stay small next to the ones of the layer
+    const unsigned int timed_channels = std::max(channel_step, (num_channels / 4) / channel_step * channel_step);
+    const auto         slice_info     = [&](const ITensorInfo & info, size_t dim)
+    {
+        TensorInfo slice(info.tensor_shape(), 1, info.data_type(), info.quantization_info());
+        slice.set_data_layout(info.data_layout());
+        slice.set_tensor_shape(TensorShape(info.tensor_shape()).set(dim, timed_channels, false));
+        return slice;
+    };
+    const TensorInfo   weights_slice = slice_info(*weights->info(), weights_dim);
+    const TensorInfo   output_slice  = slice_info(*output->info(), output_dim);
+    const TensorInfo   biases_slice  = biases != nullptr ? slice_info(*biases->info(), 0) : TensorInfo();
+    const ITensorInfo *biases_info   = biases != nullptr ? &biases_slice : nullptr;
+    const auto         local_time    = time_layer_function<TargetInfo>(*input->info(), weights_slice, biases_info, output_slice, configure);
+    auto               partner_time  = std::chrono::nanoseconds::max();
+    partner.submit([&]()
+    {
+        partner_time = time_layer_function<TargetInfo>(*input->info(), weights_slice, biases_info, output_slice, configure);
+    })
+    .get();
+    if(local_time == std::chrono::nanoseconds::max() || partner_time == std::chrono::nanoseconds::max())
+    {
+        return nullptr;
+    }
+
+    // Each cluster gets a share of the channels proportional to its speed
+    const double local_share = static_cast<double>(partner_time.count()) / static_cast<double>(local_time.count() + partner_time.count());
+    unsigned int split       = static_cast<unsigned int>(std::lround(num_channels * local_share / channel_step)) * channel_step;
+    split                    = std::min(std::max(split, channel_step), num_channels - channel_step);
+
+    auto func = std::make_unique<CoExecutedLayerFunction<TargetInfo>>(partner);
+    func->configure(weights, biases, output, weights_dim, output_dim, split,
+                    [&](typename TargetInfo::TensorType * wei, typename TargetInfo::TensorType * bia, typename TargetInfo::TensorType * dst)
+    {
+        return configure(input, wei, bia, dst);
+    });
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: CoExecutedLayer"
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Local channels: " << split
+                               << " Partner channels: " << num_channels - split
+                               << " Local time: " << local_time.count()
+                               << " Partner time: " << partner_time.count()
+                               << std::endl);
+
+    return std::move(func);
+}
+
+/** Create a backend convolution layer function whose output channels are split with the other cluster
+ *
+ * @tparam ConvolutionLayerFunctions Backend convolution functions
+ * @tparam TargetInfo                Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend convolution layer function, running on the stage only if the layer can't be split
+ */
+template <typename ConvolutionLayerFunctions, typename TargetInfo>
+std::unique_ptr<IFunction> create_co_executed_convolution_layer(ConvolutionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
+
+    if(node.num_groups() != 1)
+    {
+        return create_convolution_layer<ConvolutionLayerFunctions, TargetInfo>(node, ctx);
+    }
+    if(is_data_type_quantized_asymmetric(input->info()->data_type()))
+    {
+        biases->info()->set_data_type(DataType::S32);
+    }
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const bool                fast_math = node.fast_math_hint() == FastMathHint::Enabled;
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    const size_t              idx_c     = get_data_layout_dimension_index(output->info()->data_layout(), DataLayoutDimension::CHANNEL);
+
+    using TensorType = typename TargetInfo::TensorType;
+    std::unique_ptr<IFunction> func = create_co_executed_layer<TargetInfo>(node, ctx, input, weights, biases, output, 3 /* OFM */, idx_c,
+                                                                           [&](TensorType * src, TensorType * wei, TensorType * bia, TensorType * dst) -> std::unique_ptr<IFunction>
+    {
+        using FType = typename ConvolutionLayerFunctions::GenericConvolutionLayer;
+        if(!bool(FType::validate(src->info(), wei->info(), bia != nullptr ? bia->info() : nullptr, dst->info(), conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act, fast_math)))
+        {
+            return nullptr;
+        }
+        auto f = std::make_unique<FType>();
+        f->configure(src, wei, bia, dst, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act, fast_math);
+        return std::move(f);
+    });
+    if(func == nullptr)
+    {
+        return create_convolution_layer<ConvolutionLayerFunctions, TargetInfo>(node, ctx);
+    }
+    return func;
+}
+
+/** Create a backend fully connected layer function whose outputs are split with the other cluster
+ *
+ * @tparam FullyConnectedLayerFunction Backend fully-connected function
+ * @tparam TargetInfo                  Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend fully connected layer function, running on the stage only if the layer can't be split
+ */
+template <typename FullyConnectedLayerFunction, typename TargetInfo>
+std::unique_ptr<IFunction> create_co_executed_fully_connected_layer(FullyConnectedLayerNode &node, GraphContext &ctx)
+{
+    validate_node<TargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *weights = get_backing_tensor<TargetInfo>(node.input(1));
+    typename TargetInfo::TensorType *biases  = get_backing_tensor<TargetInfo>(node.input(2));
+    typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
+    const FullyConnectedLayerInfo    fc_info = node.info();
+
+    // Reshaped weights are laid out for the whole layer
+    if(fc_info.are_weights_reshaped)
+    {
+        return create_fully_connected_layer<FullyConnectedLayerFunction, TargetInfo>(node, ctx);
+    }
+
+    using TensorType = typename TargetInfo::TensorType;
+    std::unique_ptr<IFunction> func = create_co_executed_layer<TargetInfo>(node, ctx, input, weights, biases, output, fc_info.transpose_weights ? 1 : 0, 0,
+                                                                           [&](TensorType * src, TensorType * wei, TensorType * bia, TensorType * dst) -> std::unique_ptr<IFunction>
+    {
+        if(!bool(FullyConnectedLayerFunction::validate(src->info(), wei->info(), bia != nullptr ? bia->info() : nullptr, dst->info(), fc_info)))
+        {
+            return nullptr;
+        }
+        auto f = std::make_unique<FullyConnectedLayerFunction>();
+        f->configure(src, wei, bia, dst, fc_info);
+        return std::move(f);
+    });
+    if(func == nullptr)
+    {
+        return create_fully_connected_layer<FullyConnectedLayerFunction, TargetInfo>(node, ctx);
+    }
+    return func;
+}
+
 /** Create a backend generate proposals layer function
  *
  * @tparam GenerateProposalsLayerFunction Backend generate proposals function
@@ -1879,6 +2501,64 @@ std::unique_ptr<IFunction> create_strided_slice_layer(StridedSliceLayerNode &nod
 
     return std::move(func);
 }
+
+/** Create a backend tiled layer chain function
+ *
+ * @tparam FusedLayerTypes Fused layer types
+ * @tparam TargetInfo      Target-specific information
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return Backend tiled layer chain function
+ */
+template <typename FusedLayerTypes, typename TargetInfo>
+std::unique_ptr<IFunction> create_tiled_layer_chain(TiledLayerChainNode &node, GraphContext &ctx)
+{
+    const std::vector<descriptors::TiledLayerDescriptor> &layers = node.layers();
+    validate_node<TargetInfo>(node, 1 + layers.size() * TiledLayerChainNode::num_layer_inputs /* expected inputs */, 1 /* expected outputs */);
+
+    // Extract IO and info
+    typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
+    typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
+
+    std::vector<std::vector<typename TargetInfo::TensorType *>> layer_inputs(layers.size());
+    for(size_t l = 0; l < layers.size(); ++l)
+    {
+        for(size_t i = 0; i < TiledLayerChainNode::num_layer_inputs; ++i)
+        {
+            layer_inputs[l].push_back(get_backing_tensor<TargetInfo>(node.input(TiledLayerChainNode::layer_input_idx(l, i))));
+        }
+    }
+
+    // Create and configure function (we assume that functions have been validated before creation)
+    std::shared_ptr<IMemoryManager> mm = get_memory_manager(ctx, TargetInfo::TargetType);
+    std::unique_ptr<IFunction>      func;
+    std::string                     func_name;
+
+    using FType = TiledLayerChainFunction<TargetInfo, FusedLayerTypes>;
+
+    // Create and configure function
+    std::tie(func, func_name) = create_named_memory_managed_function<FType>(
+                                    std::string("TiledLayerChain"), mm, input, output, layers, layer_inputs);
+
+    // Log info
+    std::ostringstream layers_str;
+    for(const auto &layer : layers)
+    {
+        layers_str << " " << layer.type;
+    }
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: " << node.type()
+                               << " Target: " << TargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << " Layers:" << layers_str.str()
+                               << std::endl);
+    return std::move(func);
+}
 } // namespace detail
 } // namespace backends
 } // namespace graph
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_BACKENDS_FUSED_CONVOLUTION_ELTWISE_FUNCTION_H
+#define ARM_COMPUTE_GRAPH_BACKENDS_FUSED_CONVOLUTION_ELTWISE_FUNCTION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/backends/BandedConvolutionFunction.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Wrapper function to run a convolution, add a second tensor to its output and optionally run an activation, one band of rows at a time
+ *
+ * Each band of the convolution output is added to the matching rows of the addend while it is still in cache,
+ * so the full resolution convolution output is never written to memory.
+ */
+template <typename TargetInfo, typename FusedLayerTypes>
+class FusedConvolutionEltwiseFunction : public IFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+
+    FusedConvolutionEltwiseFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _conv_layer(memory_manager), _add_layer(), _act_layer(), _addend_view(), _output_view(), _addend(nullptr), _output(nullptr), _band_starts(), _run_act(false), _is_prepared(false)
+    {
+    }
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                       while every optional dimension from 4 and above represent a batch of inputs.
+     *                       Data types supported: F16/F32.
+     * @param[in]  weights   Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  bias      Biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  addend    Tensor added to the convolution output. Data type supported: Same as @p input. Shape supported: Same as @p output.
+     * @param[out] output    Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                       Data types supported: Same as @p input.
+     * @param[in]  mean      Mean values tensor of a batch normalization folded into the weights, nullptr if there is none. Data types supported: Same as @p input
+     * @param[in]  var       Variance values tensor of the folded batch normalization. Data types supported: Same as @p input
+     * @param[in]  beta      Beta values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  gamma     Gamma values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  epsilon   Small value to avoid division with zero in the folded batch normalization.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  fused_act Activation layer information applied after the addition.
+     */
+    void configure(TensorType       *input,
+                   TensorType       *weights,
+                   TensorType       *bias,
+                   TensorType       *addend,
+                   TensorType       *output,
+                   const TensorType *mean,
+                   const TensorType *var,
+                   const TensorType *beta,
+                   const TensorType *gamma,
+                   float epsilon, const PadStrideInfo &conv_info, ActivationLayerInfo const &fused_act)
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        const size_t       idx_h     = get_data_layout_dimension_index(output->info()->data_layout(), DataLayoutDimension::HEIGHT);
+        const unsigned int height    = output->info()->dimension(idx_h);
+        const size_t       row_size  = output->info()->tensor_shape().total_size() / height * output->info()->element_size();
+        const unsigned int band_rows = std::max(1U, std::min(height, static_cast<unsigned int>(banded_convolution_band_size / row_size)));
+
+        _addend      = addend;
+        _output      = output;
+        _band_starts = compute_band_starts(height, band_rows);
+        _run_act     = fused_act.enabled();
+
+        _conv_layer.configure(input, weights, bias, mean, var, beta, gamma, epsilon, conv_info, ActivationLayerInfo(), _band_starts, band_rows);
+
+        init_band_view(_addend_view, *addend, band_rows);
+        init_band_view(_output_view, *output, band_rows);
+
+        // The overlapping rows of the last band are computed twice, so the addition must not be done in-place
+        _add_layer.configure(&_conv_layer.output(), &_addend_view, &_output_view, ConvertPolicy::SATURATE);
+        if(_run_act)
+        {
+            _act_layer.configure(&_output_view, nullptr, fused_act);
+        }
+    }
+
+    // Inherited methods overridden:
+    void run()
+    {
+        prepare();
+        for(size_t band = 0; band < _band_starts.size(); ++band)
+        {
+            _conv_layer.run_band(band);
+
+            import_band_view(_addend_view, *_addend, _band_starts[band]);
+            import_band_view(_output_view, *_output, _band_starts[band]);
+            _add_layer.run();
+            if(_run_act)
+            {
+                _act_layer.run();
+            }
+        }
+    }
+
+    void prepare()
+    {
+        if(!_is_prepared)
+        {
+            _conv_layer.prepare();
+
+            // The strides of the addend and the output are only final once all the functions have been configured
+            const size_t idx_h = get_data_layout_dimension_index(_output->info()->data_layout(), DataLayoutDimension::HEIGHT);
+            init_band_view(_addend_view, *_addend, _addend_view.info()->dimension(idx_h));
+            init_band_view(_output_view, *_output, _output_view.info()->dimension(idx_h));
+            _is_prepared = true;
+        }
+    }
+
+private:
+    BandedConvolutionFunction<TargetInfo, FusedLayerTypes> _conv_layer;
+    typename FusedLayerTypes::Addition                     _add_layer;
+    typename FusedLayerTypes::ActivationLayer              _act_layer;
+    TensorConcreteType                                     _addend_view;
+    TensorConcreteType                                     _output_view;
+    const TensorType                                      *_addend;
+    const TensorType                                      *_output;
+    std::vector<unsigned int>                              _band_starts;
+    bool                                                   _run_act;
+    bool                                                   _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_BACKENDS_FUSED_CONVOLUTION_ELTWISE_FUNCTION_H */
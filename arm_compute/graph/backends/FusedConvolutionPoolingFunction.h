@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_BACKENDS_FUSED_CONVOLUTION_POOLING_FUNCTION_H
+#define ARM_COMPUTE_GRAPH_BACKENDS_FUSED_CONVOLUTION_POOLING_FUNCTION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/backends/BandedConvolutionFunction.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Wrapper function to run a convolution followed by a pooling layer, one band of rows at a time
+ *
+ * Each band of pooled rows is computed from the band of convolution rows it covers while they are still in cache,
+ * so the full resolution convolution output is never written to memory.
+ */
+template <typename TargetInfo, typename FusedLayerTypes>
+class FusedConvolutionPoolingFunction : public IFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+
+    FusedConvolutionPoolingFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _conv_layer(memory_manager), _pool_layers(), _pool_input_views(), _pool_output_views(), _output(nullptr), _band_starts(), _is_prepared(false)
+    {
+    }
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                       while every optional dimension from 4 and above represent a batch of inputs.
+     *                       Data types supported: F16/F32.
+     * @param[in]  weights   Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  bias      Biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor of the pooling. Data types supported: Same as @p input.
+     * @param[in]  mean      Mean values tensor of a batch normalization folded into the weights, nullptr if there is none. Data types supported: Same as @p input
+     * @param[in]  var       Variance values tensor of the folded batch normalization. Data types supported: Same as @p input
+     * @param[in]  beta      Beta values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  gamma     Gamma values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  epsilon   Small value to avoid division with zero in the folded batch normalization.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  fused_act Activation layer information in case of a fused activation on the convolution output.
+     * @param[in]  pool_info Contains pooling operation information described in @ref PoolingLayerInfo.
+     */
+    void configure(TensorType       *input,
+                   TensorType       *weights,
+                   TensorType       *bias,
+                   TensorType       *output,
+                   const TensorType *mean,
+                   const TensorType *var,
+                   const TensorType *beta,
+                   const TensorType *gamma,
+                   float epsilon, const PadStrideInfo &conv_info, ActivationLayerInfo const &fused_act, const PoolingLayerInfo &pool_info)
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        const DataLayout data_layout = input->info()->data_layout();
+        const size_t     idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+        const size_t     idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+
+        unsigned int conv_width  = 0;
+        unsigned int conv_height = 0;
+        std::tie(conv_width, conv_height) = scaled_dimensions(input->info()->dimension(idx_w), input->info()->dimension(idx_h),
+                                                              weights->info()->dimension(idx_w), weights->info()->dimension(idx_h), conv_info);
+
+        const unsigned int pool_width     = output->info()->dimension(idx_w);
+        const unsigned int pool_height    = output->info()->dimension(idx_h);
+        const int          pool_size_x    = pool_info.pool_size.width;
+        const int          pool_size_y    = pool_info.pool_size.height;
+        const int          pool_stride_x  = pool_info.pad_stride_info.stride().first;
+        const int          pool_stride_y  = pool_info.pad_stride_info.stride().second;
+        const int          pool_pad_left  = pool_info.pad_stride_info.pad_left();
+        const int          pool_pad_top   = pool_info.pad_stride_info.pad_top();
+        const int          pool_pad_right = std::max(0, static_cast<int>(pool_width - 1) * pool_stride_x + pool_size_x - static_cast<int>(conv_width) - pool_pad_left);
+
+        // Size the bands on the convolution rows they need
+        const size_t       conv_row_size = output->info()->tensor_shape().total_size() / (pool_width * pool_height) * conv_width * output->info()->element_size();
+        const unsigned int max_conv_rows = std::max(static_cast<unsigned int>(pool_size_y), static_cast<unsigned int>(banded_convolution_band_size / conv_row_size));
+        const unsigned int pool_rows     = std::min(pool_height, (max_conv_rows - pool_size_y) / pool_stride_y + 1);
+        const unsigned int conv_rows     = std::min(conv_height, (pool_rows - 1) * pool_stride_y + pool_size_y);
+
+        _output      = output;
+        _band_starts = compute_band_starts(pool_height, pool_rows);
+
+        // Rows of the convolution read by each band of pooled rows, outside of the convolution output they are pooling padding
+        std::vector<unsigned int> conv_starts;
+        std::vector<int>          firsts;
+        std::vector<int>          begins;
+        std::vector<int>          ends;
+        for(unsigned int start : _band_starts)
+        {
+            const int first = static_cast<int>(start) * pool_stride_y - pool_pad_top;
+            const int begin = std::max(first, 0);
+            const int end   = std::min(first + static_cast<int>((pool_rows - 1) * pool_stride_y) + pool_size_y, static_cast<int>(conv_height));
+
+            conv_starts.push_back(std::min(static_cast<unsigned int>(begin), conv_height - conv_rows));
+            firsts.push_back(first);
+            begins.push_back(begin);
+            ends.push_back(end);
+        }
+
+        _conv_layer.configure(input, weights, bias, mean, var, beta, gamma, epsilon, conv_info, fused_act, conv_starts, conv_rows);
+
+        for(size_t band = 0; band < _band_starts.size(); ++band)
+        {
+            const int pad_top    = begins[band] - firsts[band];
+            const int pad_bottom = firsts[band] + static_cast<int>((pool_rows - 1) * pool_stride_y) + pool_size_y - ends[band];
+
+            PoolingLayerInfo band_pool_info = pool_info;
+            band_pool_info.pad_stride_info  = PadStrideInfo(pool_stride_x, pool_stride_y, pool_pad_left, pool_pad_right, pad_top, pad_bottom, DimensionRoundingType::FLOOR);
+
+            _pool_input_views.emplace_back(std::make_unique<TensorConcreteType>());
+            _pool_output_views.emplace_back(std::make_unique<TensorConcreteType>());
+            init_band_view(*_pool_input_views.back(), _conv_layer.output(), ends[band] - begins[band]);
+            init_band_view(*_pool_output_views.back(), *output, pool_rows);
+
+            _pool_layers.emplace_back(std::make_unique<typename FusedLayerTypes::PoolingLayer>());
+            _pool_layers.back()->configure(_pool_input_views.back().get(), _pool_output_views.back().get(), band_pool_info);
+
+            // The band output of the convolution is allocated, so the input views are fixed
+            import_band_view(*_pool_input_views.back(), _conv_layer.output(), begins[band] - conv_starts[band]);
+        }
+    }
+
+    // Inherited methods overridden:
+    void run()
+    {
+        prepare();
+        for(size_t band = 0; band < _band_starts.size(); ++band)
+        {
+            _conv_layer.run_band(band);
+
+            import_band_view(*_pool_output_views[band], *_output, _band_starts[band]);
+            _pool_layers[band]->run();
+        }
+    }
+
+    void prepare()
+    {
+        if(!_is_prepared)
+        {
+            _conv_layer.prepare();
+
+            // The strides of the output are only final once all the functions have been configured
+            const size_t idx_h = get_data_layout_dimension_index(_output->info()->data_layout(), DataLayoutDimension::HEIGHT);
+            for(auto &view : _pool_output_views)
+            {
+                init_band_view(*view, *_output, view->info()->dimension(idx_h));
+            }
+            _is_prepared = true;
+        }
+    }
+
+private:
+    BandedConvolutionFunction<TargetInfo, FusedLayerTypes>               _conv_layer;
+    std::vector<std::unique_ptr<typename FusedLayerTypes::PoolingLayer>> _pool_layers;
+    std::vector<std::unique_ptr<TensorConcreteType>>                     _pool_input_views;
+    std::vector<std::unique_ptr<TensorConcreteType>>                     _pool_output_views;
+    const TensorType                                                    *_output;
+    std::vector<unsigned int>                                            _band_starts;
+    bool                                                                 _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_BACKENDS_FUSED_CONVOLUTION_POOLING_FUNCTION_H */
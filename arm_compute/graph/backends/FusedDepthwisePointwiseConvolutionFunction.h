@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_BACKENDS_FUSED_DEPTHWISE_POINTWISE_CONVOLUTION_FUNCTION_H
+#define ARM_COMPUTE_GRAPH_BACKENDS_FUSED_DEPTHWISE_POINTWISE_CONVOLUTION_FUNCTION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/backends/BandedConvolutionFunction.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Wrapper function to run a depthwise convolution followed by a 1x1 convolution, one band of rows at a time
+ *
+ * Each band of the depthwise output is written to a scratch tensor of about @ref banded_convolution_band_size bytes
+ * and read back by the 1x1 convolution while it is still in cache, the 1x1 convolution writing its band straight
+ * to the output. The full depthwise output is never written to memory.
+ */
+template <typename TargetInfo, typename FusedLayerTypes>
+class FusedDepthwisePointwiseConvolutionFunction : public IFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+
+    FusedDepthwisePointwiseConvolutionFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _depthwise_layer(memory_manager), _pointwise_layer(memory_manager), _output_view(), _output(nullptr), _band_starts(), _is_prepared(false)
+    {
+    }
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input         Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                           while every optional dimension from 4 and above represent a batch of inputs.
+     *                           Data types supported: F16/F32.
+     * @param[in]  dwc_weights   Depthwise weights tensor with dimensions [kernel_x, kernel_y, IFM]. Data type supported: Same as @p input.
+     * @param[in]  dwc_bias      Depthwise biases tensor with dimensions [IFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  dwc_mean      Mean values tensor of a batch normalization folded into the depthwise weights, nullptr if there is none. Data types supported: Same as @p input
+     * @param[in]  dwc_var       Variance values tensor of the folded batch normalization. Data types supported: Same as @p input
+     * @param[in]  dwc_beta      Beta values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  dwc_gamma     Gamma values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  dwc_epsilon   Small value to avoid division with zero in the batch normalization folded into the depthwise weights.
+     * @param[in]  dwc_conv_info Padding and stride information of the depthwise convolution.
+     * @param[in]  dwc_act       Activation layer information in case of an activation fused in the depthwise convolution.
+     * @param[in]  pwc_weights   1x1 convolution weights tensor with dimensions [1, 1, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  pwc_bias      1x1 convolution biases tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in]  pwc_mean      Mean values tensor of a batch normalization folded into the 1x1 weights, nullptr if there is none. Data types supported: Same as @p input
+     * @param[in]  pwc_var       Variance values tensor of the folded batch normalization. Data types supported: Same as @p input
+     * @param[in]  pwc_beta      Beta values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  pwc_gamma     Gamma values tensor of the folded batch normalization. Can be nullptr. Data types supported: Same as @p input
+     * @param[in]  pwc_epsilon   Small value to avoid division with zero in the batch normalization folded into the 1x1 weights.
+     * @param[in]  pwc_act       Activation layer information in case of an activation fused in the 1x1 convolution.
+     * @param[out] output        Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                           Data types supported: Same as @p input.
+     */
+    void configure(TensorType       *input,
+                   TensorType       *dwc_weights,
+                   TensorType       *dwc_bias,
+                   const TensorType *dwc_mean,
+                   const TensorType *dwc_var,
+                   const TensorType *dwc_beta,
+                   const TensorType *dwc_gamma,
+                   float dwc_epsilon, const PadStrideInfo &dwc_conv_info, const ActivationLayerInfo &dwc_act,
+                   TensorType       *pwc_weights,
+                   TensorType       *pwc_bias,
+                   const TensorType *pwc_mean,
+                   const TensorType *pwc_var,
+                   const TensorType *pwc_beta,
+                   const TensorType *pwc_gamma,
+                   float pwc_epsilon, const ActivationLayerInfo &pwc_act,
+                   TensorType *output)
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        const DataLayout data_layout = input->info()->data_layout();
+        const size_t     idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+        const size_t     idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+        const size_t     idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+
+        unsigned int dwc_width  = 0;
+        unsigned int dwc_height = 0;
+        std::tie(dwc_width, dwc_height) = scaled_dimensions(input->info()->dimension(idx_w), input->info()->dimension(idx_h),
+                                                            dwc_weights->info()->dimension(idx_w), dwc_weights->info()->dimension(idx_h), dwc_conv_info);
+
+        // Size the bands on the depthwise rows, which the 1x1 convolution maps one to one to output rows
+        const size_t       dwc_row_size = dwc_width * input->info()->dimension(idx_c) * input->info()->element_size();
+        const unsigned int band_rows    = std::max(1U, std::min(dwc_height, static_cast<unsigned int>(banded_convolution_band_size / dwc_row_size)));
+
+        _output      = output;
+        _band_starts = compute_band_starts(dwc_height, band_rows);
+
+        _depthwise_layer.configure(input, dwc_weights, dwc_bias, dwc_mean, dwc_var, dwc_beta, dwc_gamma, dwc_epsilon, dwc_conv_info, dwc_act, _band_starts, band_rows);
+
+        // The 1x1 convolution reads the whole depthwise band, which holds the rows of the layer starting at the band start
+        init_band_view(_output_view, *output, band_rows);
+        _pointwise_layer.configure(&_depthwise_layer.output(), pwc_weights, pwc_bias, pwc_mean, pwc_var, pwc_beta, pwc_gamma, pwc_epsilon, PadStrideInfo(1, 1, 0, 0), pwc_act,
+                                   _band_starts, band_rows, &_output_view, dwc_height, _band_starts);
+    }
+
+    // Inherited methods overridden:
+    void run()
+    {
+        prepare();
+        for(size_t band = 0; band < _band_starts.size(); ++band)
+        {
+            _depthwise_layer.run_band(band);
+
+            import_band_view(_output_view, *_output, _band_starts[band]);
+            _pointwise_layer.run_band(band);
+        }
+    }
+
+    void prepare()
+    {
+        if(!_is_prepared)
+        {
+            _depthwise_layer.prepare();
+            _pointwise_layer.prepare();
+
+            // The strides of the output are only final once all the functions have been configured
+            const size_t idx_h = get_data_layout_dimension_index(_output->info()->data_layout(), DataLayoutDimension::HEIGHT);
+            init_band_view(_output_view, *_output, _output_view.info()->dimension(idx_h));
+            _is_prepared = true;
+        }
+    }
+
+private:
+    BandedConvolutionFunction<TargetInfo, FusedLayerTypes, true> _depthwise_layer;
+    BandedConvolutionFunction<TargetInfo, FusedLayerTypes>       _pointwise_layer;
+    TensorConcreteType                                           _output_view;
+    const TensorType                                            *_output;
+    std::vector<unsigned int>                                    _band_starts;
+    bool                                                         _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_BACKENDS_FUSED_DEPTHWISE_POINTWISE_CONVOLUTION_FUNCTION_H */
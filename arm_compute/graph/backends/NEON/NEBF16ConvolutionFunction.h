@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_NEBF16CONVOLUTIONFUNCTION_H
+#define ARM_COMPUTE_GRAPH_NEBF16CONVOLUTIONFUNCTION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthConvertLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** F32 convolution computing its GEMM in BF16 with F32 accumulation
+ *
+ * The input is converted to BF16 on every run and the weights once at prepare time,
+ * the biases and the output stay in F32. The configuration interface is the one of
+ * @ref NEConvolutionLayer, so the function can stand in for it in fused layers.
+ */
+class NEBF16ConvolutionFunction : public IFunction
+{
+public:
+    /** Constructor
+     *
+     * @param[in] memory_manager (Optional) Memory manager of the converted input and of the convolution
+     */
+    NEBF16ConvolutionFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBF16ConvolutionFunction(const NEBF16ConvolutionFunction &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBF16ConvolutionFunction &operator=(const NEBF16ConvolutionFunction &) = delete;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input        Source tensor. Data type supported: F32.
+     * @param[in]  weights      Weights tensor. Data type supported: Same as @p input.
+     * @param[in]  biases       Biases tensor, can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output       Destination tensor. Data type supported: Same as @p input.
+     * @param[in]  conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  weights_info Specifies if the weights tensor has been reshaped, only not reshaped weights are supported.
+     * @param[in]  dilation     (Optional) Dilation, in elements, across x and y.
+     * @param[in]  act_info     (Optional) Activation layer information in case of a fused activation.
+     * @param[in]  fast_math    (Optional) Unused, the GEMM is always computed in BF16.
+     * @param[in]  num_groups   (Optional) Number of groups, only 1 is supported.
+     */
+    void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
+                   const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool fast_math = false, unsigned int num_groups = 1);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEBF16ConvolutionFunction
+     *
+     * Fails on CPUs or builds without BF16 support.
+     *
+     * @param[in] input        Source tensor info. Data type supported: F32.
+     * @param[in] weights      Weights tensor info. Data type supported: Same as @p input.
+     * @param[in] biases       Biases tensor info, can be nullptr. Data type supported: Same as @p input.
+     * @param[in] output       Destination tensor info. Data type supported: Same as @p input.
+     * @param[in] conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info Specifies if the weights tensor has been reshaped, only not reshaped weights are supported.
+     * @param[in] dilation     (Optional) Dilation, in elements, across x and y.
+     * @param[in] act_info     (Optional) Activation layer information in case of a fused activation.
+     * @param[in] fast_math    (Optional) Unused, the GEMM is always computed in BF16.
+     * @param[in] num_groups   (Optional) Number of groups, only 1 is supported.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                           const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                           bool fast_math = false, unsigned int num_groups = 1);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup            _memory_group;
+    NEDepthConvertLayer    _input_convert;
+    NEDepthConvertLayer    _weights_convert;
+    NEGEMMConvolutionLayer _conv;
+    Tensor                 _input_bf16;
+    Tensor                 _weights_bf16;
+    const ITensor         *_original_weights;
+    bool                   _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_NEBF16CONVOLUTIONFUNCTION_H */
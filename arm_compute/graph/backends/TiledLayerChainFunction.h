@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_BACKENDS_TILED_LAYER_CHAIN_FUNCTION_H
+#define ARM_COMPUTE_GRAPH_BACKENDS_TILED_LAYER_CHAIN_FUNCTION_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/graph/LayerDescriptors.h"
+#include "arm_compute/graph/backends/BandedConvolutionFunction.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+/** Size in bytes of the intermediate rows of a tiled layer chain computed by one band
+ *
+ * The band outputs of all the layers but the last stay in the L2 cache of the little cores.
+ */
+constexpr size_t tiled_layer_chain_band_size = 256 * 1024;
+
+/** Wrapper function to run a chain of spatially local layers one band of output rows at a time
+ *
+ * For each band of rows of the chain output, every layer computes the rows the next one reads, from the rows
+ * computed by the previous one, into a scratch tensor sized for a band. The intermediate tensors of the chain
+ * are never written to memory in full. Rows in the halo of two bands are computed by both.
+ *
+ * Supported layers are convolutions (with their fused activation and folded batch normalization), activations,
+ * CROSS_MAP normalizations and pooling layers.
+ */
+template <typename TargetInfo, typename FusedLayerTypes>
+class TiledLayerChainFunction : public IFunction
+{
+public:
+    using TensorType         = typename TargetInfo::TensorType;
+    using TensorConcreteType = typename TargetInfo::TensorConcreteType;
+
+    TiledLayerChainFunction(std::shared_ptr<IMemoryManager> memory_manager = nullptr)
+        : _memory_manager(std::move(memory_manager)), _stages(), _scratches(), _output_view(), _output(nullptr), _band_starts(), _is_prepared(false)
+    {
+    }
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input        Source tensor of the first layer. Data types supported: F16/F32.
+     * @param[out] output       Destination tensor of the last layer. Data types supported: Same as @p input.
+     * @param[in]  layers       Layers of the chain, in execution order
+     * @param[in]  layer_inputs Weights, bias, mean, variance, beta and gamma tensors of each layer. Only convolutions have weights, the other tensors can be nullptr
+     */
+    void configure(TensorType *input, TensorType *output, const std::vector<descriptors::TiledLayerDescriptor> &layers, const std::vector<std::vector<TensorType *>> &layer_inputs)
+    {
+        // We don't run any validate, as we assume that the layers have been already validated
+        const DataLayout   data_layout = input->info()->data_layout();
+        const size_t       idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+        const size_t       num_layers  = layers.size();
+        const unsigned int last        = num_layers - 1;
+
+        // Output shape and geometry along the height of each layer, geometry of elementwise layers being a 1x1 kernel
+        std::vector<TensorShape>  shapes;
+        std::vector<unsigned int> kernels(num_layers, 1);
+        std::vector<unsigned int> strides(num_layers, 1);
+        std::vector<int>          pads(num_layers, 0);
+
+        TensorInfo layer_input(input->info()->tensor_shape(), 1, input->info()->data_type());
+        layer_input.set_data_layout(data_layout);
+        for(size_t l = 0; l < num_layers; ++l)
+        {
+            TensorShape shape = layer_input.tensor_shape();
+            if(layers[l].type == NodeType::ConvolutionLayer)
+            {
+                shape      = misc::shape_calculator::compute_deep_convolution_shape(layer_input, *layer_inputs[l][0]->info(), layers[l].conv_info);
+                kernels[l] = layer_inputs[l][0]->info()->dimension(idx_h);
+                strides[l] = layers[l].conv_info.stride().second;
+                pads[l]    = layers[l].conv_info.pad_top();
+            }
+            else if(layers[l].type == NodeType::PoolingLayer)
+            {
+                shape      = misc::shape_calculator::compute_pool_shape(layer_input, layers[l].pool_info);
+                kernels[l] = layers[l].pool_info.pool_size.height;
+                strides[l] = layers[l].pool_info.pad_stride_info.stride().second;
+                pads[l]    = layers[l].pool_info.pad_stride_info.pad_top();
+            }
+            shapes.push_back(shape);
+            layer_input.set_tensor_shape(shape);
+        }
+
+        const auto layer_height = [&](int l)
+        {
+            return static_cast<unsigned int>(l < 0 ? input->info()->dimension(idx_h) : shapes[l][idx_h]);
+        };
+
+        // Rows computed by each layer for a band of rows of the chain output
+        const auto band_rows = [&](unsigned int rows)
+        {
+            std::vector<unsigned int> layer_rows(num_layers);
+            layer_rows[last] = rows;
+            for(unsigned int l = last; l > 0; --l)
+            {
+                layer_rows[l - 1] = std::min(layer_height(l - 1), (layer_rows[l] - 1) * strides[l] + kernels[l]);
+            }
+            return layer_rows;
+        };
+        const auto band_size = [&](const std::vector<unsigned int> &layer_rows)
+        {
+            size_t size = 0;
+            for(unsigned int l = 0; l < last; ++l)
+            {
+                size += shapes[l].total_size() / shapes[l][idx_h] * layer_rows[l] * input->info()->element_size();
+            }
+            return size;
+        };
+
+        unsigned int output_rows = 1;
+        while(output_rows < layer_height(last) && band_size(band_rows(output_rows + 1)) <= tiled_layer_chain_band_size)
+        {
+            ++output_rows;
+        }
+        const std::vector<unsigned int> rows = band_rows(output_rows);
+
+        _output      = output;
+        _band_starts = compute_band_starts(layer_height(last), output_rows);
+
+        // First row computed by each layer for each band, going up the chain from the band of the chain output
+        std::vector<std::vector<unsigned int>> starts(num_layers);
+        starts[last] = _band_starts;
+        for(unsigned int l = last; l > 0; --l)
+        {
+            for(unsigned int start : starts[l])
+            {
+                const int begin = std::max(static_cast<int>(start * strides[l]) - pads[l], 0);
+                starts[l - 1].push_back(std::min(static_cast<unsigned int>(begin), layer_height(l - 1) - rows[l - 1]));
+            }
+        }
+
+        init_band_view(_output_view, *output, output_rows);
+
+        TensorType               *stage_input = input;
+        std::vector<unsigned int> input_offsets(_band_starts.size(), 0);
+        for(size_t l = 0; l < num_layers; ++l)
+        {
+            const descriptors::TiledLayerDescriptor &layer = layers[l];
+
+            // Rows of the last layer go to the chain output, the others to a scratch tensor sized for a band
+            // unless the layer is an activation of a scratch tensor, computed in-place
+            TensorType *stage_output = &_output_view;
+            if(l != last && layer.type == NodeType::ActivationLayer && l != 0)
+            {
+                stage_output = stage_input;
+            }
+            else if(l != last)
+            {
+                TensorShape scratch_shape = shapes[l];
+                scratch_shape.set(idx_h, rows[l]);
+                _scratches.emplace_back(std::make_unique<TensorConcreteType>());
+                _scratches.back()->allocator()->init(TensorInfo(scratch_shape, 1, input->info()->data_type(), input->info()->quantization_info()).set_data_layout(data_layout));
+                stage_output = _scratches.back().get();
+            }
+
+            _stages.emplace_back();
+            Stage &stage = _stages.back();
+            stage.input  = stage_input;
+
+            switch(layer.type)
+            {
+                case NodeType::ConvolutionLayer:
+                {
+                    const std::vector<TensorType *> &params = layer_inputs[l];
+                    stage.conv                              = std::make_unique<BandedConvolutionFunction<TargetInfo, FusedLayerTypes>>(_memory_manager);
+                    stage.conv->configure(stage_input, params[0], params[1], params[2], params[3], params[4], params[5], layer.epsilon, layer.conv_info, layer.act_info,
+                                          starts[l], rows[l], stage_output, layer_height(static_cast<int>(l) - 1), input_offsets);
+                    break;
+                }
+                case NodeType::PoolingLayer:
+                {
+                    const size_t         idx_w          = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+                    const int            input_width    = stage_input->info()->dimension(idx_w);
+                    const int            input_height   = layer_height(static_cast<int>(l) - 1);
+                    const int            input_rows     = (rows[l] - 1) * strides[l] + kernels[l];
+                    const PadStrideInfo &pool_pad_info  = layer.pool_info.pad_stride_info;
+                    const int            pool_stride_x  = pool_pad_info.stride().first;
+                    const int            pool_pad_left  = pool_pad_info.pad_left();
+                    const int            pool_pad_right = std::max(0, static_cast<int>(shapes[l][idx_w] - 1) * pool_stride_x + static_cast<int>(layer.pool_info.pool_size.width) - input_width - pool_pad_left);
+
+                    for(size_t band = 0; band < _band_starts.size(); ++band)
+                    {
+                        const int first = static_cast<int>(starts[l][band] * strides[l]) - pads[l];
+                        const int begin = std::max(first, 0);
+                        const int end   = std::min(first + input_rows, input_height);
+
+                        PoolingLayerInfo band_pool_info = layer.pool_info;
+                        band_pool_info.pad_stride_info  = PadStrideInfo(pool_stride_x, strides[l], pool_pad_left, pool_pad_right, begin - first, first + input_rows - end, DimensionRoundingType::FLOOR);
+
+                        auto pool_layer = std::make_unique<typename FusedLayerTypes::PoolingLayer>();
+                        stage.input_views.emplace_back(std::make_unique<TensorConcreteType>());
+                        init_band_view(*stage.input_views.back(), *stage_input, end - begin);
+                        pool_layer->configure(stage.input_views.back().get(), stage_output, band_pool_info);
+                        stage.funcs.emplace_back(std::move(pool_layer));
+                        stage.input_rows.push_back(begin - input_offsets[band]);
+                    }
+                    break;
+                }
+                case NodeType::ActivationLayer:
+                case NodeType::NormalizationLayer:
+                {
+                    stage.input_views.emplace_back(std::make_unique<TensorConcreteType>());
+                    init_band_view(*stage.input_views.back(), *stage_input, rows[l]);
+                    if(layer.type == NodeType::ActivationLayer)
+                    {
+                        auto act_layer = std::make_unique<typename FusedLayerTypes::ActivationLayer>();
+                        act_layer->configure(stage.input_views.back().get(), stage_output == stage_input ? nullptr : stage_output, layer.act_info);
+                        stage.funcs.emplace_back(std::move(act_layer));
+                    }
+                    else
+                    {
+                        auto norm_layer = std::make_unique<typename FusedLayerTypes::NormalizationLayer>();
+                        norm_layer->configure(stage.input_views.back().get(), stage_output, layer.norm_info);
+                        stage.funcs.emplace_back(std::move(norm_layer));
+                    }
+                    for(size_t band = 0; band < _band_starts.size(); ++band)
+                    {
+                        stage.input_rows.push_back(starts[l][band] - input_offsets[band]);
+                    }
+                    break;
+                }
+                default:
+                    ARM_COMPUTE_ERROR("Layer type not supported in a tiled layer chain");
+            }
+
+            stage_input   = stage_output;
+            input_offsets = starts[l];
+        }
+
+        // The band tensors are small and used back to back, so they are not handed to the memory manager
+        for(auto &scratch : _scratches)
+        {
+            scratch->allocator()->allocate();
+        }
+    }
+
+    // Inherited methods overridden:
+    void run()
+    {
+        prepare();
+        for(size_t band = 0; band < _band_starts.size(); ++band)
+        {
+            import_band_view(_output_view, *_output, _band_starts[band]);
+            for(auto &stage : _stages)
+            {
+                stage.run_band(band);
+            }
+        }
+    }
+
+    void prepare()
+    {
+        if(!_is_prepared)
+        {
+            // The strides of the chain input and output are only final once all the functions have been configured
+            const size_t idx_h = get_data_layout_dimension_index(_output->info()->data_layout(), DataLayoutDimension::HEIGHT);
+            for(auto &stage : _stages)
+            {
+                if(stage.conv != nullptr)
+                {
+                    stage.conv->prepare();
+                }
+                for(auto &view : stage.input_views)
+                {
+                    init_band_view(*view, *stage.input, view->info()->dimension(idx_h));
+                }
+            }
+            init_band_view(_output_view, *_output, _output_view.info()->dimension(idx_h));
+            _is_prepared = true;
+        }
+    }
+
+private:
+    /** Layer of the chain */
+    struct Stage
+    {
+        /** Computes the rows of the layer for a band of the chain output
+         *
+         * @param[in] band Index of the band
+         */
+        void run_band(size_t band)
+        {
+            if(conv != nullptr)
+            {
+                conv->run_band(band);
+                return;
+            }
+            const size_t idx = funcs.size() == 1 ? 0 : band;
+            import_band_view(*input_views[idx], *input, input_rows[band]);
+            funcs[idx]->run();
+        }
+
+        std::unique_ptr<BandedConvolutionFunction<TargetInfo, FusedLayerTypes>> conv{};           /**< Band convolution, for convolution layers */
+        std::vector<std::unique_ptr<IFunction>>                                 funcs{};          /**< One function per band for pooling layers, shared by the bands otherwise */
+        std::vector<std::unique_ptr<TensorConcreteType>>                        input_views{};    /**< Input view of each function */
+        const TensorType                                                       *input{ nullptr }; /**< Output of the previous layer, or the chain input */
+        std::vector<unsigned int>                                               input_rows{};     /**< First row of @ref input seen by each band */
+    };
+
+    std::shared_ptr<IMemoryManager>                  _memory_manager;
+    std::vector<Stage>                               _stages;
+    std::vector<std::unique_ptr<TensorConcreteType>> _scratches;
+    TensorConcreteType                               _output_view;
+    const TensorType                                *_output;
+    std::vector<unsigned int>                        _band_starts;
+    bool                                             _is_prepared;
+};
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
+
+#endif /* ARM_COMPUTE_GRAPH_BACKENDS_TILED_LAYER_CHAIN_FUNCTION_H */
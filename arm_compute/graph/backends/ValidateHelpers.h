@@ -32,6 +32,8 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensorInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
 
 namespace arm_compute
 {
@@ -183,6 +185,91 @@ Status validate_convolution_layer(ConvolutionLayerNode &node)
     return status;
 }
 
+/** Validates a fused Convolution Eltwise layer node
+ *
+ * The bands of the convolution only differ from the whole convolution by their height, so the whole convolution is validated.
+ *
+ * @tparam GEMMConvolutionLayer GEMM Convolution layer function type run on each band
+ * @tparam ArithmeticAddition   Addition function type
+ * @tparam ActivationLayer      Activation layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename GEMMConvolutionLayer, typename ArithmeticAddition, typename ActivationLayer>
+Status validate_fused_convolution_eltwise_layer(FusedConvolutionEltwiseNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedConvolutionEltwiseLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 8);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *addend  = get_backing_tensor_info(node.input(7));
+    arm_compute::ITensorInfo *output  = get_backing_tensor_info(node.output(0));
+
+    const ConvolutionMethod   conv_algorithm = node.convolution_method();
+    const ActivationLayerInfo fused_act      = node.fused_activation();
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.eltwise_operation() != EltwiseOperation::Add, "Only addition can be fused with a convolution");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_algorithm != ConvolutionMethod::Default && conv_algorithm != ConvolutionMethod::GEMM, "The bands of a fused convolution run the GEMM convolution");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.fast_math_hint() == FastMathHint::Enabled, "The bands of a fused convolution run without fast math");
+
+    // Validate function
+    ARM_COMPUTE_RETURN_ON_ERROR(GEMMConvolutionLayer::validate(input, weights, biases, output, node.convolution_info(), WeightsInfo(), Size2D(1, 1), ActivationLayerInfo()));
+    ARM_COMPUTE_RETURN_ON_ERROR(ArithmeticAddition::validate(output, addend, output, ConvertPolicy::SATURATE));
+    if(fused_act.enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(ActivationLayer::validate(output, nullptr, fused_act));
+    }
+
+    return Status{};
+}
+
+/** Validates a fused Convolution Pooling layer node
+ *
+ * The bands of the convolution only differ from the whole convolution by their height, so the whole convolution is validated.
+ *
+ * @tparam GEMMConvolutionLayer GEMM Convolution layer function type run on each band
+ * @tparam PoolingLayer         Pooling layer function type
+ *
+ * @param[in] node Node to validate
+ *
+ * @return Status
+ */
+template <typename GEMMConvolutionLayer, typename PoolingLayer>
+Status validate_fused_convolution_pooling_layer(FusedConvolutionPoolingNode &node)
+{
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Validating FusedConvolutionPoolingLayer node with ID : " << node.id() << " and Name: " << node.name() << std::endl);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_inputs() != 7);
+    ARM_COMPUTE_RETURN_ERROR_ON(node.num_outputs() != 1);
+
+    // Extract IO and info
+    arm_compute::ITensorInfo *input   = get_backing_tensor_info(node.input(0));
+    arm_compute::ITensorInfo *weights = get_backing_tensor_info(node.input(1));
+    arm_compute::ITensorInfo *biases  = get_backing_tensor_info(node.input(2));
+    arm_compute::ITensorInfo *output  = get_backing_tensor_info(node.output(0));
+
+    const PadStrideInfo     conv_info      = node.convolution_info();
+    const PoolingLayerInfo  pool_info      = node.pooling_info();
+    const ConvolutionMethod conv_algorithm = node.convolution_method();
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(pool_info.pool_type != PoolingType::MAX || pool_info.is_global_pooling, "Only max pooling can be fused with a convolution");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_layout() != DataLayout::NHWC, "Only NHWC convolutions can be fused with a pooling layer");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(conv_algorithm != ConvolutionMethod::Default && conv_algorithm != ConvolutionMethod::GEMM, "The bands of a fused convolution run the GEMM convolution");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(node.fast_math_hint() == FastMathHint::Enabled, "The bands of a fused convolution run without fast math");
+
+    // Validate function
+    const TensorInfo conv_output = input->clone()->set_tensor_shape(misc::shape_calculator::compute_deep_convolution_shape(*input, *weights, conv_info)).set_is_resizable(true);
+    ARM_COMPUTE_RETURN_ON_ERROR(GEMMConvolutionLayer::validate(input, weights, biases, &conv_output, conv_info, WeightsInfo(), Size2D(1, 1), node.fused_activation()));
+    ARM_COMPUTE_RETURN_ON_ERROR(PoolingLayer::validate(&conv_output, output, pool_info));
+
+    return Status{};
+}
+
 /** Validates a Depthwise Convolution layer node
  *
  * @tparam DepthwiseConvolutionLayer    Default Depthwise Convolution layer type
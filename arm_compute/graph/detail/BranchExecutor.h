@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_DETAIL_BRANCH_EXECUTOR_H
+#define ARM_COMPUTE_GRAPH_DETAIL_BRANCH_EXECUTOR_H
+
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/Workload.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class IScheduler;
+
+namespace graph
+{
+namespace detail
+{
+/** Executes the tasks of a workload as a DAG so that independent branches run concurrently
+ *
+ * A task is dispatched as soon as the tasks producing its inputs have finished. The cores of the
+ * stage are split in two sub-pools, each with its own scheduler and host thread, so that the branches
+ * of a module (e.g. the towers of an inception block) run side by side before they are concatenated.
+ * A task that is the only one runnable runs on the calling thread with all the cores of the stage.
+ *
+ * @note The tasks of two branches can run at the same time, so the function memory managers
+ *       need one pool per sub-pool and the transition buffers cannot be shared between tensors.
+ */
+class BranchExecutor final
+{
+public:
+    /** Number of sub-pools the cores of the stage are split in */
+    static constexpr size_t num_sub_pools = 2;
+
+    /** Constructor
+     *
+     * Splits the cores used by the scheduler of the calling thread, which must be the one the stage was configured on.
+     *
+     * @param[in] config Configuration of the graph of the stage
+     */
+    explicit BranchExecutor(const GraphConfig &config);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    BranchExecutor(const BranchExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    BranchExecutor &operator=(const BranchExecutor &) = delete;
+    /** Destructor, joins the host threads of the sub-pools */
+    ~BranchExecutor();
+    /** Checks if the cores of a stage can be split in sub-pools
+     *
+     * @return True if the scheduler of the calling thread has at least one thread per sub-pool
+     */
+    static bool is_supported();
+    /** Computes the dependencies between the tasks of a workload
+     *
+     * @param[in] workload Workload whose tasks will be executed, in topological order
+     */
+    void configure(const ExecutionWorkload &workload);
+    /** Executes all the tasks of the workload given to @ref configure
+     *
+     * @param[in, out] workload Workload to execute
+     * @param[in]      nn       Number of the run, forwarded to the timed task execution, 0 to execute untimed
+     */
+    void run(ExecutionWorkload &workload, int nn);
+
+private:
+    /** Thread pool serving one branch at a time */
+    struct SubPool
+    {
+        std::vector<int>            cores{};        /**< Cores of the pool, the first one hosts the branch */
+        std::unique_ptr<IScheduler> scheduler{};    /**< Scheduler the kernels of the branch are dispatched to */
+        std::thread                 thread{};       /**< Host thread executing the tasks of the branch */
+        size_t                      task{ 0 };      /**< Task to execute, valid when busy */
+        bool                        busy{ false };  /**< Whether a task has been handed to the pool */
+        bool                        ready{ false }; /**< Whether the scheduler has been set up */
+    };
+
+    /** Loop of the host thread of a sub-pool
+     *
+     * @param[in, out] pool   Sub-pool served by the thread
+     * @param[in]      config Configuration of the graph of the stage
+     */
+    void worker(SubPool &pool, GraphConfig config);
+    /** Marks a task as executed and queues the consumers it was the last dependency of
+     *
+     * @note Must be called with @ref _mtx locked
+     *
+     * @param[in] task Index of the executed task
+     */
+    void complete(size_t task);
+
+    std::vector<std::vector<size_t>> _consumers; /**< Tasks waiting for each task */
+    std::vector<size_t>              _num_deps;  /**< Number of tasks each task waits for */
+    std::vector<size_t>              _pending;   /**< Number of tasks each task still waits for in the current run */
+    std::deque<size_t>               _runnable;  /**< Tasks whose dependencies have all been executed */
+    size_t                           _executed;  /**< Number of tasks executed in the current run */
+    ExecutionWorkload               *_workload;  /**< Workload being executed */
+    int                              _nn;        /**< Number of the current run */
+    std::vector<SubPool>             _pools;
+    std::mutex                       _mtx;
+    std::condition_variable          _cv;
+    bool                             _stop;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_DETAIL_BRANCH_EXECUTOR_H */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_DETAIL_CALIBRATION_HELPERS_H
+#define ARM_COMPUTE_GRAPH_DETAIL_CALIBRATION_HELPERS_H
+
+#include "arm_compute/graph/QuantizationTable.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+namespace graph
+{
+// Forward declarations
+class Graph;
+class INode;
+class BatchNormalizationLayerNode;
+
+namespace detail
+{
+/** Per-channel scale and shift of a batch normalization folded into the layer before it */
+struct BatchNormalizationFolding
+{
+    std::vector<float> scale{}; /**< Factor of the weights of each output channel: gamma / sqrt(var + epsilon) */
+    std::vector<float> shift{}; /**< Added to the scaled bias of each output channel: beta - mean * scale */
+};
+/** Computes the folding of a batch normalization
+ *
+ * @param[in] mean    Mean of each channel
+ * @param[in] var     Variance of each channel
+ * @param[in] beta    Beta of each channel, empty for zeros
+ * @param[in] gamma   Gamma of each channel, empty for ones
+ * @param[in] epsilon Epsilon of the batch normalization
+ *
+ * @return Scale and shift of each channel
+ */
+BatchNormalizationFolding compute_batch_normalization_folding(const std::vector<float> &mean, const std::vector<float> &var,
+                                                              const std::vector<float> &beta, const std::vector<float> &gamma, float epsilon);
+/** Computes the range of the values of a float tensor
+ *
+ * @param[in] tensor        Tensor of F32 values
+ * @param[in] channel_scale (Optional) Factor each value is scaled by, indexed by its coordinate along @p channel_dim
+ * @param[in] channel_dim   (Optional) Dimension of the channels in @p tensor, when scaling the values
+ *
+ * @return Lowest and highest (scaled) values
+ */
+TensorRange compute_range(const ITensor &tensor, const std::vector<float> *channel_scale = nullptr, size_t channel_dim = 0);
+/** Quantizes float values into a tensor, with its quantization info
+ *
+ * @param[in]  values      Tensor of F32 values, of the same shape as @p tensor
+ * @param[out] tensor      Destination tensor. Data types supported: QASYMM8/S32 (biases, quantized with the scale only)
+ * @param[in]  folding     (Optional) Batch normalization folded into the values
+ * @param[in]  channel_dim (Optional) Dimension of the output channels in @p tensor, when folding a batch normalization
+ * @param[in]  is_bias     (Optional) True if the values are biases, which get shifted on top of being scaled by @p folding
+ */
+void quantize_values(const ITensor &values, ITensor &tensor, const BatchNormalizationFolding *folding = nullptr, size_t channel_dim = 0, bool is_bias = false);
+/** Returns the batch normalization that can be folded into the weights of a convolution when quantizing it
+ *
+ * @param[in] node Convolution or depthwise convolution node
+ *
+ * @return The batch normalization consuming the only output of the node, nullptr if there is none
+ */
+BatchNormalizationLayerNode *foldable_batch_normalization(INode &node);
+/** Dimension of the weights of a convolution holding its output channels
+ *
+ * @param[in] node Convolution or depthwise convolution node
+ *
+ * @return Index of the dimension
+ */
+size_t folded_channel_dimension(const INode &node);
+/** Widens the ranges of the float outputs of a node in the @ref QuantizationTable
+ *
+ * @note Must be called after the node is executed and before its outputs are overwritten
+ *
+ * @param[in] node Node to record the outputs of
+ */
+void record_output_ranges(INode &node);
+/** Records the ranges of the constant tensors of a graph in the @ref QuantizationTable
+ *
+ * The weights of a convolution followed by a foldable batch normalization are recorded with the batch normalization folded,
+ * as they are quantized that way.
+ *
+ * @note Must be called once the accessors of the constant nodes are called
+ *
+ * @param[in] g Graph to record the constant tensors of
+ */
+void record_const_ranges(Graph &g);
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_DETAIL_CALIBRATION_HELPERS_H */
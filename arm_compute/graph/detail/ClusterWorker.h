@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_DETAIL_CLUSTER_WORKER_H
+#define ARM_COMPUTE_GRAPH_DETAIL_CLUSTER_WORKER_H
+
+#include "arm_compute/graph/Types.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class IScheduler;
+
+namespace graph
+{
+namespace detail
+{
+/** Host thread and thread pool running work on all the cores of one cluster on behalf of other threads
+ *
+ * Lets a layer executed by a stage also use the cores of the other cluster: the work submitted runs on
+ * a thread bound to the cluster, whose kernels are dispatched to a scheduler with one thread per core
+ * of the cluster. Work is executed in submission order.
+ */
+class ClusterWorker final
+{
+public:
+    /** Returns the worker of a cluster, started on first use
+     *
+     * @param[in] config  Graph configuration describing the cores of the clusters
+     * @param[in] cluster Cluster to run on, 1 for the big cores and 0 for the little ones
+     *
+     * @return The worker of @p cluster
+     */
+    static ClusterWorker &get(const GraphConfig &config, int cluster);
+    /** Checks if work can be run on another cluster
+     *
+     * @return True if the threads of the C++ scheduler are available
+     */
+    static bool is_supported();
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ClusterWorker(const ClusterWorker &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    ClusterWorker &operator=(const ClusterWorker &) = delete;
+    /** Destructor, joins the host thread */
+    ~ClusterWorker();
+    /** Queues work to run on the cluster
+     *
+     * @param[in] work Work to run, kernels it schedules use the cores of the cluster
+     *
+     * @return Future becoming ready once @p work has run
+     */
+    std::future<void> submit(std::function<void()> work);
+    /** Returns the number of threads work is run with
+     *
+     * @return Number of cores of the cluster
+     */
+    unsigned int num_threads() const;
+
+private:
+    /** Constructor
+     *
+     * @param[in] config  Graph configuration describing the cores of the clusters
+     * @param[in] cluster Cluster to run on
+     */
+    ClusterWorker(const GraphConfig &config, int cluster);
+    /** Loop of the host thread
+     *
+     * @param[in] config Graph configuration describing the cores of the clusters
+     */
+    void worker(GraphConfig config);
+
+    std::vector<int>                       _cores;     /**< Cores of the cluster, the first one hosts the work */
+    std::unique_ptr<IScheduler>            _scheduler; /**< Scheduler the kernels of the work are dispatched to */
+    std::deque<std::packaged_task<void()>> _jobs;      /**< Work waiting to run */
+    std::mutex                             _mtx;
+    std::condition_variable                _cv;
+    bool                                   _stop;
+    std::thread                            _thread;
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_DETAIL_CLUSTER_WORKER_H */
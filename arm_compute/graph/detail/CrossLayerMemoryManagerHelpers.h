@@ -46,6 +46,19 @@ namespace detail
  * @param[in] workload Workload to configure
  */
 void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload &workload);
+/** Places the transition tensors of a workload at fixed offsets of a single arena
+ *
+ * Offsets are planned once over the lifetimes of the tensors in the order of the tasks: largest tensors first,
+ * each at the lowest offset that does not overlap a tensor alive at the same time. The tensors are then bound
+ * to the arena, so no memory is mapped when the workload runs.
+ *
+ * @note Only Neon transition tensors are planned, the other tensors still have to be allocated
+ *
+ * @param[in]      g        Graph to configure
+ * @param[in]      ctx      Graph context
+ * @param[in, out] workload Workload to configure, owns the arena
+ */
+void configure_static_transition_memory(Graph &g, GraphContext &ctx, ExecutionWorkload &workload);
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_DETAIL_WORKLOAD_PMU_H
+#define ARM_COMPUTE_GRAPH_DETAIL_WORKLOAD_PMU_H
+
+#include "arm_compute/graph/Workload.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class PMU;
+
+namespace graph
+{
+namespace detail
+{
+/** Hardware counters attached to the tasks of a workload
+ *
+ * Counts @ref PMUEvent on the thread executing the workload and on the worker threads of
+ * the scheduler it dispatches to, so that multi-threaded layers are fully accounted.
+ * Counters are opened lazily from the executing thread as pipeline stages are finalized
+ * on a different thread from the one running them.
+ */
+class WorkloadPMU final
+{
+public:
+    /** Default constructor */
+    WorkloadPMU();
+    /** Prevent instances of this class from being copied (As this class contains file descriptors) */
+    WorkloadPMU(const WorkloadPMU &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains file descriptors) */
+    WorkloadPMU &operator=(const WorkloadPMU &) = delete;
+    /** Default destructor */
+    ~WorkloadPMU();
+    /** Opens the counters for the calling thread and the current scheduler workers
+     *
+     * @note Does nothing if the counters are already open for the calling thread
+     *
+     * @return True if the counters are available
+     */
+    bool open();
+    /** Snapshots the counters before a task executes */
+    void start();
+    /** Accumulates the events counted since @ref start
+     *
+     * @param[in, out] counts Counters of the executed task
+     */
+    void stop(ExecutionTaskPMUCounts &counts);
+
+private:
+    /** Reads the counters summed over all the profiled threads
+     *
+     * @return Value of each event
+     */
+    std::array<uint64_t, num_pmu_events> read() const;
+
+    std::vector<std::unique_ptr<PMU>>    _counters; /**< One counter per event and per thread */
+    std::array<uint64_t, num_pmu_events> _start;    /**< Snapshot taken by start() */
+    int                                  _tid;      /**< Thread the counters were opened from */
+    bool                                 _available; /**< Whether the kernel granted all the counters */
+};
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_DETAIL_WORKLOAD_PMU_H */
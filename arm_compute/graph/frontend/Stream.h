@@ -68,6 +68,23 @@ public:
 
     void measure(int n);
     void reset();
+    /** Returns a snapshot of the always-on per-task counters
+     *
+     * @note Counters are only collected when @ref GraphConfig::kernel_counters is set at finalization.
+     *       Safe to call while the stream is running on another thread.
+     *
+     * @return Statistics of every task of the stream, in execution order
+     */
+    std::vector<ExecutionTaskStats> task_stats() const;
+    /** Clears the always-on per-task counters */
+    void reset_task_stats();
+    /** Returns the mean time of every layer of the stream
+     *
+     * @param[in] n Number of timed executions
+     *
+     * @return Mean time in seconds of each layer, empty when no timing was collected
+     */
+    std::vector<double> layer_times(int n);
     // Inherited overridden methods
     void add_layer(ILayer &layer) override;
     Graph       &graph() override;
@@ -24,9 +24,11 @@
 #ifndef ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 #define ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 
+#include "arm_compute/graph/mutators/DataLayoutMutator.h"
 #include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
 #include "arm_compute/graph/mutators/GroupedConvolutionMutator.h"
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
+#include "arm_compute/graph/mutators/LayerTilingMutator.h"
 #include "arm_compute/graph/mutators/NodeExecutionMethodMutator.h"
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
 #include "arm_compute/graph/mutators/SplitLayerSubTensorMutator.h"
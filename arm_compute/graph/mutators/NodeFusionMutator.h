@@ -35,10 +35,20 @@ namespace graph
 class NodeFusionMutator final : public IGraphMutator
 {
 public:
+    /** Constructor
+     *
+     * @param[in] use_conv_method_table (Optional) True if the method of the convolutions left to the default one is picked from the
+     *                                  convolution method table. These convolutions are then not fused band by band, as the bands
+     *                                  always run the GEMM convolution. Defaults to false
+     */
+    NodeFusionMutator(bool use_conv_method_table = false);
     // Inherited methods overridden
     virtual void mutate(Graph &g) override;
     MutationType type() const override;
     const char *name() override;
+
+private:
+    bool _use_conv_method_table;
 };
 } // namespace graph
 } // namespace arm_compute
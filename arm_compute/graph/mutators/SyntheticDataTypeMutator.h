@@ -27,6 +27,8 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/IGraphMutator.h"
 
+#include <string>
+
 namespace arm_compute
 {
 namespace graph
@@ -35,10 +37,19 @@ namespace graph
 class SyntheticDataTypeMutator final : public IGraphMutator
 {
 public:
+    /** Constructor
+     *
+     * @param[in] quant_table_file (Optional) File with the ranges of the tensors of the graph, recorded by a calibration run of the float graph.
+     *                             The tensors and weights then get their real quantization instead of a synthetic one. Defaults to empty
+     */
+    SyntheticDataTypeMutator(std::string quant_table_file = "");
     // Inherited methods overridden
     virtual void mutate(Graph &g) override;
     MutationType type() const override;
     const char *name() override;
+
+private:
+    std::string _quant_table_file;
 };
 } // namespace graph
 } // namespace arm_compute
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_FUSED_CONVOLUTION_ELTWISE_NODE_H
+#define ARM_COMPUTE_GRAPH_FUSED_CONVOLUTION_ELTWISE_NODE_H
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Convolution node followed by an element-wise operation with a second tensor
+ *
+ * Inputs are the convolution input, weights and bias, optionally the mean, variance, beta and gamma
+ * of a batch normalization folded into the weights, and last the tensor the convolution output is combined with.
+ */
+class FusedConvolutionEltwiseNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] info             Convolution layer attributes.
+     * @param[in] op               (Optional) Element-wise operation applied on the convolution output
+     * @param[in] epsilon          (Optional) Epsilon parameter of the folded batch normalization, if any
+     * @param[in] method           (Optional) Convolution method to use
+     * @param[in] fast_math_hint   (Optional) Fast math hint
+     * @param[in] fused_activation (Optional) Activation applied after the element-wise operation. Disabled if not specified
+     */
+    FusedConvolutionEltwiseNode(PadStrideInfo info,
+                                EltwiseOperation    op               = EltwiseOperation::Add,
+                                float               epsilon          = 0.001f,
+                                ConvolutionMethod   method           = ConvolutionMethod::Default,
+                                FastMathHint        fast_math_hint   = FastMathHint::Disabled,
+                                ActivationLayerInfo fused_activation = ActivationLayerInfo());
+
+    /** Element-wise operation accessor
+     *
+     * @return Element-wise operation applied on the convolution output
+     */
+    EltwiseOperation eltwise_operation() const;
+
+    /** Epsilon parameter accessor
+     *
+     * @return Epsilon parameter of the folded batch normalization
+     */
+    float epsilon() const;
+
+    /** Returns fused activation
+     *
+     * @return Fused activation
+     */
+    ActivationLayerInfo fused_activation() const;
+
+    /** Sets fused activation
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_fused_activation(ActivationLayerInfo fused_activation);
+
+    /** Sets the convolution layer method to use
+     *
+     * @param[in] method Method to use for convolution
+     */
+    void set_convolution_method(ConvolutionMethod method);
+
+    /** Convolution layer method accessor
+     *
+     * @return Convolution layer method to be used by the node
+     */
+    ConvolutionMethod convolution_method() const;
+
+    /** Sets the fast math fast hint
+     *
+     * @param[in] hint Hint to use for convolution
+     */
+    void set_fast_math_hint(FastMathHint hint);
+
+    /** Fast math hint accessor
+     *
+     * @return Fast math hint to be used by the node
+     */
+    FastMathHint fast_math_hint() const;
+
+    /** Convolution metadata accessor
+     *
+     * @return Convolution information
+     */
+    PadStrideInfo convolution_info() const;
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::FusedConvolutionEltwiseLayer;
+
+private:
+    PadStrideInfo       _info;
+    EltwiseOperation    _op;
+    float               _epsilon;
+    ConvolutionMethod   _method;
+    FastMathHint        _fast_math_hint;
+    ActivationLayerInfo _fused_activation;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_FUSED_CONVOLUTION_ELTWISE_NODE_H */
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_FUSED_DEPTHWISE_POINTWISE_CONVOLUTION_NODE_H
+#define ARM_COMPUTE_GRAPH_FUSED_DEPTHWISE_POINTWISE_CONVOLUTION_NODE_H
+
+#include "arm_compute/graph/INode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Depthwise convolution node followed by a 1x1 convolution
+ *
+ * Inputs are the depthwise convolution input, weights, bias, mean, variance, beta and gamma, followed by the
+ * 1x1 convolution weights, bias, mean, variance, beta and gamma. The mean and variance of a convolution are
+ * only connected when a batch normalization was folded into its weights.
+ */
+class FusedDepthwisePointwiseConvolutionNode final : public INode
+{
+public:
+    /** Constructor
+     *
+     * @param[in] dwc_info             Depthwise convolution layer attributes.
+     * @param[in] dwc_epsilon          (Optional) Epsilon parameter of the batch normalization folded into the depthwise convolution, if any
+     * @param[in] dwc_fused_activation (Optional) Activation fused in the depthwise convolution. Disabled if not specified
+     * @param[in] pwc_epsilon          (Optional) Epsilon parameter of the batch normalization folded into the 1x1 convolution, if any
+     * @param[in] pwc_fused_activation (Optional) Activation fused in the 1x1 convolution. Disabled if not specified
+     */
+    FusedDepthwisePointwiseConvolutionNode(PadStrideInfo       dwc_info,
+                                           float               dwc_epsilon          = 0.001f,
+                                           ActivationLayerInfo dwc_fused_activation = ActivationLayerInfo(),
+                                           float               pwc_epsilon          = 0.001f,
+                                           ActivationLayerInfo pwc_fused_activation = ActivationLayerInfo());
+
+    /** Depthwise convolution metadata accessor
+     *
+     * @return Depthwise convolution information
+     */
+    PadStrideInfo depthwise_convolution_info() const;
+
+    /** Epsilon parameter accessor of the depthwise convolution
+     *
+     * @return Epsilon parameter of the batch normalization folded into the depthwise convolution
+     */
+    float depthwise_epsilon() const;
+
+    /** Returns the activation fused in the depthwise convolution
+     *
+     * @return Fused activation of the depthwise convolution
+     */
+    ActivationLayerInfo depthwise_fused_activation() const;
+
+    /** Epsilon parameter accessor of the 1x1 convolution
+     *
+     * @return Epsilon parameter of the batch normalization folded into the 1x1 convolution
+     */
+    float pointwise_epsilon() const;
+
+    /** Returns the activation fused in the 1x1 convolution
+     *
+     * @return Fused activation of the 1x1 convolution
+     */
+    ActivationLayerInfo pointwise_fused_activation() const;
+
+    /** Sets the activation fused in the 1x1 convolution
+     *
+     * @param[in] fused_activation Fused activation to set
+     */
+    void set_pointwise_fused_activation(ActivationLayerInfo fused_activation);
+
+    /** Computes the output descriptor of the depthwise convolution followed by the 1x1 convolution
+     *
+     * @param[in] input_descriptor       Input descriptor
+     * @param[in] dwc_weights_descriptor Depthwise weights descriptor
+     * @param[in] pwc_weights_descriptor 1x1 weights descriptor
+     * @param[in] dwc_info               Depthwise convolution operation attributes
+     *
+     * @return Output descriptor
+     */
+    static TensorDescriptor compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                      const TensorDescriptor &dwc_weights_descriptor,
+                                                      const TensorDescriptor &pwc_weights_descriptor,
+                                                      const PadStrideInfo    &dwc_info);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::FusedDepthwisePointwiseConvolutionLayer;
+    /** Number of inputs of the depthwise convolution: input, weights, bias, mean, variance, beta and gamma */
+    static constexpr size_t depthwise_num_inputs = 7;
+    /** Index of the 1x1 convolution weights, followed by its bias, mean, variance, beta and gamma. The 1x1 convolution input is the depthwise output, so it has no slot */
+    static constexpr size_t pointwise_weights_idx = depthwise_num_inputs;
+
+private:
+    PadStrideInfo       _dwc_info;
+    float               _dwc_epsilon;
+    ActivationLayerInfo _dwc_fused_activation;
+    float               _pwc_epsilon;
+    ActivationLayerInfo _pwc_fused_activation;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_FUSED_DEPTHWISE_POINTWISE_CONVOLUTION_NODE_H */
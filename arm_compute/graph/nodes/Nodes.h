@@ -43,7 +43,10 @@
 #include "arm_compute/graph/nodes/FlattenLayerNode.h"
 #include "arm_compute/graph/nodes/FullyConnectedLayerNode.h"
 #include "arm_compute/graph/nodes/FusedConvolutionBatchNormalizationNode.h"
+#include "arm_compute/graph/nodes/FusedConvolutionEltwiseNode.h"
+#include "arm_compute/graph/nodes/FusedConvolutionPoolingNode.h"
 #include "arm_compute/graph/nodes/FusedDepthwiseConvolutionBatchNormalizationNode.h"
+#include "arm_compute/graph/nodes/FusedDepthwisePointwiseConvolutionNode.h"
 #include "arm_compute/graph/nodes/GenerateProposalsLayerNode.h"
 #include "arm_compute/graph/nodes/InputNode.h"
 #include "arm_compute/graph/nodes/L2NormalizeLayerNode.h"
@@ -67,5 +70,6 @@
 #include "arm_compute/graph/nodes/SplitLayerNode.h"
 #include "arm_compute/graph/nodes/StackLayerNode.h"
 #include "arm_compute/graph/nodes/StridedSliceLayerNode.h"
+#include "arm_compute/graph/nodes/TiledLayerChainNode.h"
 
 #endif /* ARM_COMPUTE_GRAPH_NODES_H */
@@ -49,7 +49,10 @@ class EltwiseLayerNode;
 class FlattenLayerNode;
 class FullyConnectedLayerNode;
 class FusedConvolutionBatchNormalizationNode;
+class FusedConvolutionEltwiseNode;
+class FusedConvolutionPoolingNode;
 class FusedDepthwiseConvolutionBatchNormalizationNode;
+class FusedDepthwisePointwiseConvolutionNode;
 class GenerateProposalsLayerNode;
 class InputNode;
 class L2NormalizeLayerNode;
@@ -73,6 +76,7 @@ class SliceLayerNode;
 class SplitLayerNode;
 class StackLayerNode;
 class StridedSliceLayerNode;
+class TiledLayerChainNode;
 } // namespace graph
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_GRAPH_NODES_FWD_H */
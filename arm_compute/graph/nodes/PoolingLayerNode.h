@@ -44,6 +44,11 @@ public:
      * @return Pooling Layer info
      */
     PoolingLayerInfo pooling_info() const;
+    /** Sets the data layout the pooling operates in
+     *
+     * @param[in] data_layout Data layout of the input and output tensors
+     */
+    void set_data_layout(DataLayout data_layout);
     /** Computes pooling output descriptor
      *
      * @param[in] input_descriptor Input descriptor
@@ -59,6 +64,9 @@ public:
     TensorDescriptor configure_output(size_t idx) const override;
     void accept(INodeVisitor &v) override;
 
+public:
+    static constexpr NodeType node_type = NodeType::PoolingLayer;
+
 private:
     PoolingLayerInfo _info;
 };
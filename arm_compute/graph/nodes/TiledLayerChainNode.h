@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_TILED_LAYER_CHAIN_NODE_H
+#define ARM_COMPUTE_GRAPH_TILED_LAYER_CHAIN_NODE_H
+
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/LayerDescriptors.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Chain of spatially local layers run band by band along the height
+ *
+ * Input 0 is the input of the first layer. Each layer then owns @ref num_layer_inputs inputs, connected for
+ * convolutions only: weights, bias and the mean, variance, beta and gamma of a batch normalization folded
+ * into the weights.
+ */
+class TiledLayerChainNode final : public INode
+{
+public:
+    /** Number of inputs owned by each layer of the chain */
+    static constexpr size_t num_layer_inputs = 6;
+
+    /** Constructor
+     *
+     * @param[in] layers Layers of the chain, in execution order
+     */
+    TiledLayerChainNode(std::vector<descriptors::TiledLayerDescriptor> layers);
+
+    /** Layers accessor
+     *
+     * @return Layers of the chain, in execution order
+     */
+    const std::vector<descriptors::TiledLayerDescriptor> &layers() const;
+
+    /** Computes the index of an input of a layer
+     *
+     * @param[in] layer Index of the layer in the chain
+     * @param[in] idx   Index of the input in the layer inputs: 0 weights, 1 bias, 2 mean, 3 variance, 4 beta and 5 gamma
+     *
+     * @return Index of the input in the node inputs
+     */
+    static size_t layer_input_idx(size_t layer, size_t idx);
+
+    // Inherited overridden methods:
+    NodeType         type() const override;
+    bool             forward_descriptors() override;
+    TensorDescriptor configure_output(size_t idx) const override;
+    void accept(INodeVisitor &v) override;
+
+public:
+    static constexpr NodeType node_type = NodeType::TiledLayerChain;
+
+private:
+    std::vector<descriptors::TiledLayerDescriptor> _layers;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_TILED_LAYER_CHAIN_NODE_H */
@@ -161,6 +161,14 @@ public:
      */
     virtual unsigned int num_threads() const = 0;
 
+    /** Returns the kernel thread ids of the worker threads owned by the scheduler.
+     *
+     * @note The thread calling the scheduler also executes workloads and is not part of the returned list.
+     *
+     * @return Worker thread ids, empty if the scheduler does not own any worker thread.
+     */
+    virtual std::vector<int> worker_thread_ids() const;
+
     /** Runs the kernel in the same thread as the caller synchronously.
      *
      * @param[in] kernel Kernel to execute.
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_KERNEL_SELECTION_LOG_H
+#define ARM_COMPUTE_KERNEL_SELECTION_LOG_H
+
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Log of the assembly kernels selected by the functions configured on the calling thread
+ *
+ * Lets a caller find out which kernel (e.g. which arm_gemm variant) the functions it configures end up running.
+ * Nothing is recorded on threads that did not call @ref start.
+ */
+class KernelSelectionLog
+{
+public:
+    /** Starts recording the kernels selected on the calling thread, forgetting the ones recorded so far */
+    static void start();
+    /** Stops recording on the calling thread
+     *
+     * @return Names of the kernels selected since @ref start, in configuration order
+     */
+    static std::vector<std::string> stop();
+    /** Records a selected kernel, if recording on the calling thread
+     *
+     * @param[in] kernel_name Name of the kernel
+     */
+    static void record(const std::string &kernel_name);
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_KERNEL_SELECTION_LOG_H */
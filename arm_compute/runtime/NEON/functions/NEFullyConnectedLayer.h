@@ -28,14 +28,21 @@
 #include "arm_compute/runtime/NEON/INESimpleFunctionNoBorder.h"
 
 #include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEConvertFullyConnectedWeights.h"
 #include "arm_compute/runtime/NEON/functions/NEFlattenLayer.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <memory>
+
 namespace arm_compute
 {
+// Forward declarations
+class NEGEMVKernel;
+struct GEMVPackedWeights;
+
 /** Basic function to reshape the weights of Fully Connected layer with Neon. This function calls the following kernels:
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
@@ -116,6 +123,7 @@ private:
  *  -# @ref NEFullyConnectedLayerReshapeWeights (if @p are_weights_reshaped is set to false and transpose_weights is set to true ) (called once)
  *  -# @ref NEGEMMMatrixMultiplyKernel or @ref NEGEMMLowpMatrixMultiplyCore (if quantized asymmetric)
  *  -# @ref NEGEMMMatrixAdditionKernel or @ref NEGEMMLowpQuantizeDownInt32ToUint8ScaleByFixedPoint (if quantized asymmetric) (if @p biases is not equal to nullptr)
+ *  -# @ref NEGEMVKernel instead of the matrix multiplication, followed by @ref NEActivationLayer, if the input is a single F32 vector
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
  */
@@ -187,14 +195,21 @@ private:
     weights_transformations::NEFullyConnectedLayerReshapeWeightsManaged _reshape_weights_managed_function;
     NEGEMM                                                              _mm_gemm;
     NEGEMMLowpMatrixMultiplyCore                                        _mm_gemmlowp;
+    std::unique_ptr<NEGEMVKernel>                                       _gemv_kernel;
+    std::unique_ptr<GEMVPackedWeights>                                  _gemv_weights;
+    NEActivationLayer                                                   _gemv_activation;
     Tensor                                                              _flatten_output;
     Tensor                                                              _converted_weights_output;
     Tensor                                                              _reshape_weights_output;
     const ITensor                                                      *_original_weights;
+    const ITensor                                                      *_gemv_weights_source;
+    DataType                                                            _gemv_weights_type;
     bool                                                                _are_weights_converted;
     bool                                                                _are_weights_reshaped;
     bool                                                                _is_fc_after_conv;
     bool                                                                _is_quantized_asymmetric;
+    bool                                                                _is_gemv;
+    bool                                                                _run_gemv_activation;
     bool                                                                _is_prepared;
 };
 } // namespace arm_compute
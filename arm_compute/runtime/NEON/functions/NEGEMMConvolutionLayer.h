@@ -30,6 +30,7 @@
 #include "arm_compute/runtime/IWeightsManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConv2d.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpMatrixMultiplyCore.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMMLowpOutputStage.h"
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
@@ -159,6 +160,8 @@ private:
  * -# @ref NEArithmeticAddition (if biases != nullptr and we have a 1x1 convolution with the NHWC data layout)
  * -# @ref NECol2ImKernel (if NCHW data layout)
  *
+ * NHWC convolutions that would need @ref NEIm2ColKernel run through @ref NEGEMMConv2d instead whenever the assembly GEMM supports them:
+ * its indirect kernels build the rows of pointers into the input block by block, so the im2col matrix is never written to memory.
  */
 class NEGEMMConvolutionLayer : public IFunction
 {
@@ -262,6 +265,21 @@ private:
      * @return a status
      */
     static Status validate_gemm3d(const ITensorInfo *input_info, const ITensorInfo *weights_info, const ActivationLayerInfo &act_info, int gemm_3d_depth, bool skip_im2col);
+    /** Static function to check if the convolution can run through the indirect assembly GEMM of @ref NEGEMMConv2d instead of an im2col
+     *
+     * @param[in] input        Source tensor info. Data types supported: QASYMM8/QASYMM8_SIGNED/F16/F32.
+     * @param[in] weights      Weights tensor info. Data type supported: QASYMM8/QASYMM8_SIGNED/QSYMM8_PER_CHANNEL/F16/F32.
+     * @param[in] biases       Biases tensor info. Data type supported: Same as @p input, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
+     * @param[in] output       Destination tensor info. Data types supported: Same as @p input.
+     * @param[in] conv_info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info Specifies if the weights tensor has been reshaped with NEWeightsReshapeKernel.
+     * @param[in] dilation     Dilation, in elements, across x and y.
+     * @param[in] act_info     Activation layer information in case of a fused activation.
+     *
+     * @return a status
+     */
+    static Status validate_indirect(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                    const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info);
 
 private:
     MemoryGroup                                                        _memory_group;
@@ -273,6 +291,7 @@ private:
     NEGEMMLowpMatrixMultiplyCore                                       _mm_gemmlowp;
     std::unique_ptr<NECol2ImKernel>                                    _col2im_kernel;
     NEReshapeLayer                                                     _reshape_layer;
+    NEGEMMConv2d                                                       _indirect_conv;
 
     const ITensor *_original_weights;
     const ITensor *_original_output;
@@ -287,6 +306,7 @@ private:
 
     bool _skip_im2col;
     bool _skip_col2im;
+    bool _run_indirect;
     bool _is_quantized;
     bool _is_prepared;
 };
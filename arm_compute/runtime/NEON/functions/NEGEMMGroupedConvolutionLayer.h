@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEGEMMGROUPEDCONVOLUTIONLAYER_H
+#define ARM_COMPUTE_NEGEMMGROUPEDCONVOLUTIONLAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class NECol2ImKernel;
+class NEGEMMAssemblyDispatch;
+class NEIm2ColKernel;
+class NEWeightsReshapeKernel;
+
+/** Basic function to compute a grouped convolution as a single GEMM with one multi per group. This function calls the following Neon kernels/functions:
+ *
+ * -# @ref NEIm2ColKernel, writing the patches of each group to its own plane
+ * -# @ref NEGEMMAssemblyDispatch, computing all the groups in one call
+ * -# @ref NECol2ImKernel, interleaving the groups back into the output channels
+ * -# @ref NEActivationLayer, in case activation cannot be fused in the assembly dispatch
+ *
+ * Weights are reshaped once with @ref NEWeightsReshapeKernel into one [OFM / num_groups, IFM / num_groups * kernel_area] matrix per group.
+ *
+ * Compared to splitting the input, running one convolution per group and concatenating the results, the input and output
+ * are touched once and the groups share a single parallel region.
+ */
+class NEGEMMGroupedConvolutionLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NEGEMMGroupedConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMGroupedConvolutionLayer(const NEGEMMGroupedConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGEMMGroupedConvolutionLayer(NEGEMMGroupedConvolutionLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMGroupedConvolutionLayer &operator=(const NEGEMMGroupedConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NEGEMMGroupedConvolutionLayer &operator=(NEGEMMGroupedConvolutionLayer &&) = delete;
+    /** Default destructor */
+    ~NEGEMMGroupedConvolutionLayer();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input            Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                              while every optional dimension from 4 and above represent a batch of inputs.
+     *                              Data types supported: F16/F32.
+     * @param[in]  weights          Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases           Biases tensor. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[out] output           Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                              Data types supported: Same as @p input.
+     * @param[in]  conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  weights_info     (Optional) Specifies if the weights tensor has been reshaped. Reshaped weights are not supported.
+     * @param[in]  dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation.
+     * @param[in]  enable_fast_math (Optional) Enable fast math computation. The assembly GEMM has no reduced precision mode, so the result is the same either way.
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. Must divide both IFM and OFM.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
+                   const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false, unsigned int num_groups = 1);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMMGroupedConvolutionLayer
+     *
+     * @param[in] input            Source tensor info. 3 lower dimensions represent a single input [width, height, IFM],
+     *                             while every optional dimension from 4 and above represent a batch of inputs.
+     *                             Data types supported: F16/F32.
+     * @param[in] weights          Weights tensor info. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported: Same as @p input.
+     * @param[in] biases           Biases tensor info. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p input.
+     * @param[in] output           Destination tensor info. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                             Data types supported: Same as @p input.
+     * @param[in] conv_info        Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] weights_info     (Optional) Specifies if the weights tensor has been reshaped. Reshaped weights are not supported.
+     * @param[in] dilation         (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
+     * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
+     * @param[in] enable_fast_math (Optional) Enable fast math computation. The assembly GEMM has no reduced precision mode, so the result is the same either way.
+     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. Must divide both IFM and OFM.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                           const WeightsInfo &weights_info = WeightsInfo(), const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                           bool enable_fast_math = false, unsigned int num_groups = 1);
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                             _memory_group;
+    std::unique_ptr<NEIm2ColKernel>         _im2col_kernel;
+    std::unique_ptr<NEWeightsReshapeKernel> _weights_reshape_kernel;
+    std::unique_ptr<NEGEMMAssemblyDispatch> _gemm_asm_func;
+    std::unique_ptr<NECol2ImKernel>         _col2im_kernel;
+    NEActivationLayer                       _activation_func;
+
+    const ITensor *_original_weights;
+    const ITensor *_original_biases;
+    unsigned int   _num_groups;
+
+    Tensor _weights_grouped;  /**< Original weights seen as [kernel_x, kernel_y, IFM / num_groups, OFM / num_groups, num_groups] */
+    Tensor _weights_reshaped; /**< One GEMM B matrix per group */
+    Tensor _biases_grouped;   /**< Original biases seen as [OFM / num_groups, num_groups] */
+    Tensor _im2col_output;
+    Tensor _gemm_input;       /**< @p _im2col_output seen with the groups on the multi dimension of the GEMM */
+    Tensor _gemm_output;
+    Tensor _col2im_input;     /**< @p _gemm_output seen with the groups on the third dimension */
+
+    DataLayout _data_layout;
+    bool       _run_activation;
+    bool       _is_prepared;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEGEMMGROUPEDCONVOLUTIONLAYER_H */
@@ -41,10 +41,11 @@ class NENormalizationLayerKernel;
 
 /** Basic function to compute a normalization layer. This function calls the following Neon kernels:
  *
- * -# @ref NEPixelWiseMultiplication
- * -# @ref NEFillBorderKernel
+ * -# @ref NEPixelWiseMultiplication (if not CROSS_MAP)
  * -# @ref NENormalizationLayerKernel
  *
+ * CROSS_MAP normalization squares the input inside @ref NENormalizationLayerKernel in a single pass,
+ * unless it runs in-place.
  */
 class NENormalizationLayer : public IFunction
 {
@@ -84,10 +85,14 @@ public:
     void run() override;
 
 private:
+    /** Whether the squaring is done inside the normalization kernel */
+    static bool is_fused(const ITensorInfo *input, const ITensorInfo *output, const NormalizationLayerInfo &norm_info);
+
     MemoryGroup                                 _memory_group;  /**< Function memory group */
     std::unique_ptr<NENormalizationLayerKernel> _norm_kernel;   /**< Normalization layer kernel */
     NEPixelWiseMultiplication                   _multiply_f;    /**< Pixel multiplication function */
     Tensor                                      _input_squared; /**< The intermediate buffer which stores results of squaring input */
+    bool                                        _is_fused;      /**< True if the kernel squares the input on the fly */
 };
 }
 #endif /* ARM_COMPUTE_NENORMALIZATIONLAYER_H */
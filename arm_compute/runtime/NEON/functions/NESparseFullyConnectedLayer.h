@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NESPARSEFULLYCONNECTEDLAYER_H
+#define ARM_COMPUTE_NESPARSEFULLYCONNECTEDLAYER_H
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/IMemoryManager.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFlattenLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+class NESparseGEMVKernel;
+struct BlockSparseMatrix;
+
+/** Basic function to compute a fully connected layer with pruned weights. This function calls the following Neon kernels/functions:
+ *
+ * -# @ref NEFlattenLayer, if the layer follows a convolution
+ * -# @ref NESparseGEMVKernel
+ * -# @ref NEActivationLayer, if an activation is fused
+ *
+ * The dense weights are packed once, at prepare time, into a block compressed sparse row matrix of 1x4 or 4x4 blocks
+ * holding only the blocks with a non-zero weight. The original weights are then marked as unused, so the graph
+ * releases them and only the packed weights stay resident.
+ */
+class NESparseFullyConnectedLayer : public IFunction
+{
+public:
+    /** Constructor */
+    NESparseFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseFullyConnectedLayer(const NESparseFullyConnectedLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NESparseFullyConnectedLayer(NESparseFullyConnectedLayer &&) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseFullyConnectedLayer &operator=(const NESparseFullyConnectedLayer &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains non movable objects) */
+    NESparseFullyConnectedLayer &operator=(NESparseFullyConnectedLayer &&) = delete;
+    /** Default destructor */
+    ~NESparseFullyConnectedLayer();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input        Source tensor. Data type supported: F32.
+     * @param[in]  weights      Dense weights tensor, with pruned weights set to zero. The weights must be 2 dimensional, see @ref NEFullyConnectedLayer.
+     *                          Data type supported: Same as @p input.
+     * @param[in]  biases       Bias tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output       Destination tensor. Data type supported: Same as @p input.
+     * @param[in]  fc_info      (Optional) Fully connected layer additional info
+     * @param[in]  block_height (Optional) Outputs per block of the packed weights, 1 or 4. Defaults to 1.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output,
+                   FullyConnectedLayerInfo fc_info = FullyConnectedLayerInfo(), unsigned int block_height = 1);
+    /** Static function to check if given info will lead to a valid configuration of @ref NESparseFullyConnectedLayer
+     *
+     * @param[in] input        Source tensor info. Data type supported: F32.
+     * @param[in] weights      Dense weights tensor info. The weights must be 2 dimensional. Data type supported: Same as @p input.
+     * @param[in] biases       Bias tensor info. Can be nullptr. Data type supported: Same as @p input.
+     * @param[in] output       Destination tensor info. Data type supported: Same as @p input.
+     * @param[in] fc_info      (Optional) Fully connected layer additional info
+     * @param[in] block_height (Optional) Outputs per block of the packed weights, 1 or 4. Defaults to 1.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
+                           FullyConnectedLayerInfo fc_info = FullyConnectedLayerInfo(), unsigned int block_height = 1);
+    /** Ratio of the weights stored after packing to the dense weights, 0 before @ref prepare */
+    float density() const;
+
+    // Inherited methods overridden:
+    void run() override;
+    void prepare() override;
+
+private:
+    MemoryGroup                         _memory_group;
+    NEFlattenLayer                      _flatten;
+    std::unique_ptr<NESparseGEMVKernel> _sparse_gemv_kernel;
+    std::unique_ptr<BlockSparseMatrix>  _packed_weights;
+    NEActivationLayer                   _activation_func;
+    Tensor                              _flatten_output;
+    const ITensor                      *_original_weights;
+    unsigned int                        _block_height;
+    bool                                _weights_transposed;
+    bool                                _is_fc_after_conv;
+    bool                                _run_activation;
+    bool                                _is_prepared;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NESPARSEFULLYCONNECTEDLAYER_H */
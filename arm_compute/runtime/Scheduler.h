@@ -73,6 +73,13 @@ public:
      * @return true if the given scheduler type is supported. False otherwise.
      */
     static bool is_available(Type t);
+    /** Overrides the scheduler returned by @ref get() on the calling thread
+     *
+     * Lets concurrent host threads dispatch their kernels to separate thread pools.
+     *
+     * @param[in] scheduler Scheduler to use on the calling thread, nullptr to go back to the active scheduler.
+     */
+    static void set_thread_scheduler(IScheduler *scheduler);
 
 private:
     static Type                        _scheduler_type;
@@ -123,6 +123,20 @@ public:
 				config.tuner_mode  = common_params.tuner_mode;
 				config.tuner_file  = common_params.tuner_file;
 				config.mlgo_file   = common_params.mlgo_file;
+				config.kernel_counters = common_params.counters;
+				config.pmu_counters    = common_params.pmu;
+				config.tile_layers     = common_params.tile;
+				config.use_conv_method_table = common_params.conv_table;
+				config.parallel_branches = common_params.branches;
+				config.co_execute_layers = common_params.co_execute;
+				config.plan_layouts      = common_params.plan_layouts;
+				config.static_memory_plan = common_params.static_memory;
+				config.precision_policy = stage_precisions[gr_layer[Layer-1]].gemm_precision;
+				config.bf16_layers      = common_params.bf16_layers;
+				config.report_kernels   = common_params.kernel_report;
+				config.sparse_fc_layers = common_params.sparse_fc;
+				config.sparse_block_height = common_params.sparse_block;
+				config.gemv_weights_type = common_params.gemv_weights;
 				//std::cout<<"Finalizing graph_"<<gr_layer[Layer-1]<<"\t after Layer:"<<Layer-1<<std::endl;
 				//std::cout<<"class:"<<config.cluster<<"\t target:"<<int(targets[gr_layer[Layer-1]])<<'='<<int(common_params.target)<<std::endl;
 				std::set<int> e_t;
@@ -163,6 +177,8 @@ public:
 			if(Layer!=Layers){
 				arm_compute::graph::Tensor* temp_sender;
 				TensorShape tshape;
+				QuantizationInfo tquant;
+				DataLayout tlayout=common_params.data_layout;
 				//if(gr_layer[Layer]!=-1){
 					for(auto &node : sub_graph->graph().nodes())
 					{
@@ -172,10 +188,14 @@ public:
 								Transmitters.push_back(node->input(0));
 								//tshape=Transmitters[gr_layer[Layer-1]]->desc().shape;
 								tshape=Transmitters[Transmitters.size()-1]->desc().shape;
+								tquant=Transmitters[Transmitters.size()-1]->desc().quant_info;
+								tlayout=Transmitters[Transmitters.size()-1]->desc().layout;
 							}
 							else{
 								temp_sender=node->input(0);
 								tshape=temp_sender->desc().shape;
+								tquant=temp_sender->desc().quant_info;
+								tlayout=temp_sender->desc().layout;
 							}
 							continue;
 						}
@@ -197,8 +217,10 @@ public:
 					}
 
 					common_params.target=targets[gr_layer[Layer]];
+					common_params.data_type=stage_precisions[gr_layer[Layer]].data_type;
 					const auto        operation_layout = common_params.data_layout;
-					TensorDescriptor input_descriptor = TensorDescriptor(tshape, common_params.data_type).set_layout(operation_layout);
+					// Only spatial tensors are permuted, the outputs of fully connected layers keep their shape
+					TensorDescriptor input_descriptor = TensorDescriptor(tshape.num_dimensions() >= 3 ? permute_shape(tshape, tlayout, operation_layout) : tshape, common_params.data_type, tquant).set_layout(operation_layout);
 					(*sub_graph) << common_params.target
 								  << common_params.fast_math_hint;
 					//std::cout<<common_params.image<<", "<<Transmitters.size()-1<<std::endl;
@@ -219,7 +241,8 @@ public:
 					sub_graph=dump_graph;
 					common_params.target=arm_compute::graph::Target ::NEON;
 					const auto        operation_layout = common_params.data_layout;
-					TensorDescriptor input_descriptor = TensorDescriptor(tshape, common_params.data_type).set_layout(operation_layout);
+					// Only spatial tensors are permuted, the outputs of fully connected layers keep their shape
+					TensorDescriptor input_descriptor = TensorDescriptor(tshape.num_dimensions() >= 3 ? permute_shape(tshape, tlayout, operation_layout) : tshape, common_params.data_type, tquant).set_layout(operation_layout);
 					(*sub_graph) << common_params.target
 								  << common_params.fast_math_hint;
 					common_params.image="";
@@ -345,6 +368,7 @@ public:
         	}
         }
         per_frame=(graphs.size()>1);
+        stage_precisions=parse_stage_precisions(common_params.precision, graphs.size(), common_params.data_type);
 
         cpu_set_t set;
 		CPU_ZERO(&set);
@@ -364,6 +388,8 @@ public:
         else{
         	sub_graph=(graphs[gr_layer[Layer]]);
         	common_params.target=targets[gr_layer[Layer]];
+        	common_params.data_type=stage_precisions[gr_layer[Layer]].data_type;
+        	input_descriptor.set_data_type(common_params.data_type);
         }
 
 
@@ -415,8 +441,10 @@ public:
     	}
     	for(int i=0;i<graphs.size();i++){
 			//std::cout<<"graph_id: "<<i<<" \t start: "<<graphs[i]->get_start_time().time_since_epoch().count()<<" \t end: "<<graphs[i]->get_finish_time().time_since_epoch().count()<<std::endl;
-    		if(common_params.layer_time)
+    		if(common_params.layer_time || common_params.pmu)
     				graphs[i]->measure(n);
+    		if(common_params.counters)
+    				print_task_stats(std::cout, graphs[i]->task_stats());
 
 			double tot=graphs[i]->get_input_time()+graphs[i]->get_task_time()+graphs[i]->get_output_time();
 			PrintThread{}<<"\n\nCost"<<i<<":"<<1000*graphs[i]->get_cost_time()/n<<std::endl;
@@ -426,6 +454,8 @@ public:
 		}
 
 
+    	if(common_params.bottleneck)
+    		print_pipeline_analysis(std::cout, graphs, n);
     	std::cout<<"Frame Latency: "<<1000*latency/(common_params.n)<<std::endl;
     	del();
 
@@ -467,11 +497,13 @@ public:
 		graphs[graph_id]->set_task_time(0);
 		graphs[graph_id]->set_output_time(0);
 		graphs[graph_id]->set_cost_time(0);
-		if(layer_timing)
+		if(layer_timing || common_params.pmu)
 			graphs[graph_id]->reset();
 		std::this_thread::sleep_for(std::chrono::milliseconds(1000));
 		if(graph_id==0){
 			std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+			if(common_params.bottleneck)
+				reset_pipeline_stats();
 		}
 		auto tstart=std::chrono::high_resolution_clock::now();
 
@@ -529,6 +561,7 @@ private:
     std::vector<Stream*> graphs;
     std::vector<arm_compute::graph::Target> targets;
     std::vector<int> classes;
+    std::vector<StagePrecision> stage_precisions;
     std::vector<TensorDescriptor> inputs;
     Stream *sub_graph=NULL;
     int Layer=0;
@@ -733,6 +766,9 @@ private:
             QuantizationInfo(0.018048152327537537f, 95)   // dwsc13
         };
 
+        //Ehsan
+        Layer=0;
+
         (*sub_graph) << InputLayer(input_descriptor.set_quantization_info(in_quant_info),
                             get_input_accessor(common_params, nullptr, false))
               << ConvolutionLayer(
@@ -743,33 +779,90 @@ private:
                   1, conv_weights_quant_info.at(0), conv_out_quant_info.at(0))
               .set_name("Conv2d_0")
               << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f)).set_name("Conv2d_0/Relu6");
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_1", 64U, PadStrideInfo(1U, 1U, 1U, 1U), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(0), point_weights_quant_info.at(0));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_2", 128U, PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(1),
-                                      point_weights_quant_info.at(1));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_3", 128U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(2),
-                                      point_weights_quant_info.at(2));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_4", 256U, PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(3),
-                                      point_weights_quant_info.at(3));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_5", 256U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(4),
-                                      point_weights_quant_info.at(4));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_6", 512U, PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(5),
-                                      point_weights_quant_info.at(5));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_7", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(6),
-                                      point_weights_quant_info.at(6));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_8", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(7),
-                                      point_weights_quant_info.at(7));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_9", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(8),
-                                      point_weights_quant_info.at(8));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_10", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(9),
-                                      point_weights_quant_info.at(9));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_11", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(10),
-                                      point_weights_quant_info.at(10));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_12", 1024U, PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(11),
-                                      point_weights_quant_info.at(11));
-        (*sub_graph) << get_dwsc_node_qasymm(data_path, "Conv2d_13", 1024U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(12),
-                                      point_weights_quant_info.at(12))
-              << PoolingLayer(PoolingLayerInfo(PoolingType::AVG, common_params.data_layout)).set_name("Logits/AvgPool_1a")
-              << ConvolutionLayer(
+
+        Attach_Layer();
+
+        // Layer 2
+        get_dwsc_node_qasymm(data_path, "Conv2d_1", 64U, PadStrideInfo(1U, 1U, 1U, 1U), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(0),
+                             point_weights_quant_info.at(0));
+
+        Attach_Layer();
+
+        // Layer 4
+        get_dwsc_node_qasymm(data_path, "Conv2d_2", 128U, PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(1),
+                             point_weights_quant_info.at(1));
+
+        Attach_Layer();
+
+        // Layer 6
+        get_dwsc_node_qasymm(data_path, "Conv2d_3", 128U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(2),
+                             point_weights_quant_info.at(2));
+
+        Attach_Layer();
+
+        // Layer 8
+        get_dwsc_node_qasymm(data_path, "Conv2d_4", 256U, PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(3),
+                             point_weights_quant_info.at(3));
+
+        Attach_Layer();
+
+        // Layer 10
+        get_dwsc_node_qasymm(data_path, "Conv2d_5", 256U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(4),
+                             point_weights_quant_info.at(4));
+
+        Attach_Layer();
+
+        // Layer 12
+        get_dwsc_node_qasymm(data_path, "Conv2d_6", 512U, PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(5),
+                             point_weights_quant_info.at(5));
+
+        Attach_Layer();
+
+        // Layer 14
+        get_dwsc_node_qasymm(data_path, "Conv2d_7", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(6),
+                             point_weights_quant_info.at(6));
+
+        Attach_Layer();
+
+        // Layer 16
+        get_dwsc_node_qasymm(data_path, "Conv2d_8", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(7),
+                             point_weights_quant_info.at(7));
+
+        Attach_Layer();
+
+        // Layer 18
+        get_dwsc_node_qasymm(data_path, "Conv2d_9", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(8),
+                             point_weights_quant_info.at(8));
+
+        Attach_Layer();
+
+        // Layer 20
+        get_dwsc_node_qasymm(data_path, "Conv2d_10", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(9),
+                             point_weights_quant_info.at(9));
+
+        Attach_Layer();
+
+        // Layer 22
+        get_dwsc_node_qasymm(data_path, "Conv2d_11", 512U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(10),
+                             point_weights_quant_info.at(10));
+
+        Attach_Layer();
+
+        // Layer 24
+        get_dwsc_node_qasymm(data_path, "Conv2d_12", 1024U, PadStrideInfo(2U, 2U, 0U, 1U, 0U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(11),
+                             point_weights_quant_info.at(11));
+
+        Attach_Layer();
+
+        // Layer 26
+        get_dwsc_node_qasymm(data_path, "Conv2d_13", 1024U, PadStrideInfo(1U, 1U, 1U, 1U, 1U, 1U, DimensionRoundingType::FLOOR), PadStrideInfo(1U, 1U, 0U, 0U), depth_weights_quant_info.at(12),
+                             point_weights_quant_info.at(12));
+        (*sub_graph) << PoolingLayer(PoolingLayerInfo(PoolingType::AVG, common_params.data_layout)).set_name("Logits/AvgPool_1a");
+
+        Attach_Layer();
+
+        // Layer 28
+        (*sub_graph) << ConvolutionLayer(
                   1U, 1U, 1001U,
                   get_weights_accessor(data_path, "Logits_Conv2d_1c_1x1_weights.npy"),
                   get_weights_accessor(data_path, "Logits_Conv2d_1c_1x1_bias.npy"),
@@ -822,30 +915,30 @@ private:
 
 
 
-    ConcatLayer get_dwsc_node_qasymm(const std::string &data_path, std::string &&param_path,
-                                     const unsigned int conv_filt,
-                                     PadStrideInfo dwc_pad_stride_info, PadStrideInfo conv_pad_stride_info,
-                                     QuantizationInfo depth_weights_quant_info, QuantizationInfo point_weights_quant_info)
+    void get_dwsc_node_qasymm(const std::string &data_path, std::string &&param_path,
+                              const unsigned int conv_filt,
+                              PadStrideInfo dwc_pad_stride_info, PadStrideInfo conv_pad_stride_info,
+                              QuantizationInfo depth_weights_quant_info, QuantizationInfo point_weights_quant_info)
     {
         std::string total_path = param_path + "_";
-        SubStream   sg(*sub_graph);
 
-        sg << DepthwiseConvolutionLayer(
+        (*sub_graph) << DepthwiseConvolutionLayer(
                3U, 3U,
                get_weights_accessor(data_path, total_path + "depthwise_weights.npy"),
                get_weights_accessor(data_path, total_path + "depthwise_bias.npy"),
                dwc_pad_stride_info, 1, std::move(depth_weights_quant_info))
            .set_name(total_path + "depthwise/depthwise")
-           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f)).set_name(total_path + "depthwise/Relu6")
-           << ConvolutionLayer(
+           << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f)).set_name(total_path + "depthwise/Relu6");
+
+        Attach_Layer();
+
+        (*sub_graph) << ConvolutionLayer(
                1U, 1U, conv_filt,
                get_weights_accessor(data_path, total_path + "pointwise_weights.npy"),
                get_weights_accessor(data_path, total_path + "pointwise_bias.npy"),
                conv_pad_stride_info, 1, std::move(point_weights_quant_info))
            .set_name(total_path + "pointwise/Conv2D")
            << ActivationLayer(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f)).set_name(total_path + "pointwise/Relu6");
-
-        return ConcatLayer(std::move(sg));
     }
 };
 
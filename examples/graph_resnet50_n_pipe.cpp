@@ -118,6 +118,23 @@ public:
 				config.tuner_mode  = common_params.tuner_mode;
 				config.tuner_file  = common_params.tuner_file;
 				config.mlgo_file   = common_params.mlgo_file;
+				config.kernel_counters = common_params.counters;
+				config.pmu_counters    = common_params.pmu;
+				config.tile_layers     = common_params.tile;
+				config.use_conv_method_table = common_params.conv_table;
+				config.parallel_branches = common_params.branches;
+				config.co_execute_layers = common_params.co_execute;
+				config.plan_layouts      = common_params.plan_layouts;
+				config.static_memory_plan = common_params.static_memory;
+				config.precision_policy = stage_precisions[gr_layer[Layer-1]].gemm_precision;
+				config.bf16_layers      = common_params.bf16_layers;
+				config.report_kernels   = common_params.kernel_report;
+				config.sparse_fc_layers = common_params.sparse_fc;
+				config.sparse_block_height = common_params.sparse_block;
+				config.gemv_weights_type = common_params.gemv_weights;
+				config.convert_to_uint8 = (common_params.data_type == DataType::QASYMM8);
+				config.calibrate        = common_params.calibrate;
+				config.quant_table_file = common_params.quant_table;
 				//std::cout<<"Finalizing graph_"<<gr_layer[Layer-1]<<"\t after Layer:"<<Layer-1<<std::endl;
 				//std::cout<<"class:"<<config.cluster<<"\t target:"<<int(targets[gr_layer[Layer-1]])<<'='<<int(common_params.target)<<std::endl;
 				std::set<int> e_t;
@@ -166,6 +183,8 @@ public:
 			if(Layer!=Layers){
 				arm_compute::graph::Tensor* temp_sender;
 				TensorShape tshape;
+				arm_compute::QuantizationInfo tquant;
+				DataLayout tlayout=common_params.data_layout;
 				//if(gr_layer[Layer]!=-1){
 					for(auto &node : sub_graph->graph().nodes())
 					{
@@ -175,10 +194,14 @@ public:
 								Transmitters.push_back(node->input(0));
 								//tshape=Transmitters[gr_layer[Layer-1]]->desc().shape;
 								tshape=Transmitters[Transmitters.size()-1]->desc().shape;
+								tquant=Transmitters[Transmitters.size()-1]->desc().quant_info;
+								tlayout=Transmitters[Transmitters.size()-1]->desc().layout;
 							}
 							else{
 								temp_sender=node->input(0);
 								tshape=temp_sender->desc().shape;
+								tquant=temp_sender->desc().quant_info;
+								tlayout=temp_sender->desc().layout;
 							}
 							continue;
 						}
@@ -200,8 +223,10 @@ public:
 					}
 
 					common_params.target=targets[gr_layer[Layer]];
+					common_params.data_type=stage_precisions[gr_layer[Layer]].data_type;
 					const auto        operation_layout = common_params.data_layout;
-					TensorDescriptor input_descriptor = TensorDescriptor(tshape, common_params.data_type).set_layout(operation_layout);
+					// Only spatial tensors are permuted, the outputs of fully connected layers keep their shape
+					TensorDescriptor input_descriptor = TensorDescriptor(tshape.num_dimensions() >= 3 ? permute_shape(tshape, tlayout, operation_layout) : tshape, common_params.data_type, tquant).set_layout(operation_layout);
 					(*sub_graph) << common_params.target
 								  << common_params.fast_math_hint;
 					//std::cout<<common_params.image<<", "<<Transmitters.size()-1<<std::endl;
@@ -222,7 +247,8 @@ public:
 					sub_graph=dump_graph;
 					common_params.target=arm_compute::graph::Target ::NEON;
 					const auto        operation_layout = common_params.data_layout;
-					TensorDescriptor input_descriptor = TensorDescriptor(tshape, common_params.data_type).set_layout(operation_layout);
+					// Only spatial tensors are permuted, the outputs of fully connected layers keep their shape
+					TensorDescriptor input_descriptor = TensorDescriptor(tshape.num_dimensions() >= 3 ? permute_shape(tshape, tlayout, operation_layout) : tshape, common_params.data_type, tquant).set_layout(operation_layout);
 					(*sub_graph) << common_params.target
 								  << common_params.fast_math_hint;
 					common_params.image="";
@@ -259,6 +285,10 @@ public:
             return false;
         }
 
+        // Checks
+        ARM_COMPUTE_EXIT_ON_MSG(common_params.calibrate && (common_params.data_type != DataType::F32 || common_params.quant_table.empty()),
+                                "Calibration runs the F32 graph and writes the file given by quant_table");
+
         // Print parameter values
         //std::cout << common_params << std::endl;
 
@@ -351,6 +381,7 @@ public:
         	}
         }
         per_frame=(graphs.size()>1);
+        stage_precisions=parse_stage_precisions(common_params.precision, graphs.size(), common_params.data_type);
 
         /*for(auto i:graphs){
         	std::cout<<i->graph().id()<<std::endl;
@@ -375,6 +406,8 @@ public:
         else{
         	sub_graph=(graphs[gr_layer[Layer]]);
         	common_params.target=targets[gr_layer[Layer]];
+        	common_params.data_type=stage_precisions[gr_layer[Layer]].data_type;
+        	input_descriptor.set_data_type(common_params.data_type);
         }
 
         //***************************************************************
@@ -383,7 +416,7 @@ public:
 
         (*sub_graph) << common_params.target
               << common_params.fast_math_hint;
-        (*sub_graph)<< InputLayer(input_descriptor, get_input_accessor(common_params, std::move(preprocessor), false /* Do not convert to BGR */));
+        (*sub_graph)<< InputLayer(input_descriptor, get_input_accessor(common_params, std::move(preprocessor), false /* Do not convert to BGR */)).set_name("input");
         (*sub_graph)<< ConvolutionLayer(
                   7U, 7U, 64U,
                   get_weights_accessor(data_path, "/cnn_data/resnet50_model/conv1_weights.npy", weights_layout),
@@ -457,8 +490,10 @@ private:
     	}
     	for(int i=0;i<graphs.size();i++){
 			//std::cout<<"graph_id: "<<i<<" \t start: "<<graphs[i]->get_start_time().time_since_epoch().count()<<" \t end: "<<graphs[i]->get_finish_time().time_since_epoch().count()<<std::endl;
-    		if(common_params.layer_time)
+    		if(common_params.layer_time || common_params.pmu)
     				graphs[i]->measure(n);
+    		if(common_params.counters)
+    				print_task_stats(std::cout, graphs[i]->task_stats());
 
 			double tot=graphs[i]->get_input_time()+graphs[i]->get_task_time()+graphs[i]->get_output_time();
 			PrintThread{}<<"\n\nCost"<<i<<":"<<1000*graphs[i]->get_cost_time()/n<<std::endl;
@@ -468,6 +503,10 @@ private:
 		}
 
 
+    	if(common_params.bottleneck)
+    		print_pipeline_analysis(std::cout, graphs, n);
+    	if(common_params.calibrate)
+    		arm_compute::graph::QuantizationTable::get().save(common_params.quant_table);
     	PrintThread{}<<"Frame Latency: "<<1000*latency/(common_params.n)<<std::endl;
     	del();
 
@@ -509,11 +548,13 @@ private:
 		graphs[graph_id]->set_task_time(0);
 		graphs[graph_id]->set_output_time(0);
 		graphs[graph_id]->set_cost_time(0);
-		if(layer_timing)
+		if(layer_timing || common_params.pmu)
 			graphs[graph_id]->reset();
 		std::this_thread::sleep_for(std::chrono::milliseconds(1000));
 		if(graph_id==0){
 			std::this_thread::sleep_for(std::chrono::milliseconds(4000));
+			if(common_params.bottleneck)
+				reset_pipeline_stats();
 		}
 		auto tstart=std::chrono::high_resolution_clock::now();
 
@@ -574,6 +615,7 @@ private:
     std::vector<Stream*> graphs;
     std::vector<arm_compute::graph::Target> targets;
     std::vector<int> classes;
+    std::vector<StagePrecision> stage_precisions;
     std::vector<TensorDescriptor> inputs;
     Stream *sub_graph=NULL;
     int Layer=0;
@@ -32,6 +32,12 @@
 
 using namespace arm_compute;
 
+namespace
+{
+/** Core whose model is reported on the current thread, -1 for the core the thread runs on */
+thread_local int thread_cpu = -1;
+} // namespace
+
 void CPUInfo::set_fp16(const bool fp16)
 {
     _fp16 = fp16;
@@ -108,8 +114,17 @@ CPUInfo::CPUInfo()
     _percpu[0] = CPUModel::GENERIC;
 }
 
+void CPUInfo::set_thread_cpu(int cpuid)
+{
+    thread_cpu = cpuid;
+}
+
 CPUModel CPUInfo::get_cpu_model() const
 {
+    if(thread_cpu >= 0)
+    {
+        return get_cpu_model(thread_cpu);
+    }
 #if defined(BARE_METAL) || defined(__APPLE__) || (!defined(__arm__) && !defined(__aarch64__))
     return get_cpu_model(0);
 #else  /* defined(BARE_METAL) || defined(__APPLE__) || (!defined(__arm__) && !defined(__aarch64__)) */
@@ -42,15 +42,18 @@ using namespace misc::shape_calculator;
 
 namespace
 {
-Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims)
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims, unsigned int num_groups)
 {
     //Note: ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input) is not needed here as this kernel doesn't use Neon FP16 instructions.
     ARM_COMPUTE_RETURN_ERROR_ON(input->data_type() == DataType::UNKNOWN);
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups > 1 && input->dimension(2) != num_groups);
 
     // Validate configured output
     if(output->total_size() != 0)
     {
-        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), compute_col2im_shape(*input, convolved_dims, false));
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(),
+                                                           compute_col2im_shape(input->clone()->set_data_layout(output->data_layout()), convolved_dims, false, num_groups));
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_QUANTIZATION_INFO(input, output);
     }
@@ -58,10 +61,10 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, c
     return Status{};
 }
 
-std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const Size2D &convolved_dims)
+std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITensorInfo *output, const Size2D &convolved_dims, unsigned int num_groups)
 {
     // Output auto inizialitation if not yet initialized
-    auto_init_if_empty(*output, input->clone()->set_tensor_shape(compute_col2im_shape(*input, convolved_dims, false)));
+    auto_init_if_empty(*output, input->clone()->set_tensor_shape(compute_col2im_shape(*input, convolved_dims, false, num_groups)));
 
     // Configure kernel window
     Window win = calculate_max_window(*input, Steps());
@@ -78,9 +81,13 @@ std::pair<Status, Window> validate_and_configure_window(ITensorInfo *input, ITen
 template <typename T>
 void NECol2ImKernel::run_col2im(const Window &window)
 {
-    const int output_stride_x = _output->info()->strides_in_bytes().x();
-    const int output_stride_y = _output->info()->strides_in_bytes().y();
-    const int output_stride_z = _output->info()->strides_in_bytes().z();
+    const DataLayout data_layout     = _output->info()->data_layout();
+    const int        output_stride_x = _output->info()->strides_in_bytes()[get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH)];
+    const int        output_stride_y = _output->info()->strides_in_bytes()[get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT)];
+    const int        output_stride_z = _output->info()->strides_in_bytes()[get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL)];
+
+    // With groups, the Z plane of the input holds the output channels of one group
+    const int group_stride = (_num_groups > 1) ? _input->info()->dimension(0) * output_stride_z : 0;
 
     Window window_out(window);
     window_out.set(Window::DimX, Window::Dimension(0, 0, 0));
@@ -94,7 +101,7 @@ void NECol2ImKernel::run_col2im(const Window &window)
     execute_window_loop(window, [&](const Coordinates & id)
     {
         const int hidx = id.y();
-        const int idx  = id.x() * output_stride_z + (hidx / _convolved_dims.width) * output_stride_y + (hidx % _convolved_dims.width) * output_stride_x;
+        const int idx  = id.z() * group_stride + id.x() * output_stride_z + (hidx / _convolved_dims.width) * output_stride_y + (hidx % _convolved_dims.width) * output_stride_x;
 
         *(reinterpret_cast<T *>(out.ptr() + idx)) = *(reinterpret_cast<const T *>(in.ptr()));
     },
@@ -102,18 +109,19 @@ void NECol2ImKernel::run_col2im(const Window &window)
 }
 
 NECol2ImKernel::NECol2ImKernel()
-    : _func(), _input(nullptr), _output(nullptr), _convolved_dims()
+    : _func(), _input(nullptr), _output(nullptr), _convolved_dims(), _num_groups(1)
 {
 }
 
-void NECol2ImKernel::configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims)
+void NECol2ImKernel::configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims, unsigned int num_groups)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), convolved_dims));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), convolved_dims, num_groups));
 
     _input          = input;
     _output         = output;
     _convolved_dims = convolved_dims;
+    _num_groups     = num_groups;
 
     switch(input->info()->element_size())
     {
@@ -132,15 +140,15 @@ void NECol2ImKernel::configure(const ITensor *input, ITensor *output, const Size
     }
 
     // Configure kernel window
-    auto win_config = validate_and_configure_window(input->info(), output->info(), convolved_dims);
+    auto win_config = validate_and_configure_window(input->info(), output->info(), convolved_dims, num_groups);
     ARM_COMPUTE_ERROR_THROW_ON(win_config.first);
     INEKernel::configure(win_config.second);
 }
 
-Status NECol2ImKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims)
+Status NECol2ImKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims, unsigned int num_groups)
 {
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, convolved_dims));
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), convolved_dims).first);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, convolved_dims, num_groups));
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_and_configure_window(input->clone().get(), output->clone().get(), convolved_dims, num_groups).first);
     return Status{};
 }
 
@@ -76,18 +76,22 @@ public:
      * @param[out] output         The output tensor. 3 lower dimensions represent a single output [width, height, OFM],
      *                            while the rest represent batch of outputs. Data types supported: Same as @p input
      * @param[in]  convolved_dims Output convolved dimensions.
+     * @param[in]  num_groups     (Optional) Number of groups when performing a grouped convolution. With num_groups > 1 the input is
+     *                            [OFM / num_groups, num_elems_per_out_channel, num_groups, batches].
      */
-    void configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims);
+    void configure(const ITensor *input, ITensor *output, const Size2D &convolved_dims, unsigned int num_groups = 1);
     /** Static function to check if given info will lead to a valid configuration of @ref NECol2ImKernel
      *
      * @param[in] input          The input tensor to convert. Data types supported: All
      * @param[in] output         The output tensor. 3 lower dimensions represent a single output [width, height, OFM],
      *                           while the rest represent batch of outputs. Data types supported: Same as @p input
      * @param[in] convolved_dims Output convolved dimensions.
+     * @param[in] num_groups     (Optional) Number of groups when performing a grouped convolution. With num_groups > 1 the input is
+     *                           [OFM / num_groups, num_elems_per_out_channel, num_groups, batches].
      *
      * @return a status
      */
-    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims);
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Size2D &convolved_dims, unsigned int num_groups = 1);
 
     // Inherited methods overridden:
     void run(const Window &window, const ThreadInfo &info) override;
@@ -110,6 +114,7 @@ private:
     const ITensor    *_input;
     ITensor          *_output;
     Size2D            _convolved_dims;
+    unsigned int      _num_groups;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NECOL2IMKERNEL_H */
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEGEMVKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace arm_compute
+{
+namespace
+{
+/** Bytes of weights prefetched ahead of the ones being multiplied */
+constexpr size_t prefetch_distance = 1024;
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, DataType weights_type)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+#if defined(__aarch64__)
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_type != DataType::F32 && weights_type != DataType::F16 && weights_type != DataType::QSYMM8_PER_CHANNEL,
+                                    "Weights can only be stored in F32, F16 or QSYMM8_PER_CHANNEL");
+#else  /* defined(__aarch64__) */
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_type != DataType::F32 && weights_type != DataType::QSYMM8_PER_CHANNEL, "Weights can only be stored in F32 or QSYMM8_PER_CHANNEL");
+#endif /* defined(__aarch64__) */
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 1);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != output->dimension(0));
+    }
+
+    return Status{};
+}
+
+/** Loads the weights of one input for the outputs of a panel */
+inline void load_panel(const float *w, float32x4_t &lo, float32x4_t &hi)
+{
+    lo = vld1q_f32(w);
+    hi = vld1q_f32(w + 4);
+}
+
+#if defined(__aarch64__)
+inline void load_panel(const float16_t *w, float32x4_t &lo, float32x4_t &hi)
+{
+    const float16x8_t h = vld1q_f16(w);
+    lo                  = vcvt_f32_f16(vget_low_f16(h));
+    hi                  = vcvt_high_f32_f16(h);
+}
+#endif /* defined(__aarch64__) */
+
+inline void load_panel(const int8_t *w, float32x4_t &lo, float32x4_t &hi)
+{
+    const int16x8_t s = vmovl_s8(vld1_s8(w));
+    lo                = vcvtq_f32_s32(vmovl_s16(vget_low_s16(s)));
+    hi                = vcvtq_f32_s32(vmovl_s16(vget_high_s16(s)));
+}
+
+/** Prefetches the weights read @ref prefetch_distance bytes after @p w, for one step of four inputs */
+template <typename T>
+inline void prefetch_panel(const T *w)
+{
+    const uint8_t *ptr = reinterpret_cast<const uint8_t *>(w) + prefetch_distance;
+    for(size_t offset = 0; offset < 4 * GEMVPackedWeights::panel_width * sizeof(T); offset += 64)
+    {
+        __builtin_prefetch(ptr + offset);
+    }
+}
+
+template <typename T>
+void gemv_panels(const float *input, const GEMVPackedWeights &weights, const float *biases, float *output, int panel_start, int panel_end)
+{
+    constexpr int pw = GEMVPackedWeights::panel_width;
+
+    const int    num_inputs   = static_cast<int>(weights.cols);
+    const int    num_outputs  = static_cast<int>(weights.rows);
+    const size_t panel_stride = static_cast<size_t>(num_inputs) * pw;
+    const T     *data         = reinterpret_cast<const T *>(weights.data.data());
+    const float *scales       = weights.scales.empty() ? nullptr : weights.scales.data();
+
+    for(int panel = panel_start; panel < panel_end; ++panel)
+    {
+        const T    *w      = data + panel * panel_stride;
+        float32x4_t acc_lo = vdupq_n_f32(0.f);
+        float32x4_t acc_hi = vdupq_n_f32(0.f);
+        float32x4_t lo{};
+        float32x4_t hi{};
+
+        int k = 0;
+        for(; k <= num_inputs - 4; k += 4, w += 4 * pw)
+        {
+            prefetch_panel(w);
+
+            const float32x4_t x     = vld1q_f32(input + k);
+            const float32x2_t x_low = vget_low_f32(x);
+            const float32x2_t x_hig = vget_high_f32(x);
+
+            load_panel(w, lo, hi);
+            acc_lo = vmlaq_lane_f32(acc_lo, lo, x_low, 0);
+            acc_hi = vmlaq_lane_f32(acc_hi, hi, x_low, 0);
+            load_panel(w + pw, lo, hi);
+            acc_lo = vmlaq_lane_f32(acc_lo, lo, x_low, 1);
+            acc_hi = vmlaq_lane_f32(acc_hi, hi, x_low, 1);
+            load_panel(w + 2 * pw, lo, hi);
+            acc_lo = vmlaq_lane_f32(acc_lo, lo, x_hig, 0);
+            acc_hi = vmlaq_lane_f32(acc_hi, hi, x_hig, 0);
+            load_panel(w + 3 * pw, lo, hi);
+            acc_lo = vmlaq_lane_f32(acc_lo, lo, x_hig, 1);
+            acc_hi = vmlaq_lane_f32(acc_hi, hi, x_hig, 1);
+        }
+        for(; k < num_inputs; ++k, w += pw)
+        {
+            load_panel(w, lo, hi);
+            acc_lo = vmlaq_n_f32(acc_lo, lo, input[k]);
+            acc_hi = vmlaq_n_f32(acc_hi, hi, input[k]);
+        }
+
+        const int row = panel * pw;
+        if(scales != nullptr)
+        {
+            acc_lo = vmulq_f32(acc_lo, vld1q_f32(scales + row));
+            acc_hi = vmulq_f32(acc_hi, vld1q_f32(scales + row + 4));
+        }
+
+        if(row + pw <= num_outputs)
+        {
+            if(biases != nullptr)
+            {
+                acc_lo = vaddq_f32(acc_lo, vld1q_f32(biases + row));
+                acc_hi = vaddq_f32(acc_hi, vld1q_f32(biases + row + 4));
+            }
+            vst1q_f32(output + row, acc_lo);
+            vst1q_f32(output + row + 4, acc_hi);
+        }
+        else
+        {
+            // Last panel, padded past the last output
+            std::array<float, pw> tail{ {} };
+            vst1q_f32(tail.data(), acc_lo);
+            vst1q_f32(tail.data() + 4, acc_hi);
+            for(int r = row; r < num_outputs; ++r)
+            {
+                output[r] = tail[r - row] + ((biases != nullptr) ? biases[r] : 0.f);
+            }
+        }
+    }
+}
+} // namespace
+
+NEGEMVKernel::NEGEMVKernel()
+    : _input(nullptr), _weights(nullptr), _biases(nullptr), _output(nullptr), _weights_type(DataType::F32)
+{
+}
+
+void NEGEMVKernel::configure(const ITensor *input, const GEMVPackedWeights *weights, const ITensor *biases, ITensor *output, DataType weights_type)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), weights_type));
+
+    _input        = input;
+    _weights      = weights;
+    _biases       = biases;
+    _output       = output;
+    _weights_type = weights_type;
+
+    // One window step per panel of outputs
+    const unsigned int num_panels = ceil_to_multiple(output->info()->dimension(0), GEMVPackedWeights::panel_width) / GEMVPackedWeights::panel_width;
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_panels, 1));
+    INEKernel::configure(win);
+}
+
+Status NEGEMVKernel::validate(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, DataType weights_type)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, biases, output, weights_type));
+    return Status{};
+}
+
+void NEGEMVKernel::pack_weights(const ITensor *weights, DataType weights_type, GEMVPackedWeights &packed)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+
+    constexpr unsigned int pw = GEMVPackedWeights::panel_width;
+
+    const unsigned int rows       = weights->info()->dimension(0);
+    const unsigned int cols       = weights->info()->dimension(1);
+    const unsigned int num_panels = ceil_to_multiple(rows, pw) / pw;
+
+    packed.rows      = rows;
+    packed.cols      = cols;
+    packed.data_type = weights_type;
+    packed.data.assign(static_cast<size_t>(num_panels) * pw * cols * element_size_from_data_type(weights_type), 0);
+    packed.scales.clear();
+
+    // The weights of one input are contiguous across the outputs
+    const auto input_row = [&](unsigned int col)
+    {
+        return reinterpret_cast<const float *>(weights->ptr_to_element(Coordinates(0, col)));
+    };
+    const auto packed_index = [&](unsigned int row, unsigned int col)
+    {
+        return (static_cast<size_t>(row / pw) * cols + col) * pw + row % pw;
+    };
+
+    switch(weights_type)
+    {
+        case DataType::F32:
+        {
+            auto *dst = reinterpret_cast<float *>(packed.data.data());
+            for(unsigned int col = 0; col < cols; ++col)
+            {
+                const float *src = input_row(col);
+                for(unsigned int row = 0; row < rows; ++row)
+                {
+                    dst[packed_index(row, col)] = src[row];
+                }
+            }
+            break;
+        }
+        case DataType::F16:
+        {
+            auto *dst = reinterpret_cast<half *>(packed.data.data());
+            for(unsigned int col = 0; col < cols; ++col)
+            {
+                const float *src = input_row(col);
+                for(unsigned int row = 0; row < rows; ++row)
+                {
+                    dst[packed_index(row, col)] = static_cast<half>(src[row]);
+                }
+            }
+            break;
+        }
+        case DataType::QSYMM8_PER_CHANNEL:
+        {
+            // Symmetric quantization, one scale per output mapping its largest weight to 127
+            std::vector<float> max_abs(rows, 0.f);
+            for(unsigned int col = 0; col < cols; ++col)
+            {
+                const float *src = input_row(col);
+                for(unsigned int row = 0; row < rows; ++row)
+                {
+                    max_abs[row] = std::max(max_abs[row], std::abs(src[row]));
+                }
+            }
+
+            packed.scales.assign(static_cast<size_t>(num_panels) * pw, 0.f);
+            for(unsigned int row = 0; row < rows; ++row)
+            {
+                packed.scales[row] = max_abs[row] / 127.f;
+            }
+
+            auto *dst = reinterpret_cast<int8_t *>(packed.data.data());
+            for(unsigned int col = 0; col < cols; ++col)
+            {
+                const float *src = input_row(col);
+                for(unsigned int row = 0; row < rows; ++row)
+                {
+                    const float scale = packed.scales[row];
+                    const float q     = (scale > 0.f) ? std::round(src[row] / scale) : 0.f;
+                    dst[packed_index(row, col)] = static_cast<int8_t>(utility::clamp<float>(q, -127.f, 127.f));
+                }
+            }
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Weights can only be stored in F32, F16 or QSYMM8_PER_CHANNEL");
+    }
+}
+
+void NEGEMVKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON_MSG(_weights->data.empty() || _weights->data_type != _weights_type, "Weights have not been packed");
+
+    const auto *input  = reinterpret_cast<const float *>(_input->buffer() + _input->info()->offset_first_element_in_bytes());
+    auto       *output = reinterpret_cast<float *>(_output->buffer() + _output->info()->offset_first_element_in_bytes());
+    const auto *biases = (_biases != nullptr) ? reinterpret_cast<const float *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    switch(_weights_type)
+    {
+#if defined(__aarch64__)
+        case DataType::F16:
+            gemv_panels<float16_t>(input, *_weights, biases, output, window.x().start(), window.x().end());
+            break;
+#endif /* defined(__aarch64__) */
+        case DataType::QSYMM8_PER_CHANNEL:
+            gemv_panels<int8_t>(input, *_weights, biases, output, window.x().start(), window.x().end());
+            break;
+        default:
+            gemv_panels<float>(input, *_weights, biases, output, window.x().start(), window.x().end());
+            break;
+    }
+}
+} // namespace arm_compute
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEGEMVKERNEL_H
+#define ARM_COMPUTE_NEGEMVKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Weights of a fully connected layer packed for @ref NEGEMVKernel
+ *
+ * The outputs are grouped in panels of @ref panel_width. A panel stores the weights of its outputs input after input,
+ * so computing a panel streams through one contiguous buffer. The weights are stored in F32, F16 or as symmetric
+ * 8-bit integers (QSYMM8_PER_CHANNEL) with one scale per output.
+ */
+struct GEMVPackedWeights
+{
+    static constexpr unsigned int panel_width = 8; /**< Outputs per panel */
+
+    unsigned int         rows{ 0 };                  /**< Number of rows, one per output */
+    unsigned int         cols{ 0 };                  /**< Number of columns, one per input */
+    DataType             data_type{ DataType::F32 }; /**< Data type the weights are stored in */
+    std::vector<uint8_t> data{};                     /**< Panels, zero-padded past the last output */
+    std::vector<float>   scales{};                   /**< Scale of each output (zero-padded like @ref data), QSYMM8_PER_CHANNEL only */
+};
+
+/** Neon kernel multiplying a single input vector by a @ref GEMVPackedWeights matrix
+ *
+ * Each window step computes one panel of outputs, so the outputs are split across as many threads as there are panels.
+ * Every weight is read exactly once, and the weights are prefetched ahead of the stream since the product is bound by memory bandwidth.
+ * F16 and 8-bit weights are widened to F32 in registers, halving or quartering the traffic with F32 arithmetic.
+ */
+class NEGEMVKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEGEMVKernel";
+    }
+    /** Default constructor */
+    NEGEMVKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMVKernel(const NEGEMVKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMVKernel &operator=(const NEGEMVKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMVKernel(NEGEMVKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMVKernel &operator=(NEGEMVKernel &&) = default;
+    /** Default destructor */
+    ~NEGEMVKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input        Input vector [num_inputs]. Data type supported: F32
+     * @param[in]  weights      Packed weights, with one row per output. It is only read when the kernel runs, so it can be packed after configuration
+     * @param[in]  biases       Biases [num_outputs]. Can be nullptr. Data type supported: Same as @p input
+     * @param[out] output       Output vector [num_outputs]. Data type supported: Same as @p input
+     * @param[in]  weights_type Data type @p weights are packed in. Data types supported: F32/F16/QSYMM8_PER_CHANNEL
+     */
+    void configure(const ITensor *input, const GEMVPackedWeights *weights, const ITensor *biases, ITensor *output, DataType weights_type);
+    /** Static function to check if given info will lead to a valid configuration of @ref NEGEMVKernel
+     *
+     * @param[in] input        Input vector info [num_inputs]. Data type supported: F32
+     * @param[in] biases       Biases info [num_outputs]. Can be nullptr. Data type supported: Same as @p input
+     * @param[in] output       Output vector info [num_outputs]. Data type supported: Same as @p input
+     * @param[in] weights_type Data type the weights are packed in. Data types supported: F32/F16 (AArch64 only)/QSYMM8_PER_CHANNEL
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, DataType weights_type);
+    /** Packs the weights of a fully connected layer into a @ref GEMVPackedWeights
+     *
+     * @param[in]  weights      Weights [num_outputs, num_inputs], as consumed by a GEMM. Data type supported: F32
+     * @param[in]  weights_type Data type to store the weights in. Data types supported: F32/F16/QSYMM8_PER_CHANNEL
+     * @param[out] packed       Packed weights
+     */
+    static void pack_weights(const ITensor *weights, DataType weights_type, GEMVPackedWeights &packed);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor           *_input;
+    const GEMVPackedWeights *_weights;
+    const ITensor           *_biases;
+    ITensor                 *_output;
+    DataType                 _weights_type;
+};
+} // namespace arm_compute
+#endif /*ARM_COMPUTE_NEGEMVKERNEL_H */
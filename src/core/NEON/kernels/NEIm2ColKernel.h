@@ -85,7 +85,8 @@ public:
      * @param[in]  conv_info   Contains padding and stride information described in @ref PadStrideInfo.
      * @param[in]  has_bias    In case biases are provided expands the matrix with 1.
      * @param[in]  dilation    (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
-     * @param[in]  num_groups  (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups  (Optional) Number of groups when performing a grouped convolution. With num_groups > 1 the output is
+     *                         [IFM / num_groups * kernel_area, num_elems_per_out_channel, num_groups, batches].
      */
     void configure(const ITensor *input, ITensor *output, const Size2D &kernel_dims, const PadStrideInfo &conv_info,
                    bool has_bias, const Size2D &dilation = Size2D(1U, 1U), unsigned int num_groups = 1);
@@ -100,7 +101,8 @@ public:
      * @param[in] conv_info   Contains padding and stride information described in @ref PadStrideInfo.
      * @param[in] has_bias    In case biases are provided expands the matrix with 1.
      * @param[in] dilation    (Optional) Dilation, in elements, across x and y. Defaults to (1, 1).
-     * @param[in] num_groups  (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in] num_groups  (Optional) Number of groups when performing a grouped convolution. With num_groups > 1 the output is
+     *                        [IFM / num_groups * kernel_area, num_elems_per_out_channel, num_groups, batches].
      *
      * @return a status
      */
@@ -134,6 +136,7 @@ private:
     bool          _has_bias;
     Size2D        _dilation;
     DataLayout    _data_layout;
+    unsigned int  _num_groups;
 };
 } // namespace arm_compute
 #endif /*ARM_COMPUTE_NEIM2COLKERNEL_H */
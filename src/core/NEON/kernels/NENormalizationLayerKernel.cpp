@@ -44,12 +44,21 @@ namespace
 {
 Status validate_arguments(const ITensorInfo *input, const ITensorInfo *input_squared, const ITensorInfo *output, const NormalizationLayerInfo &norm_info)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, input_squared, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
 
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, input_squared);
-    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, input_squared);
+    if(input_squared != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, input_squared);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_SHAPES(input, input_squared);
+    }
+    else
+    {
+        // Squares are computed on the fly from the input, which must not be overwritten while it is read
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(norm_info.type() != NormType::CROSS_MAP, "Fused squaring is only supported for CROSS_MAP normalization");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(input == output, "Fused squaring does not support in-place computation");
+    }
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(norm_info.norm_size() % 2), "Normalization size should be odd");
 
     // Checks performed when output is configured
@@ -63,6 +72,27 @@ Status validate_arguments(const ITensorInfo *input, const ITensorInfo *input_squ
     return Status{};
 }
 
+inline float32x4_t load_as_f32(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+inline void store_from_f32(float *ptr, const float32x4_t &value)
+{
+    vst1q_f32(ptr, value);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+inline float32x4_t load_as_f32(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+inline void store_from_f32(float16_t *ptr, const float32x4_t &value)
+{
+    vst1_f16(ptr, vcvt_f16_f32(value));
+}
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 } // namespace
 
 NENormalizationLayerKernel::NENormalizationLayerKernel()
@@ -72,12 +102,12 @@ NENormalizationLayerKernel::NENormalizationLayerKernel()
 
 void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *input_squared, ITensor *output, NormalizationLayerInfo norm_info)
 {
-    ARM_COMPUTE_ERROR_ON_NULLPTR(input, input_squared, output);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
     // Output tensor auto initialization if not yet initialized
     auto_init_if_empty(*output->info(), *input->info());
 
     // Perform validation step
-    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), input_squared->info(), output->info(), norm_info));
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (input_squared != nullptr) ? input_squared->info() : nullptr, output->info(), norm_info));
 
     const unsigned int norm_idx = get_normalization_dimension_index(input->info()->data_layout(), norm_info);
 
@@ -86,84 +116,109 @@ void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *
     _output        = output;
     _norm_info     = norm_info;
 
-    switch(_input->info()->data_type())
+    // Configure kernel window
+    Window win = calculate_max_window(*input->info(), Steps());
+
+    if(input_squared == nullptr)
+    {
+        switch(_input->info()->data_type())
+        {
+            case DataType::F32:
+                _func = &NENormalizationLayerKernel::normalize_cross_map_fused<float>;
+                break;
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+            case DataType::F16:
+                _func = &NENormalizationLayerKernel::normalize_cross_map_fused<float16_t>;
+                break;
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+            default:
+                ARM_COMPUTE_ERROR("NOT SUPPORTED!");
+        }
+        // Each NCHW window item walks the whole channel axis with a running window
+        if(norm_idx == 2)
+        {
+            win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+        }
+    }
+    else
     {
-        case DataType::F32:
+        switch(_input->info()->data_type())
         {
-            switch(norm_idx)
+            case DataType::F32:
             {
-                case 0:
+                switch(norm_idx)
                 {
-                    if(norm_info.type() == NormType::IN_MAP_2D)
+                    case 0:
                     {
-                        _func = &NENormalizationLayerKernel::normalize_float<float, 4, 0, true>;
+                        if(norm_info.type() == NormType::IN_MAP_2D)
+                        {
+                            _func = &NENormalizationLayerKernel::normalize_float<float, 4, 0, true>;
+                        }
+                        else
+                        {
+                            _func = &NENormalizationLayerKernel::normalize_float<float, 4, 0, false>;
+                        }
+                        break;
                     }
-                    else
-                    {
-                        _func = &NENormalizationLayerKernel::normalize_float<float, 4, 0, false>;
-                    }
-                    break;
+                    case 1:
+                        if(norm_info.type() == NormType::IN_MAP_2D)
+                        {
+                            _func = &NENormalizationLayerKernel::normalize_float<float, 4, 1, true>;
+                        }
+                        else
+                        {
+                            _func = &NENormalizationLayerKernel::normalize_float<float, 4, 1, false>;
+                        }
+                        break;
+                    case 2:
+                        _func = &NENormalizationLayerKernel::normalize_float<float, 4, 2, false>;
+                        break;
+                    default:
+                        break;
                 }
-                case 1:
-                    if(norm_info.type() == NormType::IN_MAP_2D)
-                    {
-                        _func = &NENormalizationLayerKernel::normalize_float<float, 4, 1, true>;
-                    }
-                    else
-                    {
-                        _func = &NENormalizationLayerKernel::normalize_float<float, 4, 1, false>;
-                    }
-                    break;
-                case 2:
-                    _func = &NENormalizationLayerKernel::normalize_float<float, 4, 2, false>;
-                    break;
-                default:
-                    break;
+                break;
             }
-            break;
-        }
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
-        case DataType::F16:
-        {
-            switch(norm_idx)
+            case DataType::F16:
             {
-                case 0:
+                switch(norm_idx)
                 {
-                    if(norm_info.type() == NormType::IN_MAP_2D)
+                    case 0:
                     {
-                        _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 0, true>;
+                        if(norm_info.type() == NormType::IN_MAP_2D)
+                        {
+                            _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 0, true>;
+                        }
+                        else
+                        {
+                            _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 0, false>;
+                        }
+                        break;
                     }
-                    else
-                    {
-                        _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 0, false>;
-                    }
-                    break;
+                    case 1:
+                        if(norm_info.type() == NormType::IN_MAP_2D)
+                        {
+                            _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 1, true>;
+                        }
+                        else
+                        {
+                            _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 1, false>;
+                        }
+                        break;
+                    case 2:
+                        _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 2, false>;
+                        break;
+                    default:
+                        break;
                 }
-                case 1:
-                    if(norm_info.type() == NormType::IN_MAP_2D)
-                    {
-                        _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 1, true>;
-                    }
-                    else
-                    {
-                        _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 1, false>;
-                    }
-                    break;
-                case 2:
-                    _func = &NENormalizationLayerKernel::normalize_float<float16_t, 8, 2, false>;
-                    break;
-                default:
-                    break;
+                break;
             }
-            break;
-        }
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
-        default:
-            ARM_COMPUTE_ERROR("NOT SUPPORTED!");
+            default:
+                ARM_COMPUTE_ERROR("NOT SUPPORTED!");
+        }
     }
 
-    // Configure kernel window
-    Window      win = calculate_max_window(*input->info(), Steps());
     Coordinates coord;
     coord.set_num_dimensions(output->info()->num_dimensions());
     output->info()->set_valid_region(ValidRegion(coord, output->info()->tensor_shape()));
@@ -278,6 +333,156 @@ void NENormalizationLayerKernel::normalize_float(const Window &window)
     input, input_squared, output);
 }
 
+template <typename T>
+void NENormalizationLayerKernel::normalize_cross_map_fused(const Window &window)
+{
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    const auto window_start_x = static_cast<int>(window.x().start());
+    const auto window_end_x   = static_cast<int>(window.x().end());
+    const int  window_step_x  = 4;
+
+    Iterator input(_input, win);
+    Iterator output(_output, win);
+
+    const bool  is_nchw      = _input->info()->data_layout() == DataLayout::NCHW;
+    const int   radius       = _norm_info.norm_size() / 2;
+    const int   num_channels = _input->info()->dimension(get_data_layout_dimension_index(_input->info()->data_layout(), DataLayoutDimension::CHANNEL));
+    const float coeff        = _norm_info.scale_coeff();
+    const float beta         = _norm_info.beta();
+    const float kappa        = _norm_info.kappa();
+
+    const float32x4_t coeff_vec = vdupq_n_f32(coeff);
+    const float32x4_t beta_vec  = vdupq_n_f32(beta);
+    const float32x4_t kappa_vec = vdupq_n_f32(kappa);
+
+    // Squares and sums are kept in F32 for both data types, F16 only being used for loads and stores
+    if(is_nchw)
+    {
+        const int input_stride_c  = _input->info()->strides_in_bytes()[2];
+        const int output_stride_c = _output->info()->strides_in_bytes()[2];
+        const int last_first      = std::min(radius, num_channels - 1);
+
+        execute_window_loop(win, [&](const Coordinates &)
+        {
+            int x = window_start_x;
+            for(; x <= window_end_x - window_step_x; x += window_step_x)
+            {
+                const uint8_t *input_ptr  = input.ptr() + x * sizeof(T);
+                uint8_t       *output_ptr = output.ptr() + x * sizeof(T);
+
+                auto load_square = [&](int c)
+                {
+                    const float32x4_t value = load_as_f32(reinterpret_cast<const T *>(input_ptr + c * input_stride_c));
+                    return vmulq_f32(value, value);
+                };
+
+                float32x4_t accu = vdupq_n_f32(0.f);
+                for(int c = 0; c <= last_first; ++c)
+                {
+                    accu = vaddq_f32(accu, load_square(c));
+                }
+                for(int c = 0; c < num_channels; ++c)
+                {
+                    const float32x4_t value      = load_as_f32(reinterpret_cast<const T *>(input_ptr + c * input_stride_c));
+                    const float32x4_t normalized = vpowq_f32(vmlaq_f32(kappa_vec, coeff_vec, accu), beta_vec);
+                    store_from_f32(reinterpret_cast<T *>(output_ptr + c * output_stride_c), vmulq_f32(value, vinvq_f32(normalized)));
+
+                    // Slide the window to the next channel
+                    if(c + radius + 1 < num_channels)
+                    {
+                        accu = vaddq_f32(accu, load_square(c + radius + 1));
+                    }
+                    if(c - radius >= 0)
+                    {
+                        accu = vsubq_f32(accu, load_square(c - radius));
+                    }
+                }
+            }
+
+            // Compute left-over elements
+            for(; x < window_end_x; ++x)
+            {
+                const uint8_t *input_ptr  = input.ptr() + x * sizeof(T);
+                uint8_t       *output_ptr = output.ptr() + x * sizeof(T);
+
+                auto load_square = [&](int c)
+                {
+                    const float value = *reinterpret_cast<const T *>(input_ptr + c * input_stride_c);
+                    return value * value;
+                };
+
+                float accu = 0.f;
+                for(int c = 0; c <= last_first; ++c)
+                {
+                    accu += load_square(c);
+                }
+                for(int c = 0; c < num_channels; ++c)
+                {
+                    const float value = *reinterpret_cast<const T *>(input_ptr + c * input_stride_c);
+                    *reinterpret_cast<T *>(output_ptr + c * output_stride_c) = static_cast<T>(value / std::pow(kappa + coeff * accu, beta));
+
+                    if(c + radius + 1 < num_channels)
+                    {
+                        accu += load_square(c + radius + 1);
+                    }
+                    if(c - radius >= 0)
+                    {
+                        accu -= load_square(c - radius);
+                    }
+                }
+            }
+        },
+        input, output);
+    }
+    else
+    {
+        // NHWC: channels are contiguous, so each vector of channels sums its neighbouring vectors straight from the input
+        auto sequential_normalization = [&](const T * input_ptr, T * output_ptr, int c)
+        {
+            const int first_slice = std::max(c - radius, 0);
+            const int last_slice  = std::min(c + radius, num_channels - 1);
+
+            float accu = 0.f;
+            for(int i = first_slice; i <= last_slice; ++i)
+            {
+                const float value = input_ptr[i];
+                accu += value * value;
+            }
+            output_ptr[c] = static_cast<T>(static_cast<float>(input_ptr[c]) / std::pow(kappa + coeff * accu, beta));
+        };
+
+        execute_window_loop(win, [&](const Coordinates &)
+        {
+            const auto input_ptr  = reinterpret_cast<const T *>(input.ptr());
+            const auto output_ptr = reinterpret_cast<T *>(output.ptr());
+
+            int c = window_start_x;
+            for(; c < radius && c < window_end_x; ++c)
+            {
+                sequential_normalization(input_ptr, output_ptr, c);
+            }
+            for(; c <= std::min(window_end_x, num_channels - radius) - window_step_x; c += window_step_x)
+            {
+                float32x4_t accu = vdupq_n_f32(0.f);
+                for(int i = -radius; i <= radius; ++i)
+                {
+                    const float32x4_t value = load_as_f32(input_ptr + c + i);
+                    accu                    = vmlaq_f32(accu, value, value);
+                }
+                const float32x4_t normalized = vpowq_f32(vmlaq_f32(kappa_vec, coeff_vec, accu), beta_vec);
+                store_from_f32(output_ptr + c, vmulq_f32(load_as_f32(input_ptr + c), vinvq_f32(normalized)));
+            }
+            for(; c < window_end_x; ++c)
+            {
+                sequential_normalization(input_ptr, output_ptr, c);
+            }
+        },
+        input, output);
+    }
+}
+
 Status NENormalizationLayerKernel::validate(const ITensorInfo *input, const ITensorInfo *input_squared, const ITensorInfo *output, const NormalizationLayerInfo norm_info)
 {
     ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, input_squared, output, norm_info));
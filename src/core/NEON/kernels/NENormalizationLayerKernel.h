@@ -57,6 +57,8 @@ public:
      *                           and an optional 4th dimension for batch of inputs. Data types supported: FP16/F32. Data layouts supported: NCHW/NHWC.
      * @param[in]  input_squared Source with each element has been squared. 3 lower dims represent a single input with dimensions [width, height, IFM],
      *                           Data type and layout supported: same as @p input.
+     *                           Can be nullptr for CROSS_MAP normalization, in which case the squares are computed on the fly
+     *                           and @p output must not alias @p input.
      * @param[out] output        Destination tensor. Output will have the same number of dimensions as input. Data type and layout supported: same as @p input.
      * @param[in]  norm_info     Normalization layer information like the normalization type, normalization size and other parameters.
      */
@@ -67,6 +69,8 @@ public:
      *                          and an optional 4th dimension for batch of inputs. Data types supported: FP16/F32. Data layouts supported: NCHW/NHWC.
      * @param[in] input_squared Source with each element has been squared. 3 lower dims represent a single input with dimensions [width, height, IFM],
      *                          Data type and layout supported: same as @p input.
+     *                          Can be nullptr for CROSS_MAP normalization, in which case the squares are computed on the fly
+     *                          and @p output must not alias @p input.
      * @param[in] output        Destination tensor. Output will have the same number of dimensions as input. Data type and layout supported: same as @p input.
      * @param[in] norm_info     Normalization layer information like the normalization type, normalization size and other parameters.
      *
@@ -90,6 +94,15 @@ private:
      */
     template <typename T, unsigned int S, unsigned int dim, bool do_2D_norm>
     void normalize_float(const Window &window);
+    /** Function to perform CROSS_MAP normalization squaring the input on the fly
+     *
+     * NCHW keeps a running sum of squares while walking the channel axis, NHWC sums the
+     * neighbouring channels of each contiguous vector of channels. Both accumulate in F32.
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void normalize_cross_map_fused(const Window &window);
 
     /** Common signature for all the specialised normalization functions
      *
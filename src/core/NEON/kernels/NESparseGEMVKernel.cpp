@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NESparseGEMVKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+#include <array>
+
+namespace arm_compute
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, unsigned int block_height)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(block_height != 1 && block_height != 4, "Only blocks of 1x4 and 4x4 weights are supported");
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(output->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(1) != output->dimension(1));
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != output->dimension(0));
+    }
+
+    return Status{};
+}
+
+inline float horizontal_add(float32x4_t v)
+{
+    const float32x2_t sum = vadd_f32(vget_high_f32(v), vget_low_f32(v));
+    return vget_lane_f32(vpadd_f32(sum, sum), 0);
+}
+
+/** Loads the inputs of a block, zero-filling past the last input */
+inline float32x4_t load_block_input(const float *input, int column, int num_inputs)
+{
+    if(column + static_cast<int>(BlockSparseMatrix::block_width) <= num_inputs)
+    {
+        return vld1q_f32(input + column);
+    }
+    std::array<float, BlockSparseMatrix::block_width> tail{ {} };
+    for(int c = column; c < num_inputs; ++c)
+    {
+        tail[c - column] = input[c];
+    }
+    return vld1q_f32(tail.data());
+}
+
+/** Computes one block row of weights for @p NB inputs */
+template <unsigned int R, unsigned int NB>
+void compute_block_row(const BlockSparseMatrix &weights, int block_row, const std::array<const float *, 4> &inputs, const std::array<float *, 4> &outputs, const float *biases)
+{
+    float32x4_t acc[NB][R];
+    for(unsigned int b = 0; b < NB; ++b)
+    {
+        for(unsigned int r = 0; r < R; ++r)
+        {
+            acc[b][r] = vdupq_n_f32(0.f);
+        }
+    }
+
+    const int    num_inputs = static_cast<int>(weights.cols);
+    const float *values     = weights.values.data();
+    for(int blk = weights.row_offsets[block_row]; blk < weights.row_offsets[block_row + 1]; ++blk)
+    {
+        const int    column = weights.columns[blk];
+        const float *w      = values + static_cast<size_t>(blk) * R * BlockSparseMatrix::block_width;
+
+        float32x4_t wv[R];
+        for(unsigned int r = 0; r < R; ++r)
+        {
+            wv[r] = vld1q_f32(w + r * BlockSparseMatrix::block_width);
+        }
+        for(unsigned int b = 0; b < NB; ++b)
+        {
+            const float32x4_t x = load_block_input(inputs[b], column, num_inputs);
+            for(unsigned int r = 0; r < R; ++r)
+            {
+                acc[b][r] = vmlaq_f32(acc[b][r], wv[r], x);
+            }
+        }
+    }
+
+    for(unsigned int r = 0; r < R; ++r)
+    {
+        const unsigned int row = block_row * R + r;
+        if(row >= weights.rows)
+        {
+            break;
+        }
+        const float bias = (biases != nullptr) ? biases[row] : 0.f;
+        for(unsigned int b = 0; b < NB; ++b)
+        {
+            outputs[b][row] = horizontal_add(acc[b][r]) + bias;
+        }
+    }
+}
+
+template <unsigned int R>
+void sparse_gemv(const ITensor *input, const BlockSparseMatrix &weights, const ITensor *biases, ITensor *output, const Window &window)
+{
+    const int block_row_start = window.x().start();
+    const int block_row_end   = window.x().end();
+    const int batch_start     = window.y().start();
+    const int batch_end       = window.y().end();
+
+    const size_t in_stride  = input->info()->strides_in_bytes()[1];
+    const size_t out_stride = output->info()->strides_in_bytes()[1];
+    uint8_t     *in_base    = input->buffer() + input->info()->offset_first_element_in_bytes();
+    uint8_t     *out_base   = output->buffer() + output->info()->offset_first_element_in_bytes();
+    const float *bias_ptr   = (biases != nullptr) ? reinterpret_cast<const float *>(biases->buffer() + biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    std::array<const float *, 4> inputs{ {} };
+    std::array<float *, 4>       outputs{ {} };
+
+    int batch = batch_start;
+    for(; batch <= batch_end - 4; batch += 4)
+    {
+        for(int b = 0; b < 4; ++b)
+        {
+            inputs[b]  = reinterpret_cast<const float *>(in_base + (batch + b) * in_stride);
+            outputs[b] = reinterpret_cast<float *>(out_base + (batch + b) * out_stride);
+        }
+        for(int block_row = block_row_start; block_row < block_row_end; ++block_row)
+        {
+            compute_block_row<R, 4>(weights, block_row, inputs, outputs, bias_ptr);
+        }
+    }
+    for(; batch < batch_end; ++batch)
+    {
+        inputs[0]  = reinterpret_cast<const float *>(in_base + batch * in_stride);
+        outputs[0] = reinterpret_cast<float *>(out_base + batch * out_stride);
+        for(int block_row = block_row_start; block_row < block_row_end; ++block_row)
+        {
+            compute_block_row<R, 1>(weights, block_row, inputs, outputs, bias_ptr);
+        }
+    }
+}
+} // namespace
+
+NESparseGEMVKernel::NESparseGEMVKernel()
+    : _input(nullptr), _weights(nullptr), _biases(nullptr), _output(nullptr), _block_height(1)
+{
+}
+
+void NESparseGEMVKernel::configure(const ITensor *input, const BlockSparseMatrix *weights, const ITensor *biases, ITensor *output, unsigned int block_height)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), (biases != nullptr) ? biases->info() : nullptr, output->info(), block_height));
+
+    _input        = input;
+    _weights      = weights;
+    _biases       = biases;
+    _output       = output;
+    _block_height = block_height;
+
+    // One window step per block row on X, per input vector on Y
+    const unsigned int num_block_rows = ceil_to_multiple(output->info()->dimension(0), block_height) / block_height;
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_block_rows, 1));
+    win.set(Window::DimY, Window::Dimension(0, output->info()->dimension(1), 1));
+    INEKernel::configure(win);
+}
+
+Status NESparseGEMVKernel::validate(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, unsigned int block_height)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, biases, output, block_height));
+    return Status{};
+}
+
+void NESparseGEMVKernel::pack_weights(const ITensor *weights, bool weights_transposed, unsigned int block_height, BlockSparseMatrix &matrix)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(weights);
+    ARM_COMPUTE_ERROR_ON(block_height != 1 && block_height != 4);
+
+    const ITensorInfo *info = weights->info();
+    const unsigned int cols = weights_transposed ? info->dimension(1) : info->dimension(0);
+    const unsigned int rows = weights_transposed ? info->dimension(0) : info->dimension(1);
+
+    const auto weight = [&](unsigned int row, unsigned int col)
+    {
+        const Coordinates coords = weights_transposed ? Coordinates(row, col) : Coordinates(col, row);
+        return *reinterpret_cast<const float *>(weights->ptr_to_element(coords));
+    };
+
+    matrix.rows         = rows;
+    matrix.cols         = cols;
+    matrix.block_height = block_height;
+    matrix.row_offsets.assign(1, 0);
+    matrix.columns.clear();
+    matrix.values.clear();
+
+    std::array<float, 4 * BlockSparseMatrix::block_width> block{ {} };
+    for(unsigned int row = 0; row < rows; row += block_height)
+    {
+        for(unsigned int col = 0; col < cols; col += BlockSparseMatrix::block_width)
+        {
+            bool non_zero = false;
+            for(unsigned int r = 0; r < block_height; ++r)
+            {
+                for(unsigned int c = 0; c < BlockSparseMatrix::block_width; ++c)
+                {
+                    const float value                             = (row + r < rows && col + c < cols) ? weight(row + r, col + c) : 0.f;
+                    block[r * BlockSparseMatrix::block_width + c] = value;
+                    non_zero                                      = non_zero || value != 0.f;
+                }
+            }
+            if(non_zero)
+            {
+                matrix.columns.push_back(static_cast<int32_t>(col));
+                matrix.values.insert(matrix.values.end(), block.begin(), block.begin() + block_height * BlockSparseMatrix::block_width);
+            }
+        }
+        matrix.row_offsets.push_back(static_cast<int32_t>(matrix.columns.size()));
+    }
+    matrix.columns.shrink_to_fit();
+    matrix.values.shrink_to_fit();
+}
+
+void NESparseGEMVKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON_MSG(_weights->row_offsets.empty(), "Weights have not been packed");
+
+    if(_block_height == 4)
+    {
+        sparse_gemv<4>(_input, *_weights, _biases, _output, window);
+    }
+    else
+    {
+        sparse_gemv<1>(_input, *_weights, _biases, _output, window);
+    }
+}
+} // namespace arm_compute
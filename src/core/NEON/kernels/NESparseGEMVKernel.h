@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NESPARSEGEMVKERNEL_H
+#define ARM_COMPUTE_NESPARSEGEMVKERNEL_H
+
+#include "src/core/NEON/INEKernel.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+// Forward declarations
+class ITensor;
+
+/** Weights of a fully connected layer in block compressed sparse row (BSR) form
+ *
+ * The outputs (rows) are grouped by @ref block_height and the inputs (columns) by @ref block_width.
+ * Only the blocks holding at least one non-zero weight are stored.
+ */
+struct BlockSparseMatrix
+{
+    static constexpr unsigned int block_width = 4; /**< Columns per block */
+
+    unsigned int         rows{ 0 };         /**< Number of rows, one per output */
+    unsigned int         cols{ 0 };         /**< Number of columns, one per input */
+    unsigned int         block_height{ 1 }; /**< Rows per block, 1 or 4 */
+    std::vector<int32_t> row_offsets{};     /**< Index of the first block of each block row, plus the total number of blocks */
+    std::vector<int32_t> columns{};         /**< First column of each block */
+    std::vector<float>   values{};          /**< Weights of each block, row-major, zero-padded past the last row and column */
+
+    /** Ratio of the stored weights (zeros within stored blocks included) to the weights of the dense matrix
+     *
+     * Can slightly exceed 1 for a dense matrix whose dimensions are not multiples of the block size.
+     */
+    float density() const
+    {
+        return (rows == 0 || cols == 0) ? 0.f : static_cast<float>(values.size()) / (static_cast<float>(rows) * cols);
+    }
+};
+
+/** Neon kernel multiplying a batch of input vectors by a @ref BlockSparseMatrix
+ *
+ * Each thread computes a range of block rows for all the inputs. The inputs are processed four at a time,
+ * so the weights of a block are read once for four inputs.
+ */
+class NESparseGEMVKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NESparseGEMVKernel";
+    }
+    /** Default constructor */
+    NESparseGEMVKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseGEMVKernel(const NESparseGEMVKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESparseGEMVKernel &operator=(const NESparseGEMVKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NESparseGEMVKernel(NESparseGEMVKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NESparseGEMVKernel &operator=(NESparseGEMVKernel &&) = default;
+    /** Default destructor */
+    ~NESparseGEMVKernel() = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input        Input vectors [num_inputs, batches]. Data type supported: F32
+     * @param[in]  weights      Block sparse weights, with one row per output. It is only read when the kernel runs, so it can be packed after configuration
+     * @param[in]  biases       Biases [num_outputs]. Can be nullptr. Data type supported: Same as @p input
+     * @param[out] output       Output vectors [num_outputs, batches]. Data type supported: Same as @p input
+     * @param[in]  block_height Rows per block of @p weights, 1 or 4
+     */
+    void configure(const ITensor *input, const BlockSparseMatrix *weights, const ITensor *biases, ITensor *output, unsigned int block_height);
+    /** Static function to check if given info will lead to a valid configuration of @ref NESparseGEMVKernel
+     *
+     * @param[in] input        Input vectors info [num_inputs, batches]. Data type supported: F32
+     * @param[in] biases       Biases info [num_outputs]. Can be nullptr. Data type supported: Same as @p input
+     * @param[in] output       Output vectors info [num_outputs, batches]. Data type supported: Same as @p input
+     * @param[in] block_height Rows per block of the weights, 1 or 4
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *biases, const ITensorInfo *output, unsigned int block_height);
+    /** Packs dense (pruned) fully connected weights into a @ref BlockSparseMatrix
+     *
+     * @param[in]  weights            Dense weights. Data type supported: F32
+     * @param[in]  weights_transposed True if @p weights are [num_outputs, num_inputs], false if they are [num_inputs, num_outputs]
+     * @param[in]  block_height       Rows per block, 1 or 4
+     * @param[out] matrix             Packed weights
+     */
+    static void pack_weights(const ITensor *weights, bool weights_transposed, unsigned int block_height, BlockSparseMatrix &matrix);
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    const ITensor           *_input;
+    const BlockSparseMatrix *_weights;
+    const ITensor           *_biases;
+    ITensor                 *_output;
+    unsigned int             _block_height;
+};
+} // namespace arm_compute
+#endif /*ARM_COMPUTE_NESPARSEGEMVKERNEL_H */
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/ConvolutionMethodTable.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/Utility.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/TypePrinter.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+std::string shape_to_string(const TensorShape &shape)
+{
+    std::stringstream str;
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        str << (d == 0 ? "" : "x") << shape[d];
+    }
+    return str.str();
+}
+
+/** Parses a non-negative integer field, without throwing on malformed input */
+bool parse_int(const std::string &field, int &value)
+{
+    if(field.empty() || field.size() > 9 || field.find_first_not_of("0123456789") != std::string::npos)
+    {
+        return false;
+    }
+    value = std::atoi(field.c_str());
+    return true;
+}
+
+/** Parses a method name, without throwing on unknown names */
+bool parse_method(const std::string &field, ConvolutionMethod &method)
+{
+    static const std::map<std::string, ConvolutionMethod> methods =
+    {
+        { "default", ConvolutionMethod::Default },
+        { "direct", ConvolutionMethod::Direct },
+        { "gemm", ConvolutionMethod::GEMM },
+        { "winograd", ConvolutionMethod::Winograd },
+    };
+    const auto it = methods.find(arm_compute::utility::tolower(field));
+    if(it == methods.end())
+    {
+        return false;
+    }
+    method = it->second;
+    return true;
+}
+} // namespace
+
+ConvolutionMethodTable::ConvolutionMethodTable()
+    : _methods(), _filename(), _mtx()
+{
+}
+
+ConvolutionMethodTable &ConvolutionMethodTable::get()
+{
+    static ConvolutionMethodTable instance;
+    return instance;
+}
+
+void ConvolutionMethodTable::load(const std::string &filename)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    if(filename == _filename)
+    {
+        return;
+    }
+    _filename = filename;
+
+    std::ifstream file(filename);
+    unsigned int  line_number = 0;
+    for(std::string line; std::getline(file, line);)
+    {
+        ++line_number;
+        if(line.empty())
+        {
+            continue;
+        }
+        std::stringstream line_str(line);
+        std::string       cluster_field;
+        std::string       num_threads_field;
+        std::string       layer;
+        std::string       method_field;
+        int               cluster     = 0;
+        int               num_threads = 0;
+        ConvolutionMethod method      = ConvolutionMethod::Default;
+        // A truncated or hand-edited entry is skipped, it is measured again and appended if the layer is met
+        if(!std::getline(line_str, cluster_field, ';') || !std::getline(line_str, num_threads_field, ';') || !std::getline(line_str, layer, ';') || !std::getline(line_str, method_field)
+           || layer.empty() || !parse_int(cluster_field, cluster) || !parse_int(num_threads_field, num_threads) || !parse_method(method_field, method))
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Skipping malformed entry at line " << line_number << " of " << filename << std::endl);
+            continue;
+        }
+        _methods[std::make_tuple(layer, cluster, num_threads)] = method;
+    }
+    ARM_COMPUTE_LOG_GRAPH_INFO("Loaded " << _methods.size() << " convolution methods from " << filename << std::endl);
+}
+
+bool ConvolutionMethodTable::find(const std::string &layer, int cluster, int num_threads, ConvolutionMethod &method)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    const auto it = _methods.find(std::make_tuple(layer, cluster, num_threads));
+    if(it == _methods.end())
+    {
+        return false;
+    }
+    method = it->second;
+    return true;
+}
+
+void ConvolutionMethodTable::insert(const std::string &layer, int cluster, int num_threads, ConvolutionMethod method)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    _methods[std::make_tuple(layer, cluster, num_threads)] = method;
+    if(!_filename.empty())
+    {
+        std::ofstream file(_filename, std::ios::app);
+        file << cluster << ";" << num_threads << ";" << layer << ";" << method << std::endl;
+    }
+}
+
+std::string ConvolutionMethodTable::layer_key(const ITensorInfo &input, const ITensorInfo &weights, const PadStrideInfo &conv_info, const Size2D &dilation,
+                                              const ActivationLayerInfo &fused_act, bool fast_math)
+{
+    std::stringstream str;
+    str << string_from_data_type(input.data_type()) << "," << string_from_data_layout(input.data_layout())
+        << ",in" << shape_to_string(input.tensor_shape())
+        << ",w" << shape_to_string(weights.tensor_shape())
+        << ",s" << conv_info.stride().first << "x" << conv_info.stride().second
+        << ",p" << conv_info.pad_left() << "x" << conv_info.pad_right() << "x" << conv_info.pad_top() << "x" << conv_info.pad_bottom()
+        << ",d" << dilation.x() << "x" << dilation.y();
+    if(fused_act.enabled())
+    {
+        str << ",act_" << string_from_activation_func(fused_act.activation()) << "_" << fused_act.a() << "_" << fused_act.b();
+    }
+    str << (fast_math ? ",fast_math" : "");
+    return str.str();
+}
+} // namespace graph
+} // namespace arm_compute
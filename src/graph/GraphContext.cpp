@@ -26,6 +26,7 @@
 #include "arm_compute/graph.h"
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/detail/BranchExecutor.h"
 
 namespace arm_compute
 {
@@ -110,7 +111,8 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
 
 void GraphContext::finalize()
 {
-    const size_t num_pools = 1;
+    // Concurrent branches acquire the function memory from one pool each
+    const size_t num_pools = _config.parallel_branches ? detail::BranchExecutor::num_sub_pools : 1;
     for(auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
@@ -34,14 +34,18 @@
 
 #include "arm_compute/graph/GraphManager.h"
 
+#include "arm_compute/core/CPP/CPPTypes.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/PassManager.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/detail/BranchExecutor.h"
+#include "arm_compute/graph/detail/CalibrationHelpers.h"
 #include "arm_compute/graph/detail/CrossLayerMemoryManagerHelpers.h"
 #include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/graph/detail/WorkloadPMU.h"
 
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
 
@@ -107,6 +111,12 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Validate all nodes
     detail::validate_all_nodes(graph);
 
+    // Functions select their kernels (e.g. the arm_gemm variants and blocking) for the cluster the graph runs on, whichever core configures it
+    if(forced_target == Target::NEON && ctx.config().cluster < 2)
+    {
+        CPUInfo::set_thread_cpu(ctx.config().cluster == 1 ? ctx.config().total_cores - 1 : 0);
+    }
+
     // Configure all nodes
     auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
@@ -117,8 +127,33 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Allocate const tensors and call accessors
     detail::allocate_const_tensors(graph);
     detail::call_all_const_node_accessors(graph);
+    // Weights are recorded before the functions reshape and release them
+    if(ctx.config().calibrate)
+    {
+        detail::record_const_ranges(graph);
+    }
     // Prepare graph
     detail::prepare_all_tasks(workload);
+    CPUInfo::set_thread_cpu(-1);
+
+    // Report the function and the assembly kernels each layer ended up with
+    if(ctx.config().report_kernels)
+    {
+        std::cout << "Kernels of graph " << graph.id() << " (GEMM precision: " << (ctx.config().precision_policy == PrecisionPolicy::BF16 ? "BF16" : "F32") << ")" << std::endl;
+        for(auto &task : workload.tasks)
+        {
+            if(!task.task)
+            {
+                continue;
+            }
+            std::cout << task.node->name() << " \t " << task.node->type() << " \t ";
+            for(size_t i = 0; i < task.kernels.size(); ++i)
+            {
+                std::cout << (i > 0 ? ", " : "") << task.kernels[i];
+            }
+            std::cout << (task.kernels.empty() ? "-" : "") << std::endl;
+        }
+    }
 
     //Ehsan
     int ii=0;
@@ -129,7 +164,7 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     	if(!task.task)
     		continue;
     	bool b=false;
-    	if(blocking_set->find(ii) != blocking_set->end()){
+    	if(blocking_set!=NULL && blocking_set->find(ii) != blocking_set->end()){
     	      b=true;
     	      task.ending=true;
     	}
@@ -146,14 +181,53 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     	ii++;
     }
 
+    // Attach the hardware counters
+    if(ctx.config().pmu_counters)
+    {
+        workload.pmu = std::make_shared<detail::WorkloadPMU>();
+    }
+
+    // Attach the always-on sampled counters
+    if(ctx.config().kernel_counters > 0)
+    {
+        for(auto &task : workload.tasks)
+        {
+            if(task.task)
+            {
+                task.counters = std::make_unique<ExecutionTaskCounters>(ctx.config().kernel_counters);
+            }
+        }
+    }
+
 #if My_print > 0
     //Ehsan
         DotGraphPrinter p;
         p.print(graph,std::cout);
 #endif
 
-    // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if(ctx.config().use_transition_memory_manager)
+    // Attach the concurrent executor of independent branches
+    // Calibration records the outputs of the tasks right after they run, which needs them to run in sequence
+    if(ctx.config().parallel_branches && !ctx.config().calibrate && forced_target == Target::NEON)
+    {
+        if(detail::BranchExecutor::is_supported())
+        {
+            workload.branches = std::make_shared<detail::BranchExecutor>(ctx.config());
+            workload.branches->configure(workload);
+        }
+        else
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Not enough threads to run the branches of graph " << graph.id() << " concurrently, running them in sequence" << std::endl);
+        }
+    }
+
+    // Setup tensor memory (Allocate all tensors, plan the transition tensors or setup transition manager)
+    // Transition buffers are shared based on the sequential order of the tasks, which concurrent branches do not follow
+    if(ctx.config().static_memory_plan && workload.branches == nullptr)
+    {
+        detail::configure_static_transition_memory(graph, ctx, workload);
+        detail::allocate_all_tensors(graph);
+    }
+    else if(ctx.config().use_transition_memory_manager && workload.branches == nullptr)
     {
 #if My_print > 0
     	//Ehsan
@@ -194,7 +268,13 @@ void GraphManager::print_times(Graph &graph, int n)
 				<<" \t Layer time: "<<task.time(n)
 				<<" \t number of inputs: "<<task.node->num_inputs()
 				<<" \t input shape: "<<task.node->input(0)->desc().shape
-				<<" \t output shape: "<<task.node->output(0)->desc().shape<<std::endl;
+				<<" \t output shape: "<<task.node->output(0)->desc().shape;
+		if(task.pmu_counts.samples){
+			std::cout<<" \t IPC: "<<task.pmu_counts.ipc()
+					<<" \t cache MPKI: "<<task.pmu_counts.cache_mpki()
+					<<" \t branch MPKI: "<<task.pmu_counts.branch_mpki();
+		}
+		std::cout<<std::endl;
 
 		tt+=task.time(n);
 		if(task.ending){
@@ -217,6 +297,82 @@ void GraphManager::reset(Graph &graph)
 	}
 }
 
+std::vector<ExecutionTaskStats> GraphManager::task_stats(const Graph &graph) const
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    std::vector<ExecutionTaskStats> stats;
+    stats.reserve(it->second.tasks.size());
+    for(auto &task : it->second.tasks)
+    {
+        if(task.task)
+        {
+            stats.push_back(task.stats());
+        }
+    }
+    return stats;
+}
+
+void GraphManager::reset_task_stats(Graph &graph)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    for(auto &task : it->second.tasks)
+    {
+        if(task.counters != nullptr)
+        {
+            task.counters->reset();
+        }
+    }
+}
+
+std::vector<double> GraphManager::layer_times(Graph &graph, int n)
+{
+    auto it = _workloads.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
+
+    std::vector<double> times;
+    double              layer   = 0;
+    bool                timed   = false;
+    bool                pending = false;
+    for(auto &task : it->second.tasks)
+    {
+        if(!task.task)
+        {
+            continue;
+        }
+        if(task.t > 0)
+        {
+            layer += task.time(n);
+            timed = true;
+        }
+        else if(task.counters != nullptr)
+        {
+            const ExecutionTaskStats stats = task.stats();
+            layer += stats.mean / 1000.;
+            timed |= (stats.samples != 0);
+        }
+        pending = true;
+        if(task.ending)
+        {
+            times.push_back(layer);
+            layer   = 0;
+            pending = false;
+        }
+    }
+    if(pending)
+    {
+        times.push_back(layer);
+    }
+    if(!timed)
+    {
+        times.clear();
+    }
+    return times;
+}
+
 /*
 void GraphManager::execute_graph(Graph &graph)
 {
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/QuantizationTable.h"
+
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/Logger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace arm_compute
+{
+namespace graph
+{
+QuantizationInfo TensorRange::quantization_info() const
+{
+    const float low  = std::min(min, 0.f);
+    const float high = std::max(max, 0.f);
+    if(high - low <= std::numeric_limits<float>::epsilon())
+    {
+        return QuantizationInfo(1.f, 0);
+    }
+    const float scale  = (high - low) / 255.f;
+    const int   offset = static_cast<int>(std::round(-low / scale));
+    return QuantizationInfo(scale, std::max(0, std::min(255, offset)));
+}
+
+QuantizationTable::QuantizationTable()
+    : _ranges(), _filename(), _mtx()
+{
+}
+
+QuantizationTable &QuantizationTable::get()
+{
+    static QuantizationTable instance;
+    return instance;
+}
+
+bool QuantizationTable::load(const std::string &filename)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    if(filename == _filename)
+    {
+        return true;
+    }
+
+    std::ifstream file(filename);
+    if(!file.is_open())
+    {
+        return false;
+    }
+    _filename = filename;
+
+    for(std::string line; std::getline(file, line);)
+    {
+        std::stringstream line_str(line);
+        std::string       tensor;
+        std::string       min;
+        std::string       max;
+        if(std::getline(line_str, tensor, ';') && std::getline(line_str, min, ';') && std::getline(line_str, max))
+        {
+            TensorRange range;
+            range.min       = std::stof(min);
+            range.max       = std::stof(max);
+            _ranges[tensor] = range;
+        }
+    }
+    ARM_COMPUTE_LOG_GRAPH_INFO("Loaded the ranges of " << _ranges.size() << " tensors from " << filename << std::endl);
+    return true;
+}
+
+void QuantizationTable::save(const std::string &filename)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    std::ofstream file(filename);
+    file.precision(std::numeric_limits<float>::max_digits10);
+    for(const auto &entry : _ranges)
+    {
+        file << entry.first << ";" << entry.second.min << ";" << entry.second.max << std::endl;
+    }
+    ARM_COMPUTE_LOG_GRAPH_INFO("Saved the ranges of " << _ranges.size() << " tensors to " << filename << std::endl);
+}
+
+bool QuantizationTable::find(const std::string &tensor, TensorRange &range)
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    const auto it = _ranges.find(tensor);
+    if(tensor.empty() || it == _ranges.end())
+    {
+        return false;
+    }
+    range = it->second;
+    return true;
+}
+
+void QuantizationTable::record(const std::string &tensor, const TensorRange &range)
+{
+    if(tensor.empty())
+    {
+        return;
+    }
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_mtx);
+    auto it = _ranges.find(tensor);
+    if(it == _ranges.end())
+    {
+        _ranges[tensor] = range;
+    }
+    else
+    {
+        it->second.min = std::min(it->second.min, range.min);
+        it->second.max = std::max(it->second.max, range.max);
+    }
+}
+
+std::string QuantizationTable::tensor_key(const INode &node, size_t idx)
+{
+    if(node.name().empty())
+    {
+        return "";
+    }
+    return (idx == 0) ? node.name() : node.name() + ":" + std::to_string(idx);
+}
+} // namespace graph
+} // namespace arm_compute
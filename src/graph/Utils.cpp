@@ -81,11 +81,23 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
     const bool is_target_gc = target == Target::GC;
 
     // Passes that mutate graph IR
+    if(cfg.plan_layouts)
+    {
+        pm.append(std::make_unique<DataLayoutMutator>(), !is_target_gc);
+    }
     if(cfg.convert_to_uint8)
     {
-        pm.append(std::make_unique<SyntheticDataTypeMutator>(), !is_target_gc);
+        pm.append(std::make_unique<SyntheticDataTypeMutator>(cfg.quant_table_file), !is_target_gc);
+    }
+    // Calibration observes the output of every layer, so layers are not merged
+    if(!cfg.calibrate)
+    {
+        pm.append(std::make_unique<NodeFusionMutator>(cfg.use_conv_method_table), !is_target_gc);
+    }
+    if(cfg.tile_layers && !cfg.calibrate)
+    {
+        pm.append(std::make_unique<LayerTilingMutator>(), !is_target_gc);
     }
-    pm.append(std::make_unique<NodeFusionMutator>(), !is_target_gc);
     pm.append(std::make_unique<GroupedConvolutionMutator>());
     pm.append(std::make_unique<InPlaceOperationMutator>(), !is_target_gc);
 
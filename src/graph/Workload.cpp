@@ -31,6 +31,9 @@
 #include "arm_compute/runtime/CL/CLScheduler.h"
 //std::map<std::string,double> task_times;
 
+#include <algorithm>
+#include <thread>
+
 
 namespace arm_compute
 {
@@ -38,6 +41,14 @@ namespace graph
 {
 void ExecutionTask::operator()()
 {
+    if(counters != nullptr && counters->sample())
+    {
+        // No queue synchronization here: on asynchronous backends this only accounts the enqueue cost
+        const uint64_t start = read_timestamp_counter();
+        TaskExecutor::get().execute_function(*this);
+        counters->record(read_timestamp_counter() - start);
+        return;
+    }
     TaskExecutor::get().execute_function(*this);
 }
 
@@ -56,6 +67,85 @@ double ExecutionTask::time(int n){
 void ExecutionTask::reset(){
 	t=0;
 	n=0;
+	pmu_counts=ExecutionTaskPMUCounts();
+}
+
+ExecutionTaskStats ExecutionTask::stats() const
+{
+    ExecutionTaskStats stats;
+    if(node != nullptr)
+    {
+        stats.id   = node->id();
+        stats.name = node->name();
+    }
+    if(counters == nullptr)
+    {
+        return stats;
+    }
+
+    const double to_ms = 1000. / timestamp_counter_frequency();
+    stats.calls        = counters->calls.load(std::memory_order_relaxed);
+    stats.samples      = counters->samples.load(std::memory_order_relaxed);
+    if(stats.samples != 0)
+    {
+        stats.mean = to_ms * counters->total_ticks.load(std::memory_order_relaxed) / stats.samples;
+        stats.min  = to_ms * counters->min_ticks.load(std::memory_order_relaxed);
+        stats.max  = to_ms * counters->max_ticks.load(std::memory_order_relaxed);
+        stats.last = to_ms * counters->last_ticks.load(std::memory_order_relaxed);
+        stats.ewma = to_ms * counters->ewma_ticks.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void ExecutionTaskCounters::record(uint64_t ticks)
+{
+    // Single writer: plain load/store pairs are enough, atomics only make the reads from monitors well defined
+    const uint64_t n = samples.load(std::memory_order_relaxed);
+    const double   ewma = (n == 0) ? static_cast<double>(ticks) : ewma_ticks.load(std::memory_order_relaxed) + ewma_weight * (static_cast<double>(ticks) - ewma_ticks.load(std::memory_order_relaxed));
+    total_ticks.store(total_ticks.load(std::memory_order_relaxed) + ticks, std::memory_order_relaxed);
+    min_ticks.store(std::min(min_ticks.load(std::memory_order_relaxed), ticks), std::memory_order_relaxed);
+    max_ticks.store(std::max(max_ticks.load(std::memory_order_relaxed), ticks), std::memory_order_relaxed);
+    last_ticks.store(ticks, std::memory_order_relaxed);
+    ewma_ticks.store(ewma, std::memory_order_relaxed);
+    samples.store(n + 1, std::memory_order_relaxed);
+}
+
+void ExecutionTaskCounters::reset()
+{
+    countdown = 0;
+    calls.store(0, std::memory_order_relaxed);
+    samples.store(0, std::memory_order_relaxed);
+    total_ticks.store(0, std::memory_order_relaxed);
+    min_ticks.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+    max_ticks.store(0, std::memory_order_relaxed);
+    last_ticks.store(0, std::memory_order_relaxed);
+    ewma_ticks.store(0, std::memory_order_relaxed);
+}
+
+double timestamp_counter_frequency()
+{
+    static const double frequency = []()
+    {
+#if defined(__aarch64__)
+        uint64_t value;
+        __asm__ __volatile__("mrs %0, cntfrq_el0"
+                             : "=r"(value));
+        if(value != 0)
+        {
+            return static_cast<double>(value);
+        }
+#elif !defined(__arm__) && !defined(__x86_64__) && !defined(__i386__)
+        return 1e9;
+#endif
+        // Calibrate the counter against the steady clock
+        const auto     wall_start  = std::chrono::steady_clock::now();
+        const uint64_t ticks_start = read_timestamp_counter();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const uint64_t ticks_end = read_timestamp_counter();
+        const auto     wall_end  = std::chrono::steady_clock::now();
+        return (ticks_end - ticks_start) / std::chrono::duration_cast<std::chrono::duration<double>>(wall_end - wall_start).count();
+    }();
+    return frequency;
 }
 
 
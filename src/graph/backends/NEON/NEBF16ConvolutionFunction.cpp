@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/backends/NEON/NEBF16ConvolutionFunction.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace backends
+{
+namespace
+{
+TensorInfo bf16_info(const ITensorInfo &info)
+{
+    TensorInfo bf16(info.tensor_shape(), 1, DataType::BFLOAT16);
+    bf16.set_data_layout(info.data_layout());
+    return bf16;
+}
+} // namespace
+
+NEBF16ConvolutionFunction::NEBF16ConvolutionFunction(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(memory_manager), _input_convert(), _weights_convert(), _conv(memory_manager), _input_bf16(), _weights_bf16(), _original_weights(nullptr), _is_prepared(false)
+{
+}
+
+Status NEBF16ConvolutionFunction::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                           const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool fast_math, unsigned int num_groups)
+{
+    ARM_COMPUTE_UNUSED(fast_math);
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups != 1, "Grouping is not supported");
+
+    const TensorInfo input_bf16   = bf16_info(*input);
+    const TensorInfo weights_bf16 = bf16_info(*weights);
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthConvertLayer::validate(input, &input_bf16, ConvertPolicy::SATURATE));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEDepthConvertLayer::validate(weights, &weights_bf16, ConvertPolicy::SATURATE));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMConvolutionLayer::validate(&input_bf16, &weights_bf16, biases, output, conv_info, weights_info, dilation, act_info));
+    return Status{};
+}
+
+void NEBF16ConvolutionFunction::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
+                                          const Size2D &dilation, const ActivationLayerInfo &act_info, bool fast_math, unsigned int num_groups)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEBF16ConvolutionFunction::validate(input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), conv_info,
+                                                                   weights_info, dilation, act_info, fast_math, num_groups));
+
+    _original_weights = weights;
+    _is_prepared      = false;
+
+    _input_bf16.allocator()->init(bf16_info(*input->info()));
+    _weights_bf16.allocator()->init(bf16_info(*weights->info()));
+
+    _memory_group.manage(&_input_bf16);
+    _input_convert.configure(input, &_input_bf16, ConvertPolicy::SATURATE);
+    _weights_convert.configure(weights, &_weights_bf16, ConvertPolicy::SATURATE);
+    _conv.configure(&_input_bf16, &_weights_bf16, biases, output, conv_info, weights_info, dilation, act_info);
+    _input_bf16.allocator()->allocate();
+}
+
+void NEBF16ConvolutionFunction::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    _input_convert.run();
+    _conv.run();
+}
+
+void NEBF16ConvolutionFunction::prepare()
+{
+    if(!_is_prepared)
+    {
+        // Weights are converted once, the convolution then reshapes the converted copy
+        _weights_bf16.allocator()->allocate();
+        _weights_convert.run();
+        _original_weights->mark_as_unused();
+
+        _conv.prepare();
+        if(!_weights_bf16.is_used())
+        {
+            _weights_bf16.allocator()->free();
+        }
+        _is_prepared = true;
+    }
+}
+} // namespace backends
+} // namespace graph
+} // namespace arm_compute
@@ -28,6 +28,7 @@
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/backends/FunctionHelpers.h"
+#include "arm_compute/graph/backends/NEON/NEBF16ConvolutionFunction.h"
 #include "arm_compute/graph/backends/Utils.h"
 #include "arm_compute/graph/nodes/Nodes.h"
 #include "arm_compute/runtime/CPP/CPPFunctions.h"
@@ -78,16 +79,190 @@ struct NEUnaryEltwiseFunctions
     using Exp = NEExpLayer;
 };
 
-/** Function and tensor types to be used inside a Neon fused convolution/batch normalization layer */
+/** Function and tensor types to be used inside a Neon fused layer */
 struct NEFusedLayerTypes
 {
     using ConvolutionLayer          = NEConvolutionLayer;
+    using GEMMConvolutionLayer      = NEGEMMConvolutionLayer;
     using DepthwiseConvolutionLayer = NEDepthwiseConvolutionLayer;
     using FuseBatchNormalization    = NEFuseBatchNormalization;
+    using PadLayer                  = NEPadLayer;
+    using Addition                  = NEArithmeticAddition;
+    using ActivationLayer           = NEActivationLayer;
+    using PoolingLayer              = NEPoolingLayer;
+    using NormalizationLayer        = NENormalizationLayer;
+};
+
+/** Function types of a Neon fused convolution batch normalization layer computing its GEMM in BF16 */
+struct NEBF16FusedLayerTypes
+{
+    using ConvolutionLayer       = NEBF16ConvolutionFunction;
+    using FuseBatchNormalization = NEFuseBatchNormalization;
 };
 
 namespace detail
 {
+/** Checks if a convolution computes its GEMM in BF16
+ *
+ * @param[in] node Node of the convolution
+ * @param[in] ctx  Graph context
+ *
+ * @return True if the graph has the BF16 precision policy, the convolution is in F32 and it is named in @ref GraphConfig::bf16_layers (or no layer is named)
+ */
+bool is_bf16_layer(const INode &node, const GraphContext &ctx)
+{
+    if(ctx.config().precision_policy != PrecisionPolicy::BF16 || node.input(0) == nullptr || node.input(0)->desc().data_type != DataType::F32)
+    {
+        return false;
+    }
+    if(ctx.config().bf16_layers.empty())
+    {
+        return true;
+    }
+
+    std::stringstream names(ctx.config().bf16_layers);
+    for(std::string name; std::getline(names, name, ',');)
+    {
+        if(name == node.name())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Create a convolution layer function computing its GEMM in BF16
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return The BF16 convolution function, nullptr if the CPU, the build or the layer does not support it
+ */
+std::unique_ptr<IFunction> create_bf16_convolution_layer(ConvolutionLayerNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const ActivationLayerInfo fused_act = node.fused_activation();
+    if(!bool(NEBF16ConvolutionFunction::validate(input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), conv_info,
+                                                 WeightsInfo(), Size2D(1U, 1U), fused_act, false, node.num_groups())))
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO(node.name() << " cannot run in BF16, running it in F32" << std::endl);
+        return nullptr;
+    }
+
+    auto func = std::make_unique<NEBF16ConvolutionFunction>(get_memory_manager(ctx, NETargetInfo::TargetType));
+    func->configure(input, weights, biases, output, conv_info, WeightsInfo(), Size2D(1U, 1U), fused_act);
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: BF16ConvolutionLayer"
+                               << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << (fused_act.enabled() ? " " + to_string(fused_act.activation()) : "")
+                               << std::endl);
+    return std::move(func);
+}
+
+/** Create a fused convolution batch normalization layer function computing its GEMM in BF16
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return The BF16 fused function, nullptr if the CPU, the build or the layer does not support it
+ */
+std::unique_ptr<IFunction> create_bf16_fused_convolution_batch_normalization_layer(FusedConvolutionBatchNormalizationNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 7 /* expected inputs */, 1 /* expected outputs */);
+
+    NETargetInfo::TensorType *input   = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType *weights = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType *biases  = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType *output  = get_backing_tensor<NETargetInfo>(node.output(0));
+
+    // Batch normalization only changes the values of the weights and biases, so the convolution alone tells if BF16 is supported
+    if(!bool(NEBF16ConvolutionFunction::validate(input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), node.convolution_info(),
+                                                 WeightsInfo(), Size2D(1U, 1U), node.fused_activation(), false, node.num_groups())))
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO(node.name() << " cannot run in BF16, running it in F32" << std::endl);
+        return nullptr;
+    }
+    return create_fused_convolution_batch_normalization_layer<NEBF16FusedLayerTypes, NETargetInfo>(node, ctx);
+}
+
+/** Checks if a fully connected layer runs with block-sparse weights
+ *
+ * @param[in] node Node of the fully connected layer
+ * @param[in] ctx  Graph context
+ *
+ * @return True if the layer is in F32 and it is named in @ref GraphConfig::sparse_fc_layers
+ */
+bool is_sparse_fc_layer(const INode &node, const GraphContext &ctx)
+{
+    if(ctx.config().sparse_fc_layers.empty() || node.input(0) == nullptr || node.input(0)->desc().data_type != DataType::F32)
+    {
+        return false;
+    }
+
+    std::stringstream names(ctx.config().sparse_fc_layers);
+    for(std::string name; std::getline(names, name, ',');)
+    {
+        if(name == node.name())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** Create a fully connected layer function multiplying by its weights packed in blocks of non-zeros
+ *
+ * @param[in] node Node to create the backend function for
+ * @param[in] ctx  Graph context
+ *
+ * @return The sparse fully connected function, nullptr if the layer does not support it
+ */
+std::unique_ptr<IFunction> create_sparse_fully_connected_layer(FullyConnectedLayerNode &node, GraphContext &ctx)
+{
+    validate_node<NETargetInfo>(node, 3 /* expected inputs */, 1 /* expected outputs */);
+
+    NETargetInfo::TensorType     *input        = get_backing_tensor<NETargetInfo>(node.input(0));
+    NETargetInfo::TensorType     *weights      = get_backing_tensor<NETargetInfo>(node.input(1));
+    NETargetInfo::TensorType     *biases       = get_backing_tensor<NETargetInfo>(node.input(2));
+    NETargetInfo::TensorType     *output       = get_backing_tensor<NETargetInfo>(node.output(0));
+    const FullyConnectedLayerInfo fc_info      = node.info();
+    const unsigned int            block_height = ctx.config().sparse_block_height;
+
+    if(!bool(NESparseFullyConnectedLayer::validate(input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), fc_info, block_height)))
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO(node.name() << " cannot run with sparse weights, running it dense" << std::endl);
+        return nullptr;
+    }
+
+    auto func = std::make_unique<NESparseFullyConnectedLayer>(get_memory_manager(ctx, NETargetInfo::TargetType));
+    func->configure(input, weights, biases, output, fc_info, block_height);
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Instantiated "
+                               << node.name()
+                               << " Type: SparseFullyConnectedLayer"
+                               << " Target: " << NETargetInfo::TargetType
+                               << " Data Type: " << input->info()->data_type()
+                               << " Block: " << block_height << "x4"
+                               << " Input shape: " << input->info()->tensor_shape()
+                               << " Weights shape: " << weights->info()->tensor_shape()
+                               << " Output shape: " << output->info()->tensor_shape()
+                               << std::endl);
+    return std::move(func);
+}
+
 template <>
 std::unique_ptr<IFunction> create_normalization_layer<NENormalizationLayer, NETargetInfo>(NormalizationLayerNode &node, GraphContext &ctx)
 {
@@ -126,6 +301,8 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         return nullptr;
     }
 
+    detail::warn_fused_co_executed_layers(*node, ctx);
+
     NodeType type = node->type();
     //std::cerr<<"type of node:"<<node->name()<<" is "<<type<<std::endl;
     switch(type)
@@ -139,6 +316,18 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(*polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
+            if(detail::is_co_executed_layer(*node, ctx))
+            {
+                return detail::create_co_executed_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(*polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
+            }
+            if(detail::is_bf16_layer(*node, ctx))
+            {
+                auto func = detail::create_bf16_convolution_layer(*polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
+                if(func != nullptr)
+                {
+                    return func;
+                }
+            }
             return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(*polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
         case NodeType::DepthToSpaceLayer:
             return detail::create_depth_to_space_layer<NEDepthToSpaceLayer, NETargetInfo>(*polymorphic_downcast<DepthToSpaceLayerNode *>(node));
@@ -161,11 +350,37 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::FlattenLayer:
             return detail::create_flatten_layer<NEFlattenLayer, NETargetInfo>(*polymorphic_downcast<FlattenLayerNode *>(node));
         case NodeType::FullyConnectedLayer:
+            if(detail::is_co_executed_layer(*node, ctx))
+            {
+                return detail::create_co_executed_fully_connected_layer<NEFullyConnectedLayer, NETargetInfo>(*polymorphic_downcast<FullyConnectedLayerNode *>(node), ctx);
+            }
+            if(detail::is_sparse_fc_layer(*node, ctx))
+            {
+                auto func = detail::create_sparse_fully_connected_layer(*polymorphic_downcast<FullyConnectedLayerNode *>(node), ctx);
+                if(func != nullptr)
+                {
+                    return func;
+                }
+            }
             return detail::create_fully_connected_layer<NEFullyConnectedLayer, NETargetInfo>(*polymorphic_downcast<FullyConnectedLayerNode *>(node), ctx);
         case NodeType::FusedConvolutionBatchNormalizationLayer:
+            if(detail::is_bf16_layer(*node, ctx))
+            {
+                auto func = detail::create_bf16_fused_convolution_batch_normalization_layer(*polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node), ctx);
+                if(func != nullptr)
+                {
+                    return func;
+                }
+            }
             return detail::create_fused_convolution_batch_normalization_layer<NEFusedLayerTypes, NETargetInfo>(*polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::FusedConvolutionEltwiseLayer:
+            return detail::create_fused_convolution_eltwise_layer<NEFusedLayerTypes, NETargetInfo>(*polymorphic_downcast<FusedConvolutionEltwiseNode *>(node), ctx);
+        case NodeType::FusedConvolutionPoolingLayer:
+            return detail::create_fused_convolution_pooling_layer<NEFusedLayerTypes, NETargetInfo>(*polymorphic_downcast<FusedConvolutionPoolingNode *>(node), ctx);
         case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
             return detail::create_fused_depthwise_convolution_batch_normalization_layer<NEFusedLayerTypes, NETargetInfo>(*polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node), ctx);
+        case NodeType::FusedDepthwisePointwiseConvolutionLayer:
+            return detail::create_fused_depthwise_pointwise_convolution_layer<NEFusedLayerTypes, NETargetInfo>(*polymorphic_downcast<FusedDepthwisePointwiseConvolutionNode *>(node), ctx);
         case NodeType::L2NormalizeLayer:
             return detail::create_l2_normalize_layer<NEL2NormalizeLayer, NETargetInfo>(*polymorphic_downcast<L2NormalizeLayerNode *>(node), ctx);
         case NodeType::NormalizationLayer:
@@ -200,6 +415,8 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
             return detail::create_stack_layer<NEStackLayer, NETargetInfo>(*polymorphic_downcast<StackLayerNode *>(node));
         case NodeType::StridedSliceLayer:
             return detail::create_strided_slice_layer<NEStridedSlice, NETargetInfo>(*polymorphic_downcast<StridedSliceLayerNode *>(node));
+        case NodeType::TiledLayerChain:
+            return detail::create_tiled_layer_chain<NEFusedLayerTypes, NETargetInfo>(*polymorphic_downcast<TiledLayerChainNode *>(node), ctx);
         default:
             return nullptr;
     }
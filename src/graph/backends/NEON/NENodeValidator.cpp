@@ -86,6 +86,10 @@ Status NENodeValidator::validate(INode *node)
                    NEDirectConvolutionLayer,
                    NEGEMMConvolutionLayer,
                    NEWinogradConvolutionLayer>(*polymorphic_downcast<ConvolutionLayerNode *>(node));
+        case NodeType::FusedConvolutionEltwiseLayer:
+            return detail::validate_fused_convolution_eltwise_layer<NEGEMMConvolutionLayer, NEArithmeticAddition, NEActivationLayer>(*polymorphic_downcast<FusedConvolutionEltwiseNode *>(node));
+        case NodeType::FusedConvolutionPoolingLayer:
+            return detail::validate_fused_convolution_pooling_layer<NEGEMMConvolutionLayer, NEPoolingLayer>(*polymorphic_downcast<FusedConvolutionPoolingNode *>(node));
         case NodeType::DepthToSpaceLayer:
             return detail::validate_depth_to_space_layer<NEDepthToSpaceLayer>(*polymorphic_downcast<DepthToSpaceLayerNode *>(node));
         case NodeType::DepthwiseConvolutionLayer:
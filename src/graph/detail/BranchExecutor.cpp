@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/BranchExecutor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+void execute_task(ExecutionTask &task, int nn)
+{
+    if(nn == 0)
+    {
+        task();
+    }
+    else
+    {
+        task(nn);
+    }
+}
+} // namespace
+
+BranchExecutor::BranchExecutor(const GraphConfig &config)
+    : _consumers(), _num_deps(), _pending(), _runnable(), _executed(0), _workload(nullptr), _nn(0), _pools(num_sub_pools), _mtx(), _cv(), _stop(false)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!is_supported(), "Not enough threads to split the stage in sub-pools");
+
+    // Cores the Neon backend bound the threads of the stage to
+    const int        num_threads = static_cast<int>(Scheduler::get().num_threads());
+    std::vector<int> cores;
+    for(int t = 0; t < num_threads; ++t)
+    {
+        cores.push_back(config.cluster > 0 ? (config.total_cores - 1) - (t % config.total_cores) : t);
+    }
+
+    size_t begin = 0;
+    for(size_t p = 0; p < num_sub_pools; ++p)
+    {
+        const size_t count = (cores.size() - begin) / (num_sub_pools - p);
+        _pools[p].cores.assign(cores.begin() + begin, cores.begin() + begin + count);
+        begin += count;
+    }
+
+    for(auto &pool : _pools)
+    {
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+        pool.scheduler = std::make_unique<CPPScheduler>();
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+        pool.thread = std::thread(&BranchExecutor::worker, this, std::ref(pool), config);
+    }
+}
+
+BranchExecutor::~BranchExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    _cv.notify_all();
+    for(auto &pool : _pools)
+    {
+        if(pool.thread.joinable())
+        {
+            pool.thread.join();
+        }
+    }
+}
+
+bool BranchExecutor::is_supported()
+{
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+    return Scheduler::get().num_threads() >= num_sub_pools;
+#else  /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+    return false;
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+}
+
+void BranchExecutor::configure(const ExecutionWorkload &workload)
+{
+    ARM_COMPUTE_ERROR_ON(workload.graph == nullptr);
+    const Graph &g         = *workload.graph;
+    const size_t num_tasks = workload.tasks.size();
+
+    std::map<NodeID, size_t> node_tasks;
+    for(size_t i = 0; i < num_tasks; ++i)
+    {
+        node_tasks.emplace(workload.tasks[i].node->id(), i);
+    }
+
+    _consumers.assign(num_tasks, {});
+    _num_deps.assign(num_tasks, 0);
+    for(size_t i = 0; i < num_tasks; ++i)
+    {
+        // Walk up the input edges, through the nodes without a task (e.g. sub-tensor concatenations), up to the producing tasks
+        std::set<size_t>    deps;
+        std::set<NodeID>    visited;
+        std::vector<NodeID> to_visit{ workload.tasks[i].node->id() };
+        while(!to_visit.empty())
+        {
+            const INode *node = g.node(to_visit.back());
+            to_visit.pop_back();
+            for(size_t idx = 0; idx < node->num_inputs(); ++idx)
+            {
+                const Edge *edge = node->input_edge(idx);
+                if(edge == nullptr || !visited.insert(edge->producer_id()).second)
+                {
+                    continue;
+                }
+                auto it = node_tasks.find(edge->producer_id());
+                if(it != node_tasks.end())
+                {
+                    deps.insert(it->second);
+                }
+                else
+                {
+                    to_visit.push_back(edge->producer_id());
+                }
+            }
+        }
+
+        for(size_t dep : deps)
+        {
+            _consumers[dep].push_back(i);
+        }
+        _num_deps[i] = deps.size();
+    }
+}
+
+void BranchExecutor::run(ExecutionWorkload &workload, int nn)
+{
+    const size_t num_tasks = workload.tasks.size();
+    ARM_COMPUTE_ERROR_ON_MSG(num_tasks != _num_deps.size(), "Workload differs from the configured one");
+
+    std::unique_lock<std::mutex> lock(_mtx);
+    _cv.wait(lock, [this]
+    {
+        return std::all_of(_pools.begin(), _pools.end(), [](const SubPool & pool)
+        {
+            return pool.ready;
+        });
+    });
+
+    _workload = &workload;
+    _nn       = nn;
+    _executed = 0;
+    _pending  = _num_deps;
+    _runnable.clear();
+    for(size_t i = 0; i < num_tasks; ++i)
+    {
+        if(_num_deps[i] == 0)
+        {
+            _runnable.push_back(i);
+        }
+    }
+
+    while(_executed < num_tasks)
+    {
+        auto idle = std::find_if(_pools.begin(), _pools.end(), [](const SubPool & pool)
+        {
+            return !pool.busy;
+        });
+        const bool all_idle = std::none_of(_pools.begin(), _pools.end(), [](const SubPool & pool)
+        {
+            return pool.busy;
+        });
+
+        if(_runnable.size() == 1 && all_idle)
+        {
+            // Nothing to overlap with: use all the cores of the stage
+            const size_t task = _runnable.front();
+            _runnable.pop_front();
+            lock.unlock();
+            execute_task(workload.tasks[task], nn);
+            lock.lock();
+            complete(task);
+        }
+        else if(!_runnable.empty() && idle != _pools.end())
+        {
+            idle->task = _runnable.front();
+            idle->busy = true;
+            _runnable.pop_front();
+            _cv.notify_all();
+        }
+        else
+        {
+            _cv.wait(lock);
+        }
+    }
+    _workload = nullptr;
+}
+
+void BranchExecutor::worker(SubPool &pool, GraphConfig config)
+{
+    // Binds this thread to the first core of the pool and the scheduler workers to the others
+    const std::vector<int> cores = pool.cores;
+    pool.scheduler->set_num_threads_with_affinity(cores.size(), config, [cores](int t_id, int, GraphConfig)
+    {
+        return cores[t_id % cores.size()];
+    });
+    Scheduler::set_thread_scheduler(pool.scheduler.get());
+
+    std::unique_lock<std::mutex> lock(_mtx);
+    pool.ready = true;
+    _cv.notify_all();
+    while(true)
+    {
+        _cv.wait(lock, [&]
+        {
+            return _stop || pool.busy;
+        });
+        if(!pool.busy)
+        {
+            break;
+        }
+
+        const size_t task = pool.task;
+        lock.unlock();
+        execute_task(_workload->tasks[task], _nn);
+        lock.lock();
+        pool.busy = false;
+        complete(task);
+    }
+    Scheduler::set_thread_scheduler(nullptr);
+}
+
+void BranchExecutor::complete(size_t task)
+{
+    ++_executed;
+    for(size_t consumer : _consumers[task])
+    {
+        if(--_pending[consumer] == 0)
+        {
+            _runnable.push_back(consumer);
+        }
+    }
+    _cv.notify_all();
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/CalibrationHelpers.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INode.h"
+#include "arm_compute/graph/QuantizationTable.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/BatchNormalizationLayerNode.h"
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+namespace
+{
+/** Calls a function on every value of a float tensor with its coordinates */
+template <typename F>
+void for_each_value(const ITensor &tensor, F &&func)
+{
+    Window win;
+    win.use_tensor_dimensions(tensor.info()->tensor_shape());
+    Iterator it(&tensor, win);
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        func(*reinterpret_cast<float *>(it.ptr()), id);
+    },
+    it);
+}
+
+/** Reads the values of a one dimensional float graph tensor, empty if there is no tensor */
+std::vector<float> read_values(Tensor *tensor)
+{
+    std::vector<float> values;
+    if(tensor == nullptr || tensor->handle() == nullptr)
+    {
+        return values;
+    }
+    tensor->handle()->map(true);
+    for_each_value(tensor->handle()->tensor(), [&](float value, const Coordinates &)
+    {
+        values.push_back(value);
+    });
+    tensor->handle()->unmap();
+    return values;
+}
+
+/** Range of the values of a float graph tensor, each value being scaled by the factor of its channel if any */
+TensorRange compute_range(Tensor &tensor, const std::vector<float> *channel_scale = nullptr, size_t channel_dim = 0)
+{
+    tensor.handle()->map(true);
+    const TensorRange range = detail::compute_range(tensor.handle()->tensor(), channel_scale, channel_dim);
+    tensor.handle()->unmap();
+    return range;
+}
+
+bool is_recordable(Tensor *tensor)
+{
+    return tensor != nullptr && tensor->handle() != nullptr && tensor->desc().data_type == DataType::F32 && tensor->desc().shape.total_size() != 0;
+}
+} // namespace
+
+TensorRange compute_range(const ITensor &tensor, const std::vector<float> *channel_scale, size_t channel_dim)
+{
+    TensorRange range;
+    range.min = std::numeric_limits<float>::max();
+    range.max = std::numeric_limits<float>::lowest();
+
+    for_each_value(tensor, [&](float value, const Coordinates & id)
+    {
+        if(channel_scale != nullptr)
+        {
+            value *= (*channel_scale)[id[channel_dim]];
+        }
+        range.min = std::min(range.min, value);
+        range.max = std::max(range.max, value);
+    });
+    return range;
+}
+
+void quantize_values(const ITensor &values, ITensor &tensor, const BatchNormalizationFolding *folding, size_t channel_dim, bool is_bias)
+{
+    ARM_COMPUTE_ERROR_ON(values.info()->tensor_shape() != tensor.info()->tensor_shape());
+
+    const UniformQuantizationInfo qinfo  = tensor.info()->quantization_info().uniform();
+    const bool                    is_s32 = tensor.info()->data_type() == DataType::S32;
+
+    Window win;
+    win.use_tensor_dimensions(values.info()->tensor_shape());
+    Iterator src(&values, win);
+    Iterator dst(&tensor, win);
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        float value = *reinterpret_cast<const float *>(src.ptr());
+        if(folding != nullptr)
+        {
+            const size_t c = id[channel_dim];
+            value          = value * folding->scale[c] + (is_bias ? folding->shift[c] : 0.f);
+        }
+        if(is_s32)
+        {
+            *reinterpret_cast<int32_t *>(dst.ptr()) = static_cast<int32_t>(std::lround(value / qinfo.scale));
+        }
+        else
+        {
+            *dst.ptr() = quantize_qasymm8(value, qinfo);
+        }
+    },
+    src, dst);
+}
+
+BatchNormalizationFolding compute_batch_normalization_folding(const std::vector<float> &mean, const std::vector<float> &var,
+                                                              const std::vector<float> &beta, const std::vector<float> &gamma, float epsilon)
+{
+    ARM_COMPUTE_ERROR_ON(mean.size() != var.size());
+
+    BatchNormalizationFolding folding;
+    folding.scale.resize(mean.size());
+    folding.shift.resize(mean.size());
+    for(size_t c = 0; c < mean.size(); ++c)
+    {
+        folding.scale[c] = (gamma.empty() ? 1.f : gamma[c]) / std::sqrt(var[c] + epsilon);
+        folding.shift[c] = (beta.empty() ? 0.f : beta[c]) - mean[c] * folding.scale[c];
+    }
+    return folding;
+}
+
+BatchNormalizationLayerNode *foldable_batch_normalization(INode &node)
+{
+    if(node.type() != NodeType::ConvolutionLayer && node.type() != NodeType::DepthwiseConvolutionLayer)
+    {
+        return nullptr;
+    }
+
+    // The output of the layer must only be used by the batch normalization
+    if(node.output_edges().size() != 1 || node.output(0) == nullptr || node.output(0)->accessor() != nullptr)
+    {
+        return nullptr;
+    }
+    const Edge *edge = node.graph()->edge(*node.output_edges().begin());
+    if(edge == nullptr || edge->consumer() == nullptr || edge->consumer()->type() != NodeType::BatchNormalizationLayer)
+    {
+        return nullptr;
+    }
+
+    // Weights and batch normalization parameters must be constant
+    const Edge *weights_edge = node.input_edge(1);
+    if(weights_edge == nullptr || weights_edge->producer()->type() != NodeType::Const)
+    {
+        return nullptr;
+    }
+    auto *bn_node = arm_compute::utils::cast::polymorphic_downcast<BatchNormalizationLayerNode *>(edge->consumer());
+    if(bn_node->fused_activation().enabled())
+    {
+        return nullptr;
+    }
+    for(size_t idx = 1; idx < bn_node->num_inputs(); ++idx)
+    {
+        const Edge *param_edge = bn_node->input_edge(idx);
+        if(param_edge != nullptr && param_edge->producer()->type() != NodeType::Const)
+        {
+            return nullptr;
+        }
+    }
+    return bn_node;
+}
+
+size_t folded_channel_dimension(const INode &node)
+{
+    const TensorDescriptor &weights_desc = node.input(1)->desc();
+    // Convolution weights are [kernel_x, kernel_y, IFM, OFM] while depthwise ones are [kernel_x, kernel_y, channels] (NCHW)
+    return get_dimension_idx(weights_desc.layout, node.type() == NodeType::DepthwiseConvolutionLayer ? DataLayoutDimension::CHANNEL : DataLayoutDimension::BATCHES);
+}
+
+void record_output_ranges(INode &node)
+{
+    for(size_t idx = 0; idx < node.num_outputs(); ++idx)
+    {
+        Tensor     *tensor = node.output(idx);
+        std::string key    = QuantizationTable::tensor_key(node, idx);
+        if(!key.empty() && is_recordable(tensor))
+        {
+            QuantizationTable::get().record(key, compute_range(*tensor));
+        }
+    }
+}
+
+void record_const_ranges(Graph &g)
+{
+    // Weights with a batch normalization folded in
+    std::set<TensorID> folded;
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+        BatchNormalizationLayerNode *bn_node = foldable_batch_normalization(*node);
+        Tensor                      *weights = node->input(1);
+        if(bn_node == nullptr || !is_recordable(weights))
+        {
+            continue;
+        }
+        const BatchNormalizationFolding folding = compute_batch_normalization_folding(read_values(bn_node->input(1)), read_values(bn_node->input(2)),
+                                                                                      read_values(bn_node->input(3)), read_values(bn_node->input(4)),
+                                                                                      bn_node->epsilon());
+        QuantizationTable::get().record(QuantizationTable::tensor_key(*node->input_edge(1)->producer(), 0),
+                                        compute_range(*weights, &folding.scale, folded_channel_dimension(*node)));
+        folded.insert(weights->id());
+    }
+
+    for(auto &node_id : g.nodes(NodeType::Const))
+    {
+        INode *node = g.node(node_id);
+        if(node != nullptr && node->output(0) != nullptr && folded.count(node->output(0)->id()) == 0)
+        {
+            record_output_ranges(*node);
+        }
+    }
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/ClusterWorker.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+
+#include <map>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace detail
+{
+ClusterWorker &ClusterWorker::get(const GraphConfig &config, int cluster)
+{
+    static std::mutex                                    mtx;
+    static std::map<int, std::unique_ptr<ClusterWorker>> workers;
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto                       &worker = workers[cluster];
+    if(worker == nullptr)
+    {
+        worker.reset(new ClusterWorker(config, cluster));
+    }
+    return *worker;
+}
+
+bool ClusterWorker::is_supported()
+{
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+    return true;
+#else  /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+    return false;
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+}
+
+ClusterWorker::ClusterWorker(const GraphConfig &config, int cluster)
+    : _cores(), _scheduler(), _jobs(), _mtx(), _cv(), _stop(false), _thread()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!is_supported(), "Work can only be run on another cluster with the C++ scheduler");
+
+    // Same binding as the threads the Neon backend starts for a stage on the cluster
+    const int num_cores = cluster > 0 ? config.big_cores : config.little_cores;
+    for(int t = 0; t < num_cores; ++t)
+    {
+        _cores.push_back(cluster > 0 ? (config.total_cores - 1) - (t % config.total_cores) : t);
+    }
+
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+    _scheduler = std::make_unique<CPPScheduler>();
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+    _thread = std::thread(&ClusterWorker::worker, this, config);
+}
+
+ClusterWorker::~ClusterWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop = true;
+    }
+    _cv.notify_all();
+    if(_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+std::future<void> ClusterWorker::submit(std::function<void()> work)
+{
+    std::packaged_task<void()> job(std::move(work));
+    std::future<void>          done = job.get_future();
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _jobs.push_back(std::move(job));
+    }
+    _cv.notify_all();
+    return done;
+}
+
+unsigned int ClusterWorker::num_threads() const
+{
+    return _cores.size();
+}
+
+void ClusterWorker::worker(GraphConfig config)
+{
+    // Binds this thread to the first core of the cluster and the scheduler workers to the others
+    const std::vector<int> cores = _cores;
+    _scheduler->set_num_threads_with_affinity(cores.size(), config, [cores](int t_id, int, GraphConfig)
+    {
+        return cores[t_id % cores.size()];
+    });
+    Scheduler::set_thread_scheduler(_scheduler.get());
+
+    std::unique_lock<std::mutex> lock(_mtx);
+    while(true)
+    {
+        _cv.wait(lock, [this]
+        {
+            return _stop || !_jobs.empty();
+        });
+        if(_jobs.empty())
+        {
+            break;
+        }
+
+        std::packaged_task<void()> job = std::move(_jobs.front());
+        _jobs.pop_front();
+        lock.unlock();
+        job();
+        lock.lock();
+    }
+    Scheduler::set_thread_scheduler(nullptr);
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
@@ -33,9 +33,13 @@
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Tensor.h"
 #include "support/Cast.h"
 
 #include <algorithm>
+#include <iterator>
 #include <map>
 
 namespace arm_compute
@@ -231,6 +235,16 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
         }
     }
 }
+
+/** Lifetime and placement of a statically planned tensor */
+struct PlannedTensor
+{
+    ITensorHandle *handle; /**< Parent handle of the tensor */
+    size_t         first;  /**< Index of the first task using the tensor */
+    size_t         last;   /**< Index of the last task using the tensor */
+    size_t         size;   /**< Size of the tensor, rounded up to the arena alignment */
+    size_t         offset; /**< Offset of the tensor in the arena */
+};
 } // namespace
 
 void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload &workload)
@@ -265,6 +279,118 @@ void configure_transition_manager(Graph &g, GraphContext &ctx, ExecutionWorkload
         }
     }
 }
+
+void configure_static_transition_memory(Graph &g, GraphContext &ctx, ExecutionWorkload &workload)
+{
+    constexpr size_t alignment = 64;
+
+    // Get const tensors (un-managed)
+    std::set<ITensorHandle *> const_tensors = get_const_handles(g);
+
+    // Compute the lifetime of each transition tensor in the order of the tasks
+    std::vector<PlannedTensor>        tensors;
+    std::map<ITensorHandle *, size_t> tensor_idx;
+    for(size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        const TaskHandles task_handles = get_transition_handles(ctx, workload.tasks[i], const_tensors);
+
+        std::vector<std::pair<ITensorHandle *, IMemoryGroup *>> handles = task_handles.input_handles;
+        handles.insert(handles.end(), task_handles.output_handles.begin(), task_handles.output_handles.end());
+        for(auto &handle : handles)
+        {
+            ITensorHandle *parent_handle = handle.first;
+            if(parent_handle->target() != Target::NEON)
+            {
+                continue;
+            }
+            auto it = tensor_idx.find(parent_handle);
+            if(it == tensor_idx.end())
+            {
+                const size_t size = parent_handle->tensor().info()->total_size();
+                tensor_idx.emplace(parent_handle, tensors.size());
+                tensors.push_back(PlannedTensor{ parent_handle, i, i, ((size + alignment - 1) / alignment) * alignment, 0 });
+            }
+            else
+            {
+                tensors[it->second].last = i;
+            }
+        }
+    }
+
+    // Place the largest tensors first, each at the lowest offset free during its whole lifetime
+    std::vector<PlannedTensor *> order;
+    for(auto &tensor : tensors)
+    {
+        order.push_back(&tensor);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const PlannedTensor * a, const PlannedTensor * b)
+    {
+        return a->size > b->size;
+    });
+
+    size_t                       arena_size = 0;
+    std::vector<PlannedTensor *> placed;
+    for(auto *tensor : order)
+    {
+        std::vector<PlannedTensor *> alive;
+        std::copy_if(placed.begin(), placed.end(), std::back_inserter(alive), [&](const PlannedTensor * p)
+        {
+            return p->first <= tensor->last && tensor->first <= p->last;
+        });
+        std::sort(alive.begin(), alive.end(), [](const PlannedTensor * a, const PlannedTensor * b)
+        {
+            return a->offset < b->offset;
+        });
+
+        size_t offset = 0;
+        for(const auto *p : alive)
+        {
+            if(offset + tensor->size <= p->offset)
+            {
+                break;
+            }
+            offset = std::max(offset, p->offset + p->size);
+        }
+        tensor->offset = offset;
+        arena_size     = std::max(arena_size, offset + tensor->size);
+        placed.push_back(tensor);
+    }
+
+    // Bind the tensors to the arena
+    workload.transition_arena = std::make_shared<MemoryRegion>(arena_size, alignment);
+    for(const auto &tensor : tensors)
+    {
+        auto *backing_tensor = dynamic_cast<arm_compute::Tensor *>(&tensor.handle->tensor());
+        if(backing_tensor == nullptr)
+        {
+            ARM_COMPUTE_ERROR("Only Neon transition tensors can be placed in the arena");
+        }
+        const Status status = backing_tensor->allocator()->import_memory(static_cast<uint8_t *>(workload.transition_arena->buffer()) + tensor.offset);
+        if(!bool(status))
+        {
+            ARM_COMPUTE_ERROR_VAR("Failed to place a transition tensor in the arena: %s", status.error_description().c_str());
+        }
+    }
+
+    // Report the arena against the live memory lower bound and the memory without reuse
+    size_t sum_size  = 0;
+    size_t peak_live = 0;
+    for(const auto &tensor : tensors)
+    {
+        sum_size += tensor.size;
+    }
+    for(size_t i = 0; i < workload.tasks.size(); ++i)
+    {
+        size_t live = 0;
+        for(const auto &tensor : tensors)
+        {
+            live += (tensor.first <= i && i <= tensor.last) ? tensor.size : 0;
+        }
+        peak_live = std::max(peak_live, live);
+    }
+    ARM_COMPUTE_LOG_GRAPH_INFO("Static transition memory of graph " << g.id() << ": " << tensors.size() << " tensors, arena of " << arena_size
+                               << " bytes, peak of live tensors " << peak_live << " bytes, sum of tensor sizes " << sum_size << " bytes" << std::endl);
+}
 } // namespace detail
 } // namespace graph
 } // namespace arm_compute
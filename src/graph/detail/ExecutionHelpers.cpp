@@ -40,6 +40,10 @@
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/detail/BranchExecutor.h"
+#include "arm_compute/graph/detail/CalibrationHelpers.h"
+#include "arm_compute/graph/detail/WorkloadPMU.h"
+#include "arm_compute/runtime/KernelSelectionLog.h"
 
 namespace arm_compute
 {
@@ -200,10 +204,20 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
         {
             Target                     assigned_target = node->assigned_target();
             backends::IDeviceBackend &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
-            std::unique_ptr<IFunction> func            = backend.configure_node(*node, ctx);
+            if(ctx.config().report_kernels)
+            {
+                KernelSelectionLog::start();
+            }
+            std::unique_ptr<IFunction> func = backend.configure_node(*node, ctx);
+            std::vector<std::string>   kernels;
+            if(ctx.config().report_kernels)
+            {
+                kernels = KernelSelectionLog::stop();
+            }
             if(func != nullptr || is_utility_node(node))
             {
                 workload.tasks.emplace_back(ExecutionTask(std::move(func), node));
+                workload.tasks.back().kernels = std::move(kernels);
             }
         }
     }
@@ -319,26 +333,59 @@ void call_all_tasks(ExecutionWorkload &workload,int nn)
     static int cc=0;
     static int c=0;
 #endif
-    for(auto &task : workload.tasks)
+    // Counters are opened from the thread that executes the workload
+    const bool profile_pmu = (workload.branches == nullptr) && (workload.pmu != nullptr) && workload.pmu->open();
+
+    // Ranges are recorded right after each task, before the memory of its outputs is reused
+    const bool calibrate = (workload.branches == nullptr) && workload.ctx->config().calibrate;
+    if(calibrate)
+    {
+        for(auto &node_id : workload.graph->nodes(NodeType::Input))
+        {
+            record_output_ranges(*workload.graph->node(node_id));
+        }
+    }
+
+    // Independent branches run concurrently, the counters cannot attribute events to their tasks
+    if(workload.branches != nullptr)
     {
-    	if(nn==0)
-    		task();
-    	else{
+        workload.branches->run(workload, nn);
+    }
+    else
+    {
+        for(auto &task : workload.tasks)
+        {
+            if(profile_pmu && task.task)
+            {
+                workload.pmu->start();
+            }
+        	if(nn==0)
+        		task();
+        	else{
 #if streamline > 0
-    		ANNOTATE_CHANNEL_COLOR(cc,((c%2)==0)?ANNOTATE_GREEN:ANNOTATE_YELLOW, (std::to_string(c)+" "+task.node->name()).c_str() );
+        		ANNOTATE_CHANNEL_COLOR(cc,((c%2)==0)?ANNOTATE_GREEN:ANNOTATE_YELLOW, (std::to_string(c)+" "+task.node->name()).c_str() );
 #endif
-    		task(nn);
+        		task(nn);
 #if streamline > 0
-    		if(task.ending)
-    			c=c+1;
-    		ANNOTATE_CHANNEL_END(cc++);
+        		if(task.ending)
+        			c=c+1;
+        		ANNOTATE_CHANNEL_END(cc++);
 #endif
-    	}
-        auto t0=std::chrono::high_resolution_clock::now();
-        auto nanosec = t0.time_since_epoch();
+        	}
+            if(profile_pmu && task.task)
+            {
+                workload.pmu->stop(task.pmu_counts);
+            }
+            if(calibrate && task.node != nullptr)
+            {
+                record_output_ranges(*task.node);
+            }
+            auto t0=std::chrono::high_resolution_clock::now();
+            auto nanosec = t0.time_since_epoch();
 #if My_print > 0
-        std::cout<<"Executionhelpers, tasks() time: "<<nanosec.count()<<std::endl;
+            std::cout<<"Executionhelpers, tasks() time: "<<nanosec.count()<<std::endl;
 #endif
+        }
     }
 
     // Release memory for the transition buffers
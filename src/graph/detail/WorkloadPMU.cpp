@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/detail/WorkloadPMU.h"
+
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#if defined(__linux__)
+#include "arm_compute/runtime/PMU.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* defined(__linux__) */
+
+namespace arm_compute
+{
+#if !defined(__linux__)
+/** perf_event_open is not available: counters can never be opened */
+class PMU
+{
+};
+#endif /* !defined(__linux__) */
+
+namespace graph
+{
+namespace detail
+{
+#if defined(__linux__)
+namespace
+{
+constexpr std::array<uint64_t, num_pmu_events> pmu_event_configs =
+{
+    {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES,
+    }
+};
+} // namespace
+#endif /* defined(__linux__) */
+
+WorkloadPMU::WorkloadPMU()
+    : _counters(), _start(), _tid(-1), _available(false)
+{
+}
+
+WorkloadPMU::~WorkloadPMU() = default;
+
+bool WorkloadPMU::open()
+{
+#if defined(__linux__)
+    const int tid = static_cast<int>(syscall(SYS_gettid));
+    if(tid == _tid)
+    {
+        return _available;
+    }
+
+    _counters.clear();
+    _tid       = tid;
+    _available = true;
+
+    std::vector<int> tids = Scheduler::get().worker_thread_ids();
+    tids.insert(tids.begin(), tid);
+    for(const int thread : tids)
+    {
+        for(const uint64_t config : pmu_event_configs)
+        {
+            perf_event_attr attr{};
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.size           = sizeof(perf_event_attr);
+            attr.config         = config;
+            attr.disabled       = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+
+            auto counter = std::make_unique<PMU>();
+            if(!counter->open_thread(attr, thread))
+            {
+                ARM_COMPUTE_LOG_GRAPH_WARNING("Could not open PMU counters for thread " << thread << ", layer PMU profiling disabled" << std::endl);
+                _counters.clear();
+                _available = false;
+                return false;
+            }
+            _counters.push_back(std::move(counter));
+        }
+    }
+    return _available;
+#else  /* defined(__linux__) */
+    return false;
+#endif /* defined(__linux__) */
+}
+
+void WorkloadPMU::start()
+{
+    if(_available)
+    {
+        _start = read();
+    }
+}
+
+void WorkloadPMU::stop(ExecutionTaskPMUCounts &counts)
+{
+    if(!_available)
+    {
+        return;
+    }
+    const std::array<uint64_t, num_pmu_events> end = read();
+    for(size_t i = 0; i < num_pmu_events; ++i)
+    {
+        counts.values[i] += end[i] - _start[i];
+    }
+    ++counts.samples;
+}
+
+std::array<uint64_t, num_pmu_events> WorkloadPMU::read() const
+{
+    std::array<uint64_t, num_pmu_events> values{ {} };
+#if defined(__linux__)
+    for(size_t i = 0; i < _counters.size(); ++i)
+    {
+        values[i % num_pmu_events] += _counters[i]->get_value<uint64_t>();
+    }
+#endif /* defined(__linux__) */
+    return values;
+}
+} // namespace detail
+} // namespace graph
+} // namespace arm_compute
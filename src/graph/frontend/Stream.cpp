@@ -54,6 +54,21 @@ void Stream::reset()
 	_manager.reset(_g);
 }
 
+std::vector<ExecutionTaskStats> Stream::task_stats() const
+{
+    return _manager.task_stats(_g);
+}
+
+void Stream::reset_task_stats()
+{
+    _manager.reset_task_stats(_g);
+}
+
+std::vector<double> Stream::layer_times(int n)
+{
+    return _manager.layer_times(_g, n);
+}
+
 
 void Stream::run(int n)
 {
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/DataLayoutMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "support/Cast.h"
+
+#include <map>
+#include <utility>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Data layout the layers of a target run fastest in
+ *
+ * The Neon GEMM based and depthwise convolutions vectorize along the channels in NHWC and need no im2col for 1x1 kernels.
+ */
+DataLayout preferred_layout(Target target)
+{
+    return (target == Target::NEON) ? DataLayout::NHWC : DataLayout::NCHW;
+}
+
+/** Permutation converting a shape to the given layout from the other one */
+PermutationVector permutation_to(DataLayout layout)
+{
+    return (layout == DataLayout::NHWC) ? PermutationVector(2U, 0U, 1U) : PermutationVector(1U, 2U, 0U);
+}
+
+/** Checks if a tensor has spatial dimensions laid out differently in NCHW and NHWC */
+bool is_spatial(const TensorDescriptor &desc)
+{
+    return desc.shape.num_dimensions() >= 3 && (desc.layout == DataLayout::NCHW || desc.layout == DataLayout::NHWC);
+}
+
+/** Checks if a layer computes the same in both layouts once its tensors and attributes are converted */
+bool is_convertible(const INode &node)
+{
+    switch(node.type())
+    {
+        case NodeType::ActivationLayer:
+        case NodeType::BatchNormalizationLayer:
+        case NodeType::ChannelShuffleLayer:
+        case NodeType::ConcatenateLayer:
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::DequantizationLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::FullyConnectedLayer:
+        case NodeType::NormalizationLayer:
+        case NodeType::PoolingLayer:
+        case NodeType::QuantizationLayer:
+        case NodeType::UnaryEltwiseLayer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** Checks if a layer reads a tensor the same in both layouts, i.e. a reshape of a tensor of a single pixel */
+bool is_layout_agnostic_use(const INode &node, const TensorDescriptor &desc)
+{
+    return (node.type() == NodeType::ReshapeLayer || node.type() == NodeType::FlattenLayer)
+           && get_dimension_size(desc, DataLayoutDimension::WIDTH) == 1 && get_dimension_size(desc, DataLayoutDimension::HEIGHT) == 1;
+}
+
+/** Converts a tensor descriptor to the given layout */
+void convert_descriptor(TensorDescriptor &desc, DataLayout layout)
+{
+    arm_compute::permute(desc.shape, permutation_to(layout));
+    desc.layout = layout;
+}
+} // namespace
+
+const char *DataLayoutMutator::name()
+{
+    return "DataLayoutMutator";
+}
+
+IGraphMutator::MutationType DataLayoutMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void DataLayoutMutator::mutate(Graph &g)
+{
+    // Layouts before the pass, which the layers that cannot be converted expect
+    std::map<TensorID, TensorDescriptor> original_descs;
+    for(auto &tensor : g.tensors())
+    {
+        if(tensor != nullptr)
+        {
+            original_descs.emplace(tensor->id(), tensor->desc());
+        }
+    }
+
+    // Permutes already inserted, shared by all the consumers of a tensor needing it in the same layout
+    std::map<std::pair<TensorID, DataLayout>, NodeID> permutes;
+
+    unsigned int num_converted = 0;
+    for(const auto &nid : dfs(g))
+    {
+        INode *node = g.node(nid);
+        if(node == nullptr || node->type() == NodeType::Const || node->type() == NodeType::Output)
+        {
+            continue;
+        }
+
+        const DataLayout layout = preferred_layout(node->assigned_target());
+        if(node->type() == NodeType::Input)
+        {
+            Tensor *output = node->output(0);
+            if(output != nullptr && is_spatial(output->desc()) && output->desc().layout != layout)
+            {
+                convert_descriptor(output->desc(), layout);
+            }
+            continue;
+        }
+
+        const bool convertible = is_convertible(*node);
+        for(size_t idx = 0; idx < node->num_inputs(); ++idx)
+        {
+            Edge *edge = node->input_edge(idx);
+            if(edge == nullptr || edge->tensor() == nullptr)
+            {
+                continue;
+            }
+            Tensor    *tensor        = edge->tensor();
+            const auto original_desc = original_descs.find(tensor->id());
+            if(original_desc == original_descs.end() || !is_spatial(original_desc->second))
+            {
+                continue;
+            }
+
+            const DataLayout input_layout = convertible ? layout : original_desc->second.layout;
+            if(tensor->desc().layout == input_layout)
+            {
+                continue;
+            }
+            if(edge->producer()->type() == NodeType::Const)
+            {
+                // The accessor of the constant permutes the data when loading it
+                convert_descriptor(tensor->desc(), input_layout);
+                continue;
+            }
+            if(!convertible && is_layout_agnostic_use(*node, tensor->desc()))
+            {
+                continue;
+            }
+
+            const NodeID       producer_id  = edge->producer_id();
+            const unsigned int producer_idx = edge->producer_idx();
+            const auto         key          = std::make_pair(tensor->id(), input_layout);
+            if(permutes.find(key) == permutes.end())
+            {
+                INode       *producer = edge->producer();
+                const NodeID perm_nid = g.add_node<PermuteLayerNode>(permutation_to(input_layout), input_layout);
+                INode       *perm     = g.node(perm_nid);
+                perm->set_common_node_parameters(NodeParams{ producer->name() + (input_layout == DataLayout::NHWC ? "/to_nhwc" : "/to_nchw"), producer->assigned_target() });
+                perm->set_assigned_target(producer->assigned_target());
+                g.add_connection(producer_id, producer_idx, perm_nid, 0);
+                permutes.emplace(key, perm_nid);
+            }
+            g.remove_connection(edge->id());
+            g.add_connection(permutes[key], 0, nid, idx);
+        }
+
+        if(convertible)
+        {
+            if(node->type() == NodeType::PoolingLayer)
+            {
+                arm_compute::utils::cast::polymorphic_downcast<PoolingLayerNode *>(node)->set_data_layout(layout);
+            }
+            ++num_converted;
+        }
+        node->forward_descriptors();
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Data layout mutator converted " << num_converted << " layers and inserted " << permutes.size() << " permutes" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -131,8 +131,13 @@ void GroupedConvolutionMutator::mutate(Graph &g)
             backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(node->assigned_target());
             Status                    status  = backend.validate_node(*node);
 
+            // Backends running all the groups in one function (e.g. NEGEMMGroupedConvolutionLayer) keep the node as it is
+            if(bool(status))
+            {
+                ARM_COMPUTE_LOG_GRAPH_VERBOSE("Keeping the grouped convolution with ID : " << node->id() << " as a single node" << std::endl);
+            }
             // If grouped convolution is not supported
-            if(!bool(status))
+            else
             {
                 // Down-cast node
                 auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node);
@@ -26,47 +26,110 @@
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/Logger.h"
 
+#include <algorithm>
+#include <set>
+#include <vector>
+
 namespace arm_compute
 {
 namespace graph
 {
 namespace
 {
-// Check if the output edges of the parent node are separate tensors. If not,
-// it means the same output is connected to multiple nodes and computations on
-// these nodes cannot be done in-place.
-bool output_edges_are_separate_tensors(Graph &g, const Edge *input_edge)
+// Concatenation and split layers may be computed with sub-tensors, so their
+// inputs and outputs share memory.
+bool shares_memory(const INode &node)
 {
-    const auto parent_node   = input_edge->producer();
-    const auto input_tensor  = input_edge->tensor();
-    const auto input_edge_id = input_edge->id();
+    return node.type() == NodeType::ConcatenateLayer || node.type() == NodeType::SplitLayer;
+}
 
-    if(parent_node == nullptr)
+// Collect the nodes reading a tensor, or any tensor that may share its memory.
+std::set<NodeID> collect_readers(Graph &g, Tensor *tensor)
+{
+    std::set<NodeID>      readers;
+    std::set<TensorID>    visited;
+    std::vector<Tensor *> tensors{ tensor };
+    while(!tensors.empty())
     {
-        return false;
-    }
-
-    const auto output_edges = parent_node->output_edges();
+        Tensor *t = tensors.back();
+        tensors.pop_back();
+        if(t == nullptr || !visited.insert(t->id()).second)
+        {
+            continue;
+        }
 
-    // If the output is connected to only one edge, then computations can
-    // be done in-place.
-    if(output_edges.size() == 1)
-    {
-        return true;
+        for(const auto &edge_id : t->bound_edges())
+        {
+            const Edge *edge = g.edge(edge_id);
+            if(edge == nullptr)
+            {
+                continue;
+            }
+            INode *consumer = edge->consumer();
+            if(consumer != nullptr)
+            {
+                readers.insert(consumer->id());
+                if(shares_memory(*consumer))
+                {
+                    for(size_t i = 0; i < consumer->num_outputs(); ++i)
+                    {
+                        tensors.push_back(consumer->output(i));
+                    }
+                }
+            }
+            INode *producer = edge->producer();
+            if(producer != nullptr && shares_memory(*producer))
+            {
+                for(size_t i = 0; i < producer->num_inputs(); ++i)
+                {
+                    tensors.push_back(producer->input(i));
+                }
+            }
+        }
     }
+    return readers;
+}
 
-    return std::all_of(output_edges.begin(),
-                       output_edges.end(),
-                       [&](const EdgeID & edge_id)
+// Check if a node depends on another one, so it runs after it whatever the
+// execution order of the graph.
+bool depends_on(Graph &g, const INode &node, NodeID ancestor)
+{
+    std::set<NodeID>           visited;
+    std::vector<const INode *> nodes{ &node };
+    while(!nodes.empty())
     {
-        // Skip check on current input edge
-        if(edge_id == input_edge_id)
+        const INode *n = nodes.back();
+        nodes.pop_back();
+        for(const auto &edge_id : n->input_edges())
         {
-            return true;
+            const Edge *edge = g.edge(edge_id);
+            if(edge == nullptr || edge->producer() == nullptr)
+            {
+                continue;
+            }
+            if(edge->producer_id() == ancestor)
+            {
+                return true;
+            }
+            if(visited.insert(edge->producer_id()).second)
+            {
+                nodes.push_back(edge->producer());
+            }
         }
+    }
+    return false;
+}
 
-        auto edge = g.edge(edge_id);
-        return edge->tensor() != input_tensor;
+// Check if a node can overwrite its input tensor. This is the case when every
+// other reader of the tensor, or of a tensor sharing its memory, is an ancestor
+// of the node: the tensor is dead once the node has read it. Output nodes read
+// their tensor after the whole graph has run, so they are never ancestors.
+bool is_dead_after(Graph &g, const INode &node, Tensor *input_tensor)
+{
+    const std::set<NodeID> readers = collect_readers(g, input_tensor);
+    return std::all_of(readers.begin(), readers.end(), [&](const NodeID & reader)
+    {
+        return reader == node.id() || depends_on(g, node, reader);
     });
 }
 } // namespace
@@ -97,22 +160,31 @@ void InPlaceOperationMutator::mutate(Graph &g)
     {
         if(node && in_place_nodes.find(node->type()) != std::end(in_place_nodes))
         {
-            // Get input edge
-            Edge *input_edge = node->input_edge(0);
+            // Element-wise operations can overwrite any of their inputs, the others only their first one
+            const size_t num_candidates        = (node->type() == NodeType::EltwiseLayer) ? node->num_inputs() : 1;
+            auto         current_output_tensor = node->output(0);
+            ARM_COMPUTE_ERROR_ON(current_output_tensor == nullptr);
 
-            // Check if parent has a single output if yes then force in place calculation else not
-            if((input_edge != nullptr) && output_edges_are_separate_tensors(g, input_edge))
+            for(size_t idx = 0; idx < num_candidates; ++idx)
             {
-                // Get current and new output tensors
-                auto current_output_tensor = node->output(0);
-                auto new_output_tensor     = input_edge->tensor();
+                // Get input edge
+                Edge *input_edge = node->input_edge(idx);
+
+                // Check if the input tensor is not read anymore once the node has run, if yes then force in place calculation else not
+                if((input_edge == nullptr) || (input_edge->tensor() == nullptr) || !is_dead_after(g, *node, input_edge->tensor()))
+                {
+                    continue;
+                }
 
-                ARM_COMPUTE_ERROR_ON(current_output_tensor == nullptr || new_output_tensor == nullptr);
+                // Get new output tensor
+                auto new_output_tensor = input_edge->tensor();
 
-                // Prevent in-place operation if there is an accessor bound to the in-place tensor or quantization info are different
-                if(new_output_tensor->accessor() != nullptr || current_output_tensor->desc().quant_info != new_output_tensor->desc().quant_info)
+                // Prevent in-place operation if there is an accessor bound to the in-place tensor, the quantization info are different
+                // or the input is broadcast
+                if(new_output_tensor->accessor() != nullptr || current_output_tensor->desc().quant_info != new_output_tensor->desc().quant_info
+                   || current_output_tensor->desc().shape != new_output_tensor->desc().shape)
                 {
-                    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented in-place operation as there is an accessor bound to the input tensor or the quantization info are different.\n");
+                    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented in-place operation as there is an accessor bound to the input tensor, the quantization info are different or the input is broadcast.\n");
                 }
                 else
                 {
@@ -122,6 +194,7 @@ void InPlaceOperationMutator::mutate(Graph &g)
                     new_output_tensor->set_accessor(current_output_tensor->extract_accessor());
                     // Update output
                     node->set_output_tensor(new_output_tensor->id(), 0);
+                    break;
                 }
             }
         }
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/LayerTilingMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "support/Cast.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Converts a node to the layer of a tiled chain
+ *
+ * @param[in]  node  Node to convert
+ * @param[out] layer Layer computing the node, if it can be tiled
+ *
+ * @return True if the node can be computed band by band along the height
+ */
+bool to_tiled_layer(const INode &node, descriptors::TiledLayerDescriptor &layer)
+{
+    const Tensor *output = node.output(0);
+    if(node.assigned_target() != Target::NEON || node.num_outputs() != 1 || output == nullptr || !is_data_type_float(output->desc().data_type))
+    {
+        return false;
+    }
+
+    layer = descriptors::TiledLayerDescriptor(node.type(), node.name());
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        {
+            const auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<const ConvolutionLayerNode *>(&node);
+            layer.conv_info       = conv_node->convolution_info();
+            layer.act_info        = conv_node->fused_activation();
+            return conv_node->num_groups() == 1;
+        }
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            const auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<const FusedConvolutionBatchNormalizationNode *>(&node);
+            layer.type            = NodeType::ConvolutionLayer;
+            layer.conv_info       = conv_node->convolution_info();
+            layer.act_info        = conv_node->fused_activation();
+            layer.epsilon         = conv_node->epsilon();
+            return conv_node->num_groups() == 1;
+        }
+        case NodeType::ActivationLayer:
+            layer.act_info = arm_compute::utils::cast::polymorphic_downcast<const ActivationLayerNode *>(&node)->activation_info();
+            return true;
+        case NodeType::NormalizationLayer:
+            // Normalizations across the height need rows of the neighbouring bands
+            layer.norm_info = arm_compute::utils::cast::polymorphic_downcast<const NormalizationLayerNode *>(&node)->normalization_info();
+            return layer.norm_info.type() == NormType::CROSS_MAP;
+        case NodeType::PoolingLayer:
+            // Only max pooling of NHWC tensors is tiled: the NCHW pooling kernels need padding around each band
+            layer.pool_info = arm_compute::utils::cast::polymorphic_downcast<const PoolingLayerNode *>(&node)->pooling_info();
+            return layer.pool_info.pool_type == PoolingType::MAX && !layer.pool_info.is_global_pooling && output->desc().layout == DataLayout::NHWC;
+        default:
+            // Fused convolution eltwise and pooling nodes are created by the backend fusion pass, which runs after the chains have been tiled
+            return false;
+    }
+}
+
+/** Returns the node following @p node in a tiled chain
+ *
+ * @param[in] g    Graph the node belongs to
+ * @param[in] node Node of the chain
+ *
+ * @return The only consumer of the output of @p node if it can be tiled with it, nullptr otherwise
+ */
+INode *next_in_chain(Graph &g, const INode &node)
+{
+    // The intermediate tensors of the chain are never computed in full, so they cannot be read by anything else
+    if(node.output_edges().size() != 1 || node.output(0)->accessor() != nullptr)
+    {
+        return nullptr;
+    }
+
+    const Edge *edge = g.edge(*node.output_edges().begin());
+    if(edge == nullptr || edge->consumer() == nullptr || edge->consumer_idx() != 0)
+    {
+        return nullptr;
+    }
+
+    descriptors::TiledLayerDescriptor layer(NodeType::Dummy);
+    return to_tiled_layer(*edge->consumer(), layer) ? edge->consumer() : nullptr;
+}
+
+void tile_chain(Graph &g, const std::vector<NodeID> &chain)
+{
+    std::vector<descriptors::TiledLayerDescriptor> layers;
+    std::string                                    name;
+    for(NodeID id : chain)
+    {
+        layers.emplace_back(NodeType::Dummy);
+        to_tiled_layer(*g.node(id), layers.back());
+        name += (name.empty() ? "" : "+") + g.node(id)->name();
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Tiling chain of " << chain.size() << " layers : " << name << std::endl);
+
+    INode       *first_node      = g.node(chain.front());
+    INode       *last_node       = g.node(chain.back());
+    const Target assigned_target = first_node->assigned_target();
+
+    const NodeID tiled_id = g.add_node<TiledLayerChainNode>(layers);
+
+    // Add connections from the input of the chain and the weights, bias and batch normalization inputs of its convolutions
+    const Edge *input_edge = first_node->input_edge(0);
+    g.add_connection(input_edge->producer_id(), input_edge->producer_idx(), tiled_id, 0);
+    for(size_t l = 0; l < chain.size(); ++l)
+    {
+        const INode *node = g.node(chain[l]);
+        for(size_t i = 1; i < node->num_inputs() && layers[l].type == NodeType::ConvolutionLayer; ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if(edge != nullptr)
+            {
+                g.add_connection(edge->producer_id(), edge->producer_idx(), tiled_id, TiledLayerChainNode::layer_input_idx(l, i - 1));
+            }
+        }
+    }
+
+    // Extract the driving nodes and accessor of the last node of the chain
+    std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*last_node);
+    auto                     accessor      = last_node->output(0)->extract_accessor();
+
+    for(NodeID id : chain)
+    {
+        g.remove_node(id);
+    }
+
+    INode *tiled_node = g.node(tiled_id);
+    for(auto &driving_node : driving_nodes)
+    {
+        g.add_connection(tiled_id, 0, driving_node.node_id, driving_node.index);
+    }
+    tiled_node->output(0)->set_accessor(std::move(accessor));
+    tiled_node->set_assigned_target(assigned_target);
+    tiled_node->set_common_node_parameters(NodeParams{ name, assigned_target });
+}
+} // namespace
+
+const char *LayerTilingMutator::name()
+{
+    return "LayerTilingMutator";
+}
+
+IGraphMutator::MutationType LayerTilingMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void LayerTilingMutator::mutate(Graph &g)
+{
+    // Collect the chains first, as tiling them removes nodes
+    std::vector<std::vector<NodeID>> chains;
+    for(auto &node : g.nodes())
+    {
+        descriptors::TiledLayerDescriptor layer(NodeType::Dummy);
+        if(node == nullptr || !to_tiled_layer(*node, layer) || node->input_edge(0) == nullptr)
+        {
+            continue;
+        }
+
+        // Chains are started from their first node only
+        const INode *producer = node->input_edge(0)->producer();
+        if(producer != nullptr && next_in_chain(g, *producer) == node.get())
+        {
+            continue;
+        }
+
+        std::vector<NodeID> chain{ node->id() };
+        for(const INode *next = next_in_chain(g, *node); next != nullptr; next = next_in_chain(g, *next))
+        {
+            chain.push_back(next->id());
+        }
+        if(chain.size() > 1)
+        {
+            chains.push_back(chain);
+        }
+    }
+
+    for(const auto &chain : chains)
+    {
+        tile_chain(g, chain);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
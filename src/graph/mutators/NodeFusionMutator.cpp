@@ -210,6 +210,295 @@ void fuse_depthwise_convolution_with_batch_normalization(Graph &g, const Edge *o
     }
 }
 
+/** Epsilon of the batch normalization folded in a convolution node, if any */
+inline float batch_normalization_epsilon(const ConvolutionLayerNode &)
+{
+    return 0.f;
+}
+inline float batch_normalization_epsilon(const FusedConvolutionBatchNormalizationNode &node)
+{
+    return node.epsilon();
+}
+inline float batch_normalization_epsilon(const DepthwiseConvolutionLayerNode &)
+{
+    return 0.f;
+}
+inline float batch_normalization_epsilon(const FusedDepthwiseConvolutionBatchNormalizationNode &node)
+{
+    return node.epsilon();
+}
+
+/** Checks that fusing a convolution band by band keeps the method it would run with
+ *
+ * The bands always run the GEMM convolution without fast math, so convolutions asking for another method,
+ * for fast math or for the method measured the fastest in the convolution method table are left alone.
+ */
+template <typename N>
+bool is_banded_convolution_method(const N &conv_node, bool use_conv_method_table)
+{
+    const ConvolutionMethod method = conv_node.convolution_method();
+    if(conv_node.fast_math_hint() == FastMathHint::Enabled)
+    {
+        return false;
+    }
+    return method == ConvolutionMethod::GEMM || (method == ConvolutionMethod::Default && !use_conv_method_table);
+}
+
+template <typename N>
+void fuse_convolution_with_eltwise(Graph &g, const Edge *output_edge, bool use_conv_method_table)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *conv_node    = arm_compute::utils::cast::polymorphic_downcast<N *>(output_edge->producer());
+    auto *eltwise_node = arm_compute::utils::cast::polymorphic_downcast<EltwiseLayerNode *>(output_edge->consumer());
+
+    // Only a residual addition can be fused, and an activation of the convolution would have to run before it
+    if(eltwise_node->eltwise_operation() != EltwiseOperation::Add || eltwise_node->fused_activation().enabled() || conv_node->fused_activation().enabled() || conv_node->num_groups() > 1)
+    {
+        return;
+    }
+    if(!is_banded_convolution_method(*conv_node, use_conv_method_table))
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of convolution with eltwise as the convolution does not run the GEMM method\n");
+        return;
+    }
+
+    // The addend must match the convolution output, broadcasting and quantized additions are not fused
+    const Edge *addend_edge = eltwise_node->input_edge(1 - output_edge->consumer_idx());
+    if(addend_edge == nullptr)
+    {
+        return;
+    }
+    const TensorDescriptor &conv_desc   = conv_node->output(0)->desc();
+    const TensorDescriptor &addend_desc = addend_edge->tensor()->desc();
+    if(!is_data_type_float(conv_desc.data_type) || addend_desc.data_type != conv_desc.data_type || addend_desc.shape != conv_desc.shape)
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : " << output_edge->producer_id()
+                                  << " with Eltwise Layer node with ID : " << output_edge->consumer_id() << std::endl);
+
+    // Prevent fusion if fused node has an output accessor
+    if(conv_node->output(0)->accessor() == nullptr)
+    {
+        const Target assigned_target = conv_node->assigned_target();
+
+        // Take the activation following the addition along, so that it is applied while the band is in cache
+        INode *act_node = nullptr;
+        if(eltwise_node->output(0)->accessor() == nullptr && eltwise_node->output_edges().size() == 1)
+        {
+            const Edge *eltwise_output_edge = g.edge(*eltwise_node->output_edges().begin());
+            if(eltwise_output_edge != nullptr && eltwise_output_edge->consumer() != nullptr && eltwise_output_edge->consumer()->type() == NodeType::ActivationLayer)
+            {
+                act_node = eltwise_output_edge->consumer();
+            }
+        }
+        const ActivationLayerInfo act_info = (act_node != nullptr) ? arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(act_node)->activation_info() : ActivationLayerInfo();
+
+        // Create the fused node
+        const NodeID fused_id = g.add_node<FusedConvolutionEltwiseNode>(conv_node->convolution_info(), EltwiseOperation::Add, batch_normalization_epsilon(*conv_node),
+                                                                        conv_node->convolution_method(), conv_node->fast_math_hint(), act_info);
+
+        // Add connections from the convolution inputs, and batch normalization ones if any, to the fused node
+        for(size_t i = 0; i < conv_node->num_inputs(); ++i)
+        {
+            const Edge *input_edge = conv_node->input_edge(i);
+            if(input_edge != nullptr)
+            {
+                g.add_connection(input_edge->producer_id(), input_edge->producer_idx(), fused_id, i);
+            }
+        }
+        g.add_connection(addend_edge->producer_id(), addend_edge->producer_idx(), fused_id, 7);
+
+        INode                   *last_node          = (act_node != nullptr) ? act_node : eltwise_node;
+        auto                     fused_node         = g.node(fused_id);
+        std::vector<NodeIdxPair> last_driving_nodes = get_driving_nodes(*last_node);
+
+        // Extract the accessor of the last fused node if any
+        auto last_node_accessor = last_node->output(0)->extract_accessor();
+        auto fused_name         = conv_node->name() + "+" + eltwise_node->name() + ((act_node != nullptr) ? "+" + act_node->name() : "");
+
+        // Remove eltwise and activation nodes
+        if(act_node != nullptr)
+        {
+            g.remove_node(act_node->id());
+        }
+        g.remove_node(eltwise_node->id());
+
+        // Get driving nodes of the last fused node
+        for(auto &driving_node : last_driving_nodes)
+        {
+            g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+            configure_tensor(fused_node->output(0));
+        }
+        // Update fused node outputs
+        fused_node->output(0)->set_accessor(std::move(last_node_accessor));
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{ fused_name, assigned_target });
+
+        // Remove convolution node
+        g.remove_node(conv_node->id());
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of convolution with eltwise due to the presence of an output accessor\n");
+    }
+}
+
+template <typename N>
+void fuse_convolution_with_pooling(Graph &g, const Edge *output_edge, bool use_conv_method_table)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *conv_node = arm_compute::utils::cast::polymorphic_downcast<N *>(output_edge->producer());
+    auto *pool_node = arm_compute::utils::cast::polymorphic_downcast<PoolingLayerNode *>(output_edge->consumer());
+
+    // Only max pooling of float NHWC tensors is fused: the NCHW pooling kernels need padding around each band
+    const PoolingLayerInfo  pool_info = pool_node->pooling_info();
+    const TensorDescriptor &conv_desc = conv_node->output(0)->desc();
+    if(pool_info.pool_type != PoolingType::MAX || pool_info.is_global_pooling || conv_node->num_groups() > 1 || !is_data_type_float(conv_desc.data_type) || conv_desc.layout != DataLayout::NHWC)
+    {
+        return;
+    }
+    if(!is_banded_convolution_method(*conv_node, use_conv_method_table))
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of convolution with pooling as the convolution does not run the GEMM method\n");
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing convolution node with ID : " << output_edge->producer_id()
+                                  << " with Pooling Layer node with ID : " << output_edge->consumer_id() << std::endl);
+
+    // Prevent fusion if fused node has an output accessor
+    if(conv_node->output(0)->accessor() == nullptr)
+    {
+        const Target assigned_target = conv_node->assigned_target();
+
+        // Create the fused node
+        const NodeID fused_id = g.add_node<FusedConvolutionPoolingNode>(conv_node->convolution_info(), pool_info, batch_normalization_epsilon(*conv_node),
+                                                                        conv_node->convolution_method(), conv_node->fast_math_hint(), conv_node->fused_activation());
+
+        // Add connections from the convolution inputs, and batch normalization ones if any, to the fused node
+        for(size_t i = 0; i < conv_node->num_inputs(); ++i)
+        {
+            const Edge *input_edge = conv_node->input_edge(i);
+            if(input_edge != nullptr)
+            {
+                g.add_connection(input_edge->producer_id(), input_edge->producer_idx(), fused_id, i);
+            }
+        }
+
+        auto                     fused_node         = g.node(fused_id);
+        std::vector<NodeIdxPair> pool_driving_nodes = get_driving_nodes(*pool_node);
+
+        // Extract pooling node accessor if any
+        auto pool_node_accessor = pool_node->output(0)->extract_accessor();
+        auto pool_node_name     = pool_node->name();
+
+        // Remove pooling node
+        g.remove_node(pool_node->id());
+
+        // Get driving nodes of pooling node
+        for(auto &driving_node : pool_driving_nodes)
+        {
+            g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+            configure_tensor(fused_node->output(0));
+        }
+        // Update fused node outputs
+        fused_node->output(0)->set_accessor(std::move(pool_node_accessor));
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{ conv_node->name() + "+" + pool_node_name, assigned_target });
+
+        // Remove convolution node
+        g.remove_node(conv_node->id());
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of convolution with pooling due to the presence of an output accessor\n");
+    }
+}
+
+template <typename N1, typename N2>
+void fuse_depthwise_convolution_with_pointwise_convolution(Graph &g, const Edge *output_edge)
+{
+    ARM_COMPUTE_ERROR_ON(output_edge == nullptr);
+
+    auto *dwc_node = arm_compute::utils::cast::polymorphic_downcast<N1 *>(output_edge->producer());
+    auto *pwc_node = arm_compute::utils::cast::polymorphic_downcast<N2 *>(output_edge->consumer());
+
+    // Only a 1x1, stride 1, unpadded convolution of float tensors reading the depthwise output is fused
+    const TensorDescriptor &dwc_desc     = dwc_node->output(0)->desc();
+    const TensorDescriptor &pwc_wei_desc = pwc_node->input(1)->desc();
+    const PadStrideInfo     pwc_info     = pwc_node->convolution_info();
+    if(output_edge->consumer_idx() != 0 || pwc_node->assigned_target() != Target::NEON || dwc_node->depth_multiplier() != 1 || pwc_node->num_groups() > 1 || !is_data_type_float(dwc_desc.data_type)
+       || get_dimension_size(pwc_wei_desc, DataLayoutDimension::WIDTH) != 1 || get_dimension_size(pwc_wei_desc, DataLayoutDimension::HEIGHT) != 1
+       || pwc_info.stride() != std::make_pair(1U, 1U) || pwc_info.has_padding())
+    {
+        return;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_VERBOSE("Fusing depthwise convolution node with ID : " << output_edge->producer_id()
+                                  << " with 1x1 convolution node with ID : " << output_edge->consumer_id() << std::endl);
+
+    // Prevent fusion if fused node has an output accessor
+    if(dwc_node->output(0)->accessor() == nullptr)
+    {
+        const Target assigned_target = dwc_node->assigned_target();
+
+        // Create the fused node
+        const NodeID fused_id = g.add_node<FusedDepthwisePointwiseConvolutionNode>(dwc_node->convolution_info(), batch_normalization_epsilon(*dwc_node), dwc_node->fused_activation(),
+                                                                                   batch_normalization_epsilon(*pwc_node), pwc_node->fused_activation());
+
+        // Add connections from the depthwise convolution inputs to the first inputs of the fused node, and from the other inputs of the 1x1 convolution to the last ones.
+        // The depthwise inputs always take the first slots, even when the depthwise convolution has no batch normalization to connect
+        for(size_t i = 0; i < dwc_node->num_inputs(); ++i)
+        {
+            const Edge *input_edge = dwc_node->input_edge(i);
+            if(input_edge != nullptr)
+            {
+                g.add_connection(input_edge->producer_id(), input_edge->producer_idx(), fused_id, i);
+            }
+        }
+        for(size_t i = 1; i < pwc_node->num_inputs(); ++i)
+        {
+            const Edge *input_edge = pwc_node->input_edge(i);
+            if(input_edge != nullptr)
+            {
+                g.add_connection(input_edge->producer_id(), input_edge->producer_idx(), fused_id, FusedDepthwisePointwiseConvolutionNode::pointwise_weights_idx + i - 1);
+            }
+        }
+
+        auto                     fused_node        = g.node(fused_id);
+        std::vector<NodeIdxPair> pwc_driving_nodes = get_driving_nodes(*pwc_node);
+
+        // Extract 1x1 convolution node accessor if any
+        auto pwc_node_accessor = pwc_node->output(0)->extract_accessor();
+        auto pwc_node_name     = pwc_node->name();
+
+        // Remove 1x1 convolution node
+        g.remove_node(pwc_node->id());
+
+        // Get driving nodes of 1x1 convolution node
+        for(auto &driving_node : pwc_driving_nodes)
+        {
+            g.add_connection(fused_id, 0, driving_node.node_id, driving_node.index);
+            configure_tensor(fused_node->output(0));
+        }
+        // Update fused node outputs
+        fused_node->output(0)->set_accessor(std::move(pwc_node_accessor));
+        fused_node->set_assigned_target(assigned_target);
+        fused_node->set_common_node_parameters(NodeParams{ dwc_node->name() + "+" + pwc_node_name, assigned_target });
+
+        // Remove depthwise convolution node
+        g.remove_node(dwc_node->id());
+    }
+    else
+    {
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented fusion of depthwise convolution with 1x1 convolution due to the presence of an output accessor\n");
+    }
+}
+
 template <typename N>
 void fuse_node_with_activation(Graph &g, const Edge *output_edge, const std::set<Activation> &supported_fused_activations)
 {
@@ -287,6 +576,11 @@ void fuse_layer(Graph &g, std::function<bool(INode &)> const &prec, const F fuse
 }
 } // namespace detail
 
+NodeFusionMutator::NodeFusionMutator(bool use_conv_method_table)
+    : _use_conv_method_table(use_conv_method_table)
+{
+}
+
 const char *NodeFusionMutator::name()
 {
     return "NodeFusionMutator";
@@ -316,6 +610,10 @@ void NodeFusionMutator::mutate(Graph &g)
     {
         return n.assigned_target() == Target::CL;
     };
+    auto neon_target_prec = [](INode & n)
+    {
+        return n.assigned_target() == Target::NEON;
+    };
     auto qs8_prec = [&g](INode & n)
     {
         ARM_COMPUTE_ERROR_ON(n.output(0) == nullptr);
@@ -337,6 +635,18 @@ void NodeFusionMutator::mutate(Graph &g)
     detail::fuse_layer<EltwiseLayerNode, ActivationLayerNode>(g, cl_target_prec, detail::fuse_node_with_activation<EltwiseLayerNode>, supported_fused_activations);
     detail::fuse_layer<ConvolutionLayerNode, BatchNormalizationLayerNode>(g, empty_prec, detail::fuse_convolution_with_batch_normalization);
     detail::fuse_layer<DepthwiseConvolutionLayerNode, BatchNormalizationLayerNode>(g, empty_prec, detail::fuse_depthwise_convolution_with_batch_normalization);
+    detail::fuse_layer<ConvolutionLayerNode, EltwiseLayerNode>(g, neon_target_prec, detail::fuse_convolution_with_eltwise<ConvolutionLayerNode>, _use_conv_method_table);
+    detail::fuse_layer<FusedConvolutionBatchNormalizationNode, EltwiseLayerNode>(g, neon_target_prec, detail::fuse_convolution_with_eltwise<FusedConvolutionBatchNormalizationNode>, _use_conv_method_table);
+    detail::fuse_layer<ConvolutionLayerNode, PoolingLayerNode>(g, neon_target_prec, detail::fuse_convolution_with_pooling<ConvolutionLayerNode>, _use_conv_method_table);
+    detail::fuse_layer<FusedConvolutionBatchNormalizationNode, PoolingLayerNode>(g, neon_target_prec, detail::fuse_convolution_with_pooling<FusedConvolutionBatchNormalizationNode>, _use_conv_method_table);
+    detail::fuse_layer<DepthwiseConvolutionLayerNode, ConvolutionLayerNode>(g, neon_target_prec,
+                                                                            detail::fuse_depthwise_convolution_with_pointwise_convolution<DepthwiseConvolutionLayerNode, ConvolutionLayerNode>);
+    detail::fuse_layer<DepthwiseConvolutionLayerNode, FusedConvolutionBatchNormalizationNode>(g, neon_target_prec,
+                                                                                              detail::fuse_depthwise_convolution_with_pointwise_convolution<DepthwiseConvolutionLayerNode, FusedConvolutionBatchNormalizationNode>);
+    detail::fuse_layer<FusedDepthwiseConvolutionBatchNormalizationNode, ConvolutionLayerNode>(g, neon_target_prec,
+                                                                                              detail::fuse_depthwise_convolution_with_pointwise_convolution<FusedDepthwiseConvolutionBatchNormalizationNode, ConvolutionLayerNode>);
+    detail::fuse_layer<FusedDepthwiseConvolutionBatchNormalizationNode, FusedConvolutionBatchNormalizationNode>(g, neon_target_prec,
+                                                                                                                detail::fuse_depthwise_convolution_with_pointwise_convolution<FusedDepthwiseConvolutionBatchNormalizationNode, FusedConvolutionBatchNormalizationNode>);
 }
 } // namespace graph
 } // namespace arm_compute
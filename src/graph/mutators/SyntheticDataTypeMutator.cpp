@@ -23,14 +23,22 @@
  */
 #include "arm_compute/graph/mutators/SyntheticDataTypeMutator.h"
 
+#include "arm_compute/core/Helpers.h"
 #include "arm_compute/graph/GraphBuilder.h"
 #include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/QuantizationTable.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/detail/CalibrationHelpers.h"
 #include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include "support/Cast.h"
 
+#include <cmath>
+#include <cstring>
+#include <map>
 #include <set>
 
 namespace arm_compute
@@ -54,6 +62,102 @@ public:
     }
 };
 
+/** Parameters of a batch normalization folded into the layer before it, loaded on first use */
+class BatchNormalizationParams final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] bn_node Batch normalization node to take the accessors of the parameters from
+     */
+    explicit BatchNormalizationParams(BatchNormalizationLayerNode &bn_node)
+        : _accessors(), _channels(bn_node.input(1)->desc().shape.total_size()), _epsilon(bn_node.epsilon()), _folding(), _is_loaded(false)
+    {
+        // Mean, variance, beta and gamma
+        for(size_t idx = 1; idx < bn_node.num_inputs(); ++idx)
+        {
+            Tensor *param = bn_node.input(idx);
+            _accessors.push_back((param != nullptr) ? param->extract_accessor() : nullptr);
+        }
+    }
+    /** Returns the folding of the batch normalization
+     *
+     * @return Scale and shift of each channel
+     */
+    const detail::BatchNormalizationFolding &folding()
+    {
+        if(!_is_loaded)
+        {
+            _folding   = detail::compute_batch_normalization_folding(load(0, 0.f), load(1, 1.f), load(2, 0.f), load(3, 1.f), _epsilon);
+            _is_loaded = true;
+        }
+        return _folding;
+    }
+
+private:
+    std::vector<float> load(size_t idx, float default_value)
+    {
+        std::vector<float> values(_channels, default_value);
+        if(_accessors[idx] != nullptr)
+        {
+            arm_compute::Tensor param;
+            param.allocator()->init(TensorInfo(TensorShape(_channels), 1, DataType::F32));
+            param.allocator()->allocate();
+            _accessors[idx]->access_tensor(param);
+            const auto *data = reinterpret_cast<const float *>(param.buffer() + param.info()->offset_first_element_in_bytes());
+            values.assign(data, data + _channels);
+        }
+        return values;
+    }
+
+    std::vector<std::unique_ptr<ITensorAccessor>> _accessors;
+    size_t                                        _channels;
+    float                                         _epsilon;
+    detail::BatchNormalizationFolding             _folding;
+    bool                                          _is_loaded;
+};
+
+/** Accessor quantizing the float values given by another accessor */
+class QuantizingAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor    Accessor of the float values, zeros are quantized if nullptr
+     * @param[in] bn_params   (Optional) Batch normalization to fold into the values
+     * @param[in] channel_dim (Optional) Dimension of the output channels in the tensor, when folding a batch normalization
+     * @param[in] is_bias     (Optional) True if the values are biases, which get shifted on top of being scaled by the folding
+     */
+    QuantizingAccessor(std::unique_ptr<ITensorAccessor> accessor, std::shared_ptr<BatchNormalizationParams> bn_params = nullptr, size_t channel_dim = 0, bool is_bias = false)
+        : _accessor(std::move(accessor)), _bn_params(std::move(bn_params)), _channel_dim(channel_dim), _is_bias(is_bias)
+    {
+    }
+
+    // Inherited methods overriden:
+    bool access_tensor(ITensor &tensor) override
+    {
+        TensorInfo info(tensor.info()->tensor_shape(), 1, DataType::F32);
+        info.set_data_layout(tensor.info()->data_layout());
+        arm_compute::Tensor values;
+        values.allocator()->init(info);
+        values.allocator()->allocate();
+        std::memset(values.buffer(), 0, values.info()->total_size());
+        if(_accessor != nullptr && !_accessor->access_tensor(values))
+        {
+            return false;
+        }
+
+        detail::quantize_values(values, tensor, (_bn_params != nullptr) ? &_bn_params->folding() : nullptr, _channel_dim, _is_bias);
+        return true;
+    }
+
+private:
+    std::unique_ptr<ITensorAccessor>          _accessor;
+    std::shared_ptr<BatchNormalizationParams> _bn_params;
+    size_t                                    _channel_dim;
+    bool                                      _is_bias;
+};
+
 /** Check if the mutation pass can be applied
  *
  * @param[in] g Graph the mutation pass need to be applied on
@@ -208,10 +312,14 @@ void handle_nodes_with_bias(Graph &g)
             INode *node = g.node(node_id);
             if(node != nullptr)
             {
+                // Biases are accumulated with the products of the input and the weights
+                const QuantizationInfo b_qinfo(node->input(0)->desc().quant_info.uniform().scale * node->input(1)->desc().quant_info.uniform().scale);
+
                 Tensor *tensor = node->input(2);
                 if(tensor != nullptr)
                 {
-                    tensor->desc().data_type = DataType::S32;
+                    tensor->desc().data_type  = DataType::S32;
+                    tensor->desc().quant_info = b_qinfo;
                 }
                 else
                 {
@@ -221,17 +329,305 @@ void handle_nodes_with_bias(Graph &g)
                     TensorDescriptor b_desc = node->input(1)->desc();
                     auto             depth  = b_desc.shape[get_dimension_idx(b_desc.layout, DataLayoutDimension::BATCHES)];
                     b_desc.shape            = TensorShape(depth);
+                    b_desc.data_type        = DataType::S32;
+                    b_desc.quant_info       = b_qinfo;
+
+                    // Connecting the bias recomputes the output descriptor of the node, which keeps its quantization
+                    const TensorDescriptor output_desc = node->output(0)->desc();
 
                     auto accessor = std::make_unique<EmptyAccessor>();
                     auto b_nid    = GraphBuilder::add_const_node(g, params, b_desc, std::move(accessor));
                     g.add_connection(b_nid, 0, node_id, 2);
+
+                    node->output(0)->desc() = output_desc;
+                }
+            }
+        }
+    }
+}
+
+/** Range covered by a quantization
+ *
+ * @param[in] qinfo Asymmetric 8-bit quantization
+ *
+ * @return Range of the values that can be represented
+ */
+TensorRange range_of(const QuantizationInfo &qinfo)
+{
+    const UniformQuantizationInfo uqinfo = qinfo.uniform();
+    TensorRange                   range;
+    range.min = (0 - uqinfo.offset) * uqinfo.scale;
+    range.max = (255 - uqinfo.offset) * uqinfo.scale;
+    return range;
+}
+
+/** Names the tensors of a graph after the nodes producing them
+ *
+ * @param[in] g Graph to name the tensors of
+ *
+ * @return Key of each tensor in the @ref QuantizationTable
+ */
+std::map<TensorID, std::string> tensor_keys(Graph &g)
+{
+    std::map<TensorID, std::string> keys;
+    for(auto &node : g.nodes())
+    {
+        if(node != nullptr)
+        {
+            for(size_t idx = 0; idx < node->num_outputs(); ++idx)
+            {
+                if(node->output(idx) != nullptr)
+                {
+                    keys[node->output(idx)->id()] = QuantizationTable::tensor_key(*node, idx);
+                }
+            }
+        }
+    }
+    return keys;
+}
+
+/** Folds the batch normalizations following convolutions into their weights and biases
+ *
+ * @param[in,out] g    Graph to fold the batch normalizations of
+ * @param[in,out] keys Keys of the tensors, the output of a convolution takes the key of its batch normalization
+ */
+void fold_batch_normalizations(Graph &g, std::map<TensorID, std::string> &keys)
+{
+    std::vector<NodeID>        conv_ids = g.nodes(NodeType::ConvolutionLayer);
+    const std::vector<NodeID> &dwc_ids  = g.nodes(NodeType::DepthwiseConvolutionLayer);
+    conv_ids.insert(conv_ids.end(), dwc_ids.begin(), dwc_ids.end());
+
+    for(const auto &node_id : conv_ids)
+    {
+        INode                       *node    = g.node(node_id);
+        BatchNormalizationLayerNode *bn_node = (node != nullptr) ? detail::foldable_batch_normalization(*node) : nullptr;
+        if(bn_node == nullptr)
+        {
+            continue;
+        }
+
+        auto         bn_params   = std::make_shared<BatchNormalizationParams>(*bn_node);
+        const size_t channel_dim = detail::folded_channel_dimension(*node);
+
+        Tensor *weights = node->input(1);
+        weights->set_accessor(std::make_unique<QuantizingAccessor>(weights->extract_accessor(), bn_params, channel_dim));
+
+        Tensor *bias = node->input(2);
+        if(bias != nullptr)
+        {
+            bias->set_accessor(std::make_unique<QuantizingAccessor>(bias->extract_accessor(), bn_params, 0, true));
+        }
+        else
+        {
+            auto params = node->common_node_params();
+            params.name = params.name.empty() ? "" : params.name + "Bias";
+
+            TensorDescriptor b_desc = weights->desc();
+            b_desc.shape            = TensorShape(weights->desc().shape[channel_dim]);
+
+            auto accessor = std::make_unique<QuantizingAccessor>(nullptr, bn_params, 0, true);
+            auto b_nid    = GraphBuilder::add_const_node(g, params, b_desc, std::move(accessor));
+            g.add_connection(b_nid, 0, node_id, 2);
+        }
+
+        // Remove the batch normalization and its parameters, the convolution now produces its output
+        keys[node->output(0)->id()] = keys[bn_node->output(0)->id()];
+
+        std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*bn_node);
+        std::vector<NodeID>      param_ids;
+        for(size_t idx = 1; idx < bn_node->num_inputs(); ++idx)
+        {
+            if(bn_node->input_edge(idx) != nullptr)
+            {
+                param_ids.push_back(bn_node->input_edge(idx)->producer_id());
+            }
+        }
+
+        g.remove_node(bn_node->id());
+        for(const auto &param_id : param_ids)
+        {
+            g.remove_node(param_id);
+        }
+        for(auto &driving_node : driving_nodes)
+        {
+            g.add_connection(node_id, 0, driving_node.node_id, driving_node.index);
+        }
+    }
+}
+
+/** Gives the layers followed by a clamping activation the range of the activation
+ *
+ * The activation gets fused into the layer, which then produces the clamped values.
+ * When it is not, requantizing to the clamped range already gives the result of the activation.
+ *
+ * @param[in]     g    Graph to look for the activations in
+ * @param[in,out] keys Keys of the tensors
+ */
+void alias_clamping_activations(Graph &g, std::map<TensorID, std::string> &keys)
+{
+    const std::set<Activation> clamping_activations = { Activation::RELU, Activation::BOUNDED_RELU, Activation::LU_BOUNDED_RELU };
+    const std::set<NodeType>   fusable_types        = { NodeType::ConvolutionLayer, NodeType::DepthwiseConvolutionLayer, NodeType::FullyConnectedLayer };
+
+    for(const auto &act_id : g.nodes(NodeType::ActivationLayer))
+    {
+        auto       *act_node   = arm_compute::utils::cast::polymorphic_downcast<ActivationLayerNode *>(g.node(act_id));
+        const Edge *input_edge = (act_node != nullptr) ? act_node->input_edge(0) : nullptr;
+        if(input_edge == nullptr || clamping_activations.count(act_node->activation_info().activation()) == 0)
+        {
+            continue;
+        }
+        const INode *producer = input_edge->producer();
+        if(fusable_types.count(producer->type()) != 0 && producer->output_edges().size() == 1)
+        {
+            keys[input_edge->tensor_id()] = keys[act_node->output(0)->id()];
+        }
+    }
+}
+
+/** Quantizes the tensors of a graph with the ranges of the @ref QuantizationTable
+ *
+ * Tensors missing from the table take the range of their input (of all their inputs for concatenations).
+ * Network inputs found in the table stay in float and are quantized by a quantization layer,
+ * so they can still be filled and preprocessed in float.
+ *
+ * @param[in,out] g    Graph to quantize
+ * @param[in]     keys Keys of the tensors
+ */
+void quantize_tensors(Graph &g, const std::map<TensorID, std::string> &keys)
+{
+    // Layers only moving values keep the quantization of their input
+    const std::set<NodeType> same_quantization_types = { NodeType::FlattenLayer, NodeType::PermuteLayer, NodeType::ReshapeLayer, NodeType::SplitLayer };
+
+    std::map<TensorID, TensorRange> ranges;
+    auto input_range = [&](const INode & node, size_t idx, TensorRange & range)
+    {
+        const Tensor *input = node.input(idx);
+        const auto    it    = (input != nullptr) ? ranges.find(input->id()) : ranges.end();
+        if(it == ranges.end())
+        {
+            return false;
+        }
+        range = it->second;
+        return true;
+    };
+
+    for(const auto &node_id : dfs(g))
+    {
+        INode *node = g.node(node_id);
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        const bool keeps_input_quantization = same_quantization_types.count(node->type()) != 0
+                                              || (node->type() == NodeType::PoolingLayer
+                                                  && arm_compute::utils::cast::polymorphic_downcast<PoolingLayerNode *>(node)->pooling_info().pool_type == PoolingType::MAX);
+
+        for(size_t idx = 0; idx < node->num_outputs(); ++idx)
+        {
+            Tensor *tensor = node->output(idx);
+            if(tensor == nullptr)
+            {
+                continue;
+            }
+            TensorDescriptor &desc = tensor->desc();
+
+            TensorRange range;
+            const auto  key      = keys.find(tensor->id());
+            const bool  in_table = (key != keys.end()) && QuantizationTable::get().find(key->second, range);
+
+            if(keeps_input_quantization && node->input(0) != nullptr && is_data_type_quantized_asymmetric(node->input(0)->desc().data_type))
+            {
+                desc.data_type       = DataType::QASYMM8;
+                desc.quant_info      = node->input(0)->desc().quant_info;
+                ranges[tensor->id()] = range_of(desc.quant_info);
+                continue;
+            }
+            if(!in_table && is_data_type_quantized_asymmetric(desc.data_type) && !desc.quant_info.empty())
+            {
+                // Already quantized, e.g. the input of a pipeline stage fed by a quantized stage
+                ranges[tensor->id()] = range_of(desc.quant_info);
+                continue;
+            }
+            if(!in_table && node->type() == NodeType::ConcatenateLayer)
+            {
+                bool has_range = false;
+                for(size_t i = 0; i < node->num_inputs(); ++i)
+                {
+                    TensorRange input;
+                    if(input_range(*node, i, input))
+                    {
+                        range.min = has_range ? std::min(range.min, input.min) : input.min;
+                        range.max = has_range ? std::max(range.max, input.max) : input.max;
+                        has_range = true;
+                    }
+                }
+                if(!has_range)
+                {
+                    range = range_of(QuantizationInfo(0.125f, -10));
+                }
+            }
+            else if(!in_table && !input_range(*node, 0, range))
+            {
+                // Biases added to the layers get their quantization later
+                if(node->type() != NodeType::Const)
+                {
+                    ARM_COMPUTE_LOG_GRAPH_WARNING("No range for output " << idx << " of node " << node->name() << ", using a synthetic one" << std::endl);
+                }
+                range = range_of(QuantizationInfo(0.125f, -10));
+            }
+            ranges[tensor->id()] = range;
+
+            if(node->type() == NodeType::Input && in_table)
+            {
+                // Quantize the float input in the graph
+                desc.data_type  = DataType::F32;
+                desc.quant_info = QuantizationInfo();
+
+                std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*node);
+                const std::set<EdgeID>   output_edges  = node->output_edges();
+                for(const auto &edge_id : output_edges)
+                {
+                    g.remove_connection(edge_id);
+                }
+                NodeID q_nid = GraphBuilder::add_quantization_node(g, NodeParams{ node->name() + "/quantize", node->assigned_target() }, { node_id, idx }, range.quantization_info());
+                for(auto &driving_node : driving_nodes)
+                {
+                    g.add_connection(q_nid, 0, driving_node.node_id, driving_node.index);
                 }
+                ranges[g.node(q_nid)->output(0)->id()] = range;
             }
+            else
+            {
+                desc.data_type  = DataType::QASYMM8;
+                desc.quant_info = range.quantization_info();
+            }
+        }
+    }
+}
+
+/** Quantizes the constant tensors when they are loaded, from the float values given by their accessors
+ *
+ * @param[in,out] g Graph to update the accessors of
+ */
+void quantize_const_accessors(Graph &g)
+{
+    for(const auto &node_id : g.nodes(NodeType::Const))
+    {
+        Tensor *tensor = g.node(node_id)->output(0);
+        if(tensor != nullptr && tensor->accessor() != nullptr && dynamic_cast<QuantizingAccessor *>(tensor->accessor()) == nullptr)
+        {
+            tensor->set_accessor(std::make_unique<QuantizingAccessor>(tensor->extract_accessor()));
         }
     }
 }
 } // namespace
 
+SyntheticDataTypeMutator::SyntheticDataTypeMutator(std::string quant_table_file)
+    : _quant_table_file(std::move(quant_table_file))
+{
+}
+
 const char *SyntheticDataTypeMutator::name()
 {
     return "SyntheticDataTypeMutator";
@@ -244,7 +640,32 @@ IGraphMutator::MutationType SyntheticDataTypeMutator::type() const
 
 void SyntheticDataTypeMutator::mutate(Graph &g)
 {
-    if(is_mutation_supported(g))
+    if(is_mutation_supported(g) && !_quant_table_file.empty())
+    {
+        if(!QuantizationTable::get().load(_quant_table_file))
+        {
+            ARM_COMPUTE_ERROR_VAR("Could not read the quantization table %s", _quant_table_file.c_str());
+        }
+
+        // Keys are taken before the layers get removed
+        std::map<TensorID, std::string> keys = tensor_keys(g);
+
+        // Fold batch normalizations into the weights, remove the others
+        fold_batch_normalizations(g, keys);
+        remove_optimized_nodes(g);
+        alias_clamping_activations(g, keys);
+
+        // Quantize tensors
+        quantize_tensors(g, keys);
+        convert_special_tensors(g);
+
+        // Handle special nodes
+        handle_nodes_with_bias(g);
+
+        // Quantize the loaded weights
+        quantize_const_accessors(g);
+    }
+    else if(is_mutation_supported(g))
     {
         // Remove nodes that get optimized out (e.g. BatchNorm)
         remove_optimized_nodes(g);
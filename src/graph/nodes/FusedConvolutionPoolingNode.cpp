@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/FusedConvolutionPoolingNode.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
+#include "arm_compute/graph/nodes/PoolingLayerNode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+FusedConvolutionPoolingNode::FusedConvolutionPoolingNode(PadStrideInfo info, PoolingLayerInfo pool_info,
+                                                         float               epsilon,
+                                                         ConvolutionMethod   method,
+                                                         FastMathHint        fast_math_hint,
+                                                         ActivationLayerInfo fused_activation)
+    : _info(std::move(info)), _pool_info(std::move(pool_info)), _epsilon(epsilon), _method(method), _fast_math_hint(fast_math_hint), _fused_activation(fused_activation)
+{
+    _input_edges.resize(7, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+PoolingLayerInfo FusedConvolutionPoolingNode::pooling_info() const
+{
+    return _pool_info;
+}
+
+float FusedConvolutionPoolingNode::epsilon() const
+{
+    return _epsilon;
+}
+
+ActivationLayerInfo FusedConvolutionPoolingNode::fused_activation() const
+{
+    return _fused_activation;
+}
+
+void FusedConvolutionPoolingNode::set_fused_activation(ActivationLayerInfo fused_activation)
+{
+    _fused_activation = fused_activation;
+}
+
+void FusedConvolutionPoolingNode::set_convolution_method(ConvolutionMethod method)
+{
+    _method = method;
+}
+
+ConvolutionMethod FusedConvolutionPoolingNode::convolution_method() const
+{
+    return _method;
+}
+
+void FusedConvolutionPoolingNode::set_fast_math_hint(FastMathHint hint)
+{
+    _fast_math_hint = hint;
+}
+
+FastMathHint FusedConvolutionPoolingNode::fast_math_hint() const
+{
+    return _fast_math_hint;
+}
+
+PadStrideInfo FusedConvolutionPoolingNode::convolution_info() const
+{
+    return _info;
+}
+
+TensorDescriptor FusedConvolutionPoolingNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                                        const TensorDescriptor &weights_descriptor,
+                                                                        const PadStrideInfo    &info,
+                                                                        const PoolingLayerInfo &pool_info)
+{
+    const TensorDescriptor conv_descriptor = ConvolutionLayerNode::compute_output_descriptor(input_descriptor, weights_descriptor, info);
+    return PoolingLayerNode::compute_output_descriptor(conv_descriptor, pool_info);
+}
+
+bool FusedConvolutionPoolingNode::forward_descriptors()
+{
+    if((input_id(0) != NullTensorID) && (input_id(1) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor FusedConvolutionPoolingNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    const Tensor *src     = input(0);
+    const Tensor *weights = input(1);
+
+    ARM_COMPUTE_ERROR_ON(src == nullptr || weights == nullptr);
+
+    return compute_output_descriptor(src->desc(), weights->desc(), _info, _pool_info);
+}
+
+NodeType FusedConvolutionPoolingNode::type() const
+{
+    return FusedConvolutionPoolingNode::node_type;
+}
+
+void FusedConvolutionPoolingNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
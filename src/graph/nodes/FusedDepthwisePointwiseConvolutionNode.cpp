@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/FusedDepthwisePointwiseConvolutionNode.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
+#include "arm_compute/graph/nodes/DepthwiseConvolutionLayerNode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+FusedDepthwisePointwiseConvolutionNode::FusedDepthwisePointwiseConvolutionNode(PadStrideInfo       dwc_info,
+                                                                               float               dwc_epsilon,
+                                                                               ActivationLayerInfo dwc_fused_activation,
+                                                                               float               pwc_epsilon,
+                                                                               ActivationLayerInfo pwc_fused_activation)
+    : _dwc_info(std::move(dwc_info)), _dwc_epsilon(dwc_epsilon), _dwc_fused_activation(dwc_fused_activation), _pwc_epsilon(pwc_epsilon), _pwc_fused_activation(pwc_fused_activation)
+{
+    _input_edges.resize(pointwise_weights_idx + 6, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+PadStrideInfo FusedDepthwisePointwiseConvolutionNode::depthwise_convolution_info() const
+{
+    return _dwc_info;
+}
+
+float FusedDepthwisePointwiseConvolutionNode::depthwise_epsilon() const
+{
+    return _dwc_epsilon;
+}
+
+ActivationLayerInfo FusedDepthwisePointwiseConvolutionNode::depthwise_fused_activation() const
+{
+    return _dwc_fused_activation;
+}
+
+float FusedDepthwisePointwiseConvolutionNode::pointwise_epsilon() const
+{
+    return _pwc_epsilon;
+}
+
+ActivationLayerInfo FusedDepthwisePointwiseConvolutionNode::pointwise_fused_activation() const
+{
+    return _pwc_fused_activation;
+}
+
+void FusedDepthwisePointwiseConvolutionNode::set_pointwise_fused_activation(ActivationLayerInfo fused_activation)
+{
+    _pwc_fused_activation = fused_activation;
+}
+
+TensorDescriptor FusedDepthwisePointwiseConvolutionNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
+                                                                                   const TensorDescriptor &dwc_weights_descriptor,
+                                                                                   const TensorDescriptor &pwc_weights_descriptor,
+                                                                                   const PadStrideInfo    &dwc_info)
+{
+    const TensorDescriptor dwc_descriptor = DepthwiseConvolutionLayerNode::compute_output_descriptor(input_descriptor, dwc_weights_descriptor, dwc_info);
+    return ConvolutionLayerNode::compute_output_descriptor(dwc_descriptor, pwc_weights_descriptor, PadStrideInfo(1, 1, 0, 0));
+}
+
+bool FusedDepthwisePointwiseConvolutionNode::forward_descriptors()
+{
+    if((input_id(0) != NullTensorID) && (input_id(1) != NullTensorID) && (input_id(7) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor FusedDepthwisePointwiseConvolutionNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    const Tensor *src         = input(0);
+    const Tensor *dwc_weights = input(1);
+    const Tensor *pwc_weights = input(pointwise_weights_idx);
+
+    ARM_COMPUTE_ERROR_ON(src == nullptr || dwc_weights == nullptr || pwc_weights == nullptr);
+
+    return compute_output_descriptor(src->desc(), dwc_weights->desc(), pwc_weights->desc(), _dwc_info);
+}
+
+NodeType FusedDepthwisePointwiseConvolutionNode::type() const
+{
+    return FusedDepthwisePointwiseConvolutionNode::node_type;
+}
+
+void FusedDepthwisePointwiseConvolutionNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
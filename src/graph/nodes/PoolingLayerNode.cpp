@@ -44,6 +44,11 @@ PoolingLayerInfo PoolingLayerNode::pooling_info() const
     return _info;
 }
 
+void PoolingLayerNode::set_data_layout(DataLayout data_layout)
+{
+    _info.data_layout = data_layout;
+}
+
 TensorDescriptor PoolingLayerNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                              PoolingLayerInfo        info)
 {
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/nodes/TiledLayerChainNode.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/INodeVisitor.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
+#include "arm_compute/graph/nodes/PoolingLayerNode.h"
+
+namespace arm_compute
+{
+namespace graph
+{
+TiledLayerChainNode::TiledLayerChainNode(std::vector<descriptors::TiledLayerDescriptor> layers)
+    : _layers(std::move(layers))
+{
+    _input_edges.resize(1 + _layers.size() * num_layer_inputs, EmptyEdgeID);
+    _outputs.resize(1, NullTensorID);
+}
+
+const std::vector<descriptors::TiledLayerDescriptor> &TiledLayerChainNode::layers() const
+{
+    return _layers;
+}
+
+size_t TiledLayerChainNode::layer_input_idx(size_t layer, size_t idx)
+{
+    ARM_COMPUTE_ERROR_ON(idx >= num_layer_inputs);
+    return 1 + layer * num_layer_inputs + idx;
+}
+
+bool TiledLayerChainNode::forward_descriptors()
+{
+    if((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
+    {
+        for(size_t i = 0; i < _layers.size(); ++i)
+        {
+            if(_layers[i].type == NodeType::ConvolutionLayer && input_id(layer_input_idx(i, 0)) == NullTensorID)
+            {
+                return false;
+            }
+        }
+
+        Tensor *dst = output(0);
+        ARM_COMPUTE_ERROR_ON(dst == nullptr);
+        dst->desc() = configure_output(0);
+        return true;
+    }
+    return false;
+}
+
+TensorDescriptor TiledLayerChainNode::configure_output(size_t idx) const
+{
+    ARM_COMPUTE_UNUSED(idx);
+    const Tensor *src = input(0);
+    ARM_COMPUTE_ERROR_ON(src == nullptr);
+
+    TensorDescriptor desc = src->desc();
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        switch(_layers[i].type)
+        {
+            case NodeType::ConvolutionLayer:
+            {
+                const Tensor *weights = input(layer_input_idx(i, 0));
+                ARM_COMPUTE_ERROR_ON(weights == nullptr);
+                desc = ConvolutionLayerNode::compute_output_descriptor(desc, weights->desc(), _layers[i].conv_info);
+                break;
+            }
+            case NodeType::PoolingLayer:
+                desc = PoolingLayerNode::compute_output_descriptor(desc, _layers[i].pool_info);
+                break;
+            case NodeType::ActivationLayer:
+            case NodeType::NormalizationLayer:
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Layer type not supported in a tiled layer chain");
+        }
+    }
+    return desc;
+}
+
+NodeType TiledLayerChainNode::type() const
+{
+    return TiledLayerChainNode::node_type;
+}
+
+void TiledLayerChainNode::accept(INodeVisitor &v)
+{
+    v.visit(*this);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -41,6 +41,11 @@
 #include <system_error>
 #include <thread>
 
+#if !defined(__APPLE__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* !defined(__APPLE__) */
+
 namespace arm_compute
 {
 namespace
@@ -143,6 +148,15 @@ public:
     /** Function ran by the worker thread. */
     void worker_thread();
 
+    /** Kernel thread id of the worker thread
+     *
+     * @return Thread id, -1 if the worker has not started yet or ids are not available on the platform
+     */
+    int tid() const
+    {
+        return _tid.load(std::memory_order_relaxed);
+    }
+
 private:
     std::thread                        _thread{};
     ThreadInfo                         _info{};
@@ -154,6 +168,7 @@ private:
     bool                               _job_complete{ true };
     std::exception_ptr                 _current_exception{ nullptr };
     int                                _core_pin{ -1 };
+    std::atomic<int>                   _tid{ -1 };
 };
 
 Thread::Thread(int core_pin)
@@ -202,6 +217,9 @@ void Thread::wait()
 void Thread::worker_thread()
 {
     set_thread_affinity(_core_pin);
+#if !defined(__APPLE__)
+    _tid.store(static_cast<int>(syscall(SYS_gettid)), std::memory_order_relaxed);
+#endif /* !defined(__APPLE__) */
 
     while(true)
     {
@@ -311,6 +329,19 @@ unsigned int CPPScheduler::num_threads() const
     return _impl->num_threads();
 }
 
+std::vector<int> CPPScheduler::worker_thread_ids() const
+{
+    std::vector<int> ids;
+    for(const auto &thread : _impl->_threads)
+    {
+        if(thread.tid() != -1)
+        {
+            ids.push_back(thread.tid());
+        }
+    }
+    return ids;
+}
+
 #ifndef DOXYGEN_SKIP_THIS
 void CPPScheduler::run_workloads(std::vector<IScheduler::Workload> &workloads)
 {
@@ -55,6 +55,11 @@ void IScheduler::set_num_threads_with_affinity(unsigned int num_threads, arm_com
     ARM_COMPUTE_ERROR("Feature for affinity setting is not implemented");
 }
 
+std::vector<int> IScheduler::worker_thread_ids() const
+{
+    return {};
+}
+
 unsigned int IScheduler::num_threads_hint() const
 {
     return _num_threads_hint;
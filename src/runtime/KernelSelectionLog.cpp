@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/KernelSelectionLog.h"
+
+#include <utility>
+
+namespace arm_compute
+{
+namespace
+{
+thread_local bool                     is_recording = false;
+thread_local std::vector<std::string> kernel_names{};
+} // namespace
+
+void KernelSelectionLog::start()
+{
+    kernel_names.clear();
+    is_recording = true;
+}
+
+std::vector<std::string> KernelSelectionLog::stop()
+{
+    is_recording = false;
+    return std::move(kernel_names);
+}
+
+void KernelSelectionLog::record(const std::string &kernel_name)
+{
+    if(is_recording)
+    {
+        kernel_names.push_back(kernel_name);
+    }
+}
+} // namespace arm_compute
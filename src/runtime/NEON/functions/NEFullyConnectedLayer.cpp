@@ -28,6 +28,7 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
+#include "arm_compute/runtime/KernelSelectionLog.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "src/core/NEON/kernels/NEConvertFullyConnectedWeightsKernel.h"
 #include "src/core/NEON/kernels/NEConvertQuantizedSignednessKernel.h"
@@ -39,6 +40,7 @@
 #include "src/core/NEON/kernels/NEGEMMMatrixAdditionKernel.h"
 #include "src/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
 #include "src/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
+#include "src/core/NEON/kernels/NEGEMVKernel.h"
 #include "src/core/NEON/kernels/NETransposeKernel.h"
 
 #include <algorithm>
@@ -111,6 +113,18 @@ Status get_gemmlowp_output_stage_info(const ITensorInfo *input, const ITensorInf
     return Status{};
 }
 
+// Check if the layer multiplies a single F32 input vector, which NEGEMVKernel computes faster than a GEMM
+bool is_gemv(const ITensorInfo *input, const ITensorInfo *output)
+{
+    return input->data_type() == DataType::F32 && output->tensor_shape().total_size_upper(1) == 1;
+}
+
+// Get the data type NEGEMVKernel stores the weights in
+DataType get_gemv_weights_type(const FullyConnectedLayerInfo &fc_info)
+{
+    return fc_info.gemv_weights_type == DataType::UNKNOWN ? DataType::F32 : fc_info.gemv_weights_type;
+}
+
 Status validate_mm(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const ActivationLayerInfo &act)
 {
     if(is_data_type_quantized_asymmetric(input->data_type()))
@@ -158,14 +172,30 @@ NEFullyConnectedLayer::~NEFullyConnectedLayer() = default;
 
 NEFullyConnectedLayer::NEFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager, IWeightsManager *weights_manager)
     : _memory_group(std::move(memory_manager)), _weights_manager(weights_manager), _flatten(), _convert_weights(), _convert_weights_managed(), _reshape_weights_function(),
-      _reshape_weights_managed_function(), _mm_gemm(nullptr, weights_manager), _mm_gemmlowp(nullptr, weights_manager), _flatten_output(), _converted_weights_output(), _reshape_weights_output(),
-      _original_weights(nullptr), _are_weights_converted(true), _are_weights_reshaped(false), _is_fc_after_conv(false), _is_quantized_asymmetric(false), _is_prepared(false)
+      _reshape_weights_managed_function(), _mm_gemm(nullptr, weights_manager), _mm_gemmlowp(nullptr, weights_manager), _gemv_kernel(), _gemv_weights(), _gemv_activation(), _flatten_output(),
+      _converted_weights_output(), _reshape_weights_output(), _original_weights(nullptr), _gemv_weights_source(nullptr), _gemv_weights_type(DataType::F32), _are_weights_converted(true),
+      _are_weights_reshaped(false), _is_fc_after_conv(false), _is_quantized_asymmetric(false), _is_gemv(false), _run_gemv_activation(false), _is_prepared(false)
 {
 }
 
 void NEFullyConnectedLayer::configure_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act)
 {
-    if(_is_quantized_asymmetric)
+    if(_is_gemv)
+    {
+        // The weights are packed from their GEMM layout at prepare time
+        _gemv_weights_source = weights;
+        _gemv_weights        = std::make_unique<GEMVPackedWeights>();
+        _gemv_kernel         = std::make_unique<NEGEMVKernel>();
+        _gemv_kernel->configure(input, _gemv_weights.get(), biases, output, _gemv_weights_type);
+        KernelSelectionLog::record(std::string(_gemv_kernel->name()) + " " + string_from_data_type(_gemv_weights_type));
+
+        _run_gemv_activation = act.enabled();
+        if(_run_gemv_activation)
+        {
+            _gemv_activation.configure(output, nullptr, act);
+        }
+    }
+    else if(_is_quantized_asymmetric)
     {
         // Since we need negative offsets for computing convolution, we need to change QuantizationInfo()
         // Extract and negate input and weights offset
@@ -243,9 +273,12 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
     _are_weights_reshaped    = fc_info.transpose_weights ? fc_info.are_weights_reshaped : true;
     _is_fc_after_conv        = true;
     _is_quantized_asymmetric = is_data_type_quantized_asymmetric(input->info()->data_type());
+    _is_gemv                 = is_gemv(input->info(), output->info());
+    _gemv_weights_type       = get_gemv_weights_type(fc_info);
     _original_weights        = weights;
 
-    if(_weights_manager)
+    // The packed GEMV weights are owned by the function, so the weights are not shared through the weights manager
+    if(_weights_manager && !_is_gemv)
     {
         _weights_manager->manage(weights);
     }
@@ -397,8 +430,21 @@ Status NEFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorIn
         // Fully Connected layer after a Fully Connected Layer without batches
         ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(0) != weights_to_use->dimension(1));
     }
-    // Validate matrix multiply kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(input_to_use, weights_to_use, biases, output, fc_info.activation_info));
+    if(is_gemv(input, output))
+    {
+        // Validate matrix vector multiply kernel
+        ARM_COMPUTE_RETURN_ERROR_ON(weights_to_use->dimension(0) != output->dimension(0));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEGEMVKernel::validate(input_to_use, biases, output, get_gemv_weights_type(fc_info)));
+        if(fc_info.activation_info.enabled())
+        {
+            ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, fc_info.activation_info));
+        }
+    }
+    else
+    {
+        // Validate matrix multiply kernel
+        ARM_COMPUTE_RETURN_ON_ERROR(validate_mm(input_to_use, weights_to_use, biases, output, fc_info.activation_info));
+    }
 
     return Status{};
 }
@@ -416,7 +462,15 @@ void NEFullyConnectedLayer::run()
     }
 
     // Run matrix multiply
-    if(_is_quantized_asymmetric)
+    if(_is_gemv)
+    {
+        NEScheduler::get().schedule(_gemv_kernel.get(), Window::DimX);
+        if(_run_gemv_activation)
+        {
+            _gemv_activation.run();
+        }
+    }
+    else if(_is_quantized_asymmetric)
     {
         _mm_gemmlowp.run();
     }
@@ -488,8 +542,14 @@ void NEFullyConnectedLayer::prepare()
         // Release reshaped weights if unused
         release_unused(&_reshape_weights_output);
 
+        // Pack the weights of the matrix vector multiply and release the GEMM ones
+        if(_is_gemv)
+        {
+            NEGEMVKernel::pack_weights(_gemv_weights_source, _gemv_weights_type, *_gemv_weights);
+            _gemv_weights_source->mark_as_unused();
+        }
         // Prepare GEMM prepare and release unused weights
-        if(!_is_quantized_asymmetric)
+        else if(!_is_quantized_asymmetric)
         {
             _mm_gemm.prepare();
         }
@@ -23,6 +23,7 @@
  */
 #include "src/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
 
+#include "arm_compute/runtime/KernelSelectionLog.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/NEON/kernels/assembly/NEGEMMAssemblyWrapperKernel.h"
@@ -471,6 +472,7 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::configure(const ITensor *a, c
     arm_gemm::GemmConfig gemm_cfg;
     _kernel_info     = arm_gemm::get_gemm_method<TypeInput, TypeOutput, OutputStage>(args, os);
     _weights_manager = weights_manager;
+    KernelSelectionLog::record(_kernel_info.name);
     if(_kernel_info.method != arm_gemm::GemmMethod::GEMV_BATCHED)
     {
         gemm_cfg.filter = _kernel_info.name;
@@ -655,10 +657,16 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::run()
     prepare();
 
     // Setup up matrix bias in the assembly kernel, it's just a pointer to matrix C.
-    TypeOutput *bias = nullptr;
+    TypeOutput *bias              = nullptr;
+    int         multi_stride_bias = 0;
     if(_c && _c->info()->data_type() != DataType::S32)
     {
         bias = reinterpret_cast<TypeOutput *>(_c->buffer() + _c->info()->offset_first_element_in_bytes());
+        // A 2D bias holds one row per multi (e.g. one per group of a grouped convolution)
+        if(_c->info()->num_dimensions() > 1)
+        {
+            multi_stride_bias = _c->info()->strides_in_bytes().y() / sizeof(TypeOutput);
+        }
     }
 
     if(_gemm_info.method == AsmConvMethod::Indirect)
@@ -673,7 +681,7 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::run()
     _gemm_kernel_asm->set_arrays(in0_ptr, lda, batch_stride_a, multi_stride_a,
                                  in1_ptr, ldb, multi_stride_b,
                                  out_ptr, ldd, batch_stride_d, multi_stride_d,
-                                 bias, 0);
+                                 bias, multi_stride_bias);
     // Schedule
     NEScheduler::get().schedule(_optimised_kernel.get(), scheduling_hint);
 }
@@ -90,7 +90,7 @@ NEGEMMConv2d::NEGEMMConv2d(const std::shared_ptr<IMemoryManager> &memory_manager
 
 NEGEMMConv2d::~NEGEMMConv2d() = default;
 
-void NEGEMMConv2d::configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const Conv2dInfo &info)
+void NEGEMMConv2d::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const Conv2dInfo &info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
     ARM_COMPUTE_ERROR_THROW_ON(NEGEMMConv2d::validate(input->info(),
@@ -169,6 +169,13 @@ void NEGEMMConv2d::prepare()
         _permuted_weights.allocator()->allocate();
         _weights_permute_func.run();
         _original_weights->mark_as_unused();
+
+        // Once pretransposed by the assembly GEMM the permuted weights are not needed anymore
+        _gemm_asm_func->prepare();
+        if(!_permuted_weights.is_used())
+        {
+            _permuted_weights.allocator()->free();
+        }
         _is_prepared = true;
     }
 }
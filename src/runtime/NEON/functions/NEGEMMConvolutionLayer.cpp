@@ -109,8 +109,8 @@ NEGEMMConvolutionLayer::~NEGEMMConvolutionLayer() = default;
 
 NEGEMMConvolutionLayer::NEGEMMConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager, IWeightsManager *weights_manager)
     : _memory_group(memory_manager), _weights_manager(weights_manager), _reshape_weights(), _reshape_weights_managed(), _im2col_kernel(), _mm_gemm(memory_manager), _mm_gemmlowp(memory_manager),
-      _col2im_kernel(), _reshape_layer(), _original_weights(nullptr), _original_output(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _gemm_output_3d(), _tmp_output(),
-      _data_layout(DataLayout::NCHW), _skip_im2col(false), _skip_col2im(false), _is_quantized(false), _is_prepared(false)
+      _col2im_kernel(), _reshape_layer(), _indirect_conv(memory_manager), _original_weights(nullptr), _original_output(nullptr), _im2col_output(), _weights_reshaped(), _gemm_output(), _gemm_output_3d(),
+      _tmp_output(), _data_layout(DataLayout::NCHW), _skip_im2col(false), _skip_col2im(false), _run_indirect(false), _is_quantized(false), _is_prepared(false)
 {
 }
 
@@ -255,6 +255,26 @@ Status NEGEMMConvolutionLayer::validate_gemm3d(const ITensorInfo *input_info, co
     return validate_mm(&dummy_input_info, &dummy_weights_info, nullptr, &dummy_output_info, act_info, gemm_3d_depth, skip_im2col);
 }
 
+Status NEGEMMConvolutionLayer::validate_indirect(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                                 const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info)
+{
+    const DataLayout data_layout = input->data_layout();
+    const bool       is_1x1      = weights->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH)) == 1
+                                   && weights->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT)) == 1 && conv_info.stride() == std::make_pair(1U, 1U);
+
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(data_layout != DataLayout::NHWC, "Indirect convolution needs the channels innermost");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_1x1, "1x1 convolutions do not need an im2col");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dilation != Size2D(1U, 1U), "Dilation is not supported by the indirect assembly GEMM");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.retain_internal_weights(), "Weights reshaped by another function are not supported");
+    // The pointers of the rows are computed from the row stride of the first pixel, rows must be contiguous
+    ARM_COMPUTE_RETURN_ERROR_ON(input->padding().top != 0 || input->padding().bottom != 0);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(output->total_size() == 0, "Output must be initialized");
+    ARM_COMPUTE_RETURN_ERROR_ON(output->padding().top != 0 || output->padding().bottom != 0);
+
+    return NEGEMMConv2d::validate(input, weights, biases, output, Conv2dInfo(conv_info, dilation, act_info, false, 1));
+}
+
 void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info,
                                        const Size2D &dilation, const ActivationLayerInfo &act_info, unsigned int num_groups)
 {
@@ -270,6 +290,13 @@ void NEGEMMConvolutionLayer::configure(const ITensor *input, const ITensor *weig
                                                                 act_info,
                                                                 num_groups));
 
+    _run_indirect = bool(validate_indirect(input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), conv_info, weights_info, dilation, act_info));
+    if(_run_indirect)
+    {
+        _indirect_conv.configure(input, weights, biases, output, Conv2dInfo(conv_info, dilation, act_info, false, 1));
+        return;
+    }
+
     const DataType   data_type   = input->info()->data_type();
     const DataLayout data_layout = input->info()->data_layout();
     const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
@@ -433,6 +460,11 @@ Status NEGEMMConvolutionLayer::validate(const ITensorInfo *input, const ITensorI
     ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_groups > 1, "Grouping (num_groups != 1) is not supported on Neon");
 
+    if(bool(validate_indirect(input, weights, biases, output, conv_info, weights_info, dilation, act_info)))
+    {
+        return Status{};
+    }
+
     const DataLayout data_layout = input->data_layout();
     const DataType   data_type   = input->data_type();
     const int        idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
@@ -567,6 +599,12 @@ void NEGEMMConvolutionLayer::run()
 {
     prepare();
 
+    if(_run_indirect)
+    {
+        _indirect_conv.run();
+        return;
+    }
+
     MemoryGroupResourceScope scope_mg(_memory_group);
 
     bool out_has_padding = _skip_col2im && (_original_output->info()->padding().bottom != 0 || _original_output->info()->padding().top != 0);
@@ -619,6 +657,13 @@ void NEGEMMConvolutionLayer::prepare()
 {
     if(!_is_prepared)
     {
+        if(_run_indirect)
+        {
+            _indirect_conv.prepare();
+            _is_prepared = true;
+            return;
+        }
+
         if(_weights_manager && _weights_manager->are_weights_managed(_original_weights))
         {
             _weights_manager->run(_original_weights, &_reshape_weights_managed);
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEGEMMGroupedConvolutionLayer.h"
+
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/NEON/kernels/NECol2ImKernel.h"
+#include "src/core/NEON/kernels/NEIm2ColKernel.h"
+#include "src/core/NEON/kernels/NEWeightsReshapeKernel.h"
+#include "src/runtime/NEON/functions/NEGEMMAssemblyDispatch.h"
+
+#include <tuple>
+
+namespace arm_compute
+{
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+/** Views a compact [X, Y, num_groups, batches] matrix as [X, Y, batches, num_groups], where the assembly GEMM expects its multis, without moving any data */
+TensorInfo groups_as_multis(const TensorShape &shape, DataType data_type)
+{
+    const size_t element_size = data_size_from_type(data_type);
+    const size_t plane_size   = shape[0] * shape[1] * element_size;
+    const size_t num_batches  = shape.total_size_upper(3);
+
+    TensorInfo info;
+    info.init(TensorShape(shape[0], shape[1], num_batches, shape[2]), 1, data_type,
+              Strides(element_size, shape[0] * element_size, plane_size * shape[2], plane_size), 0, plane_size * shape.total_size_upper(2));
+    return info;
+}
+
+/** Views the weights with the output channels split per group as [kernel_x, kernel_y, IFM / num_groups, OFM / num_groups, num_groups], keeping their strides so padded weights are read in place */
+TensorInfo grouped_weights_info(const ITensorInfo &weights, unsigned int num_groups)
+{
+    TensorShape shape = weights.tensor_shape();
+    shape.set(3, weights.dimension(3) / num_groups);
+    shape.set(4, num_groups);
+
+    Strides strides = weights.strides_in_bytes();
+    strides.set(4, weights.strides_in_bytes()[3] * shape[3]);
+
+    size_t total_size = weights.element_size();
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        total_size += (shape[d] - 1) * strides[d];
+    }
+
+    TensorInfo info;
+    info.init(shape, 1, weights.data_type(), strides, 0, total_size);
+    info.set_data_layout(weights.data_layout());
+    return info;
+}
+
+AsmGemmInfo init_assembly_metadata(const ActivationLayerInfo &act_info, bool enable_fast_math)
+{
+    ARM_COMPUTE_UNUSED(enable_fast_math);
+
+    // The assembly GEMM of this release has no reduced precision mode: fast math has nothing to select for a grouped convolution
+    AsmGemmInfo asm_info;
+    asm_info.method = AsmConvMethod::Im2Col;
+    if(NEGEMMAssemblyDispatch::is_activation_supported(act_info))
+    {
+        asm_info.activation_info = act_info;
+    }
+    return asm_info;
+}
+} // namespace
+
+NEGEMMGroupedConvolutionLayer::NEGEMMGroupedConvolutionLayer(const std::shared_ptr<IMemoryManager> &memory_manager)
+    : _memory_group(memory_manager), _im2col_kernel(), _weights_reshape_kernel(), _gemm_asm_func(std::make_unique<NEGEMMAssemblyDispatch>(memory_manager)), _col2im_kernel(), _activation_func(),
+      _original_weights(nullptr), _original_biases(nullptr), _num_groups(1), _weights_grouped(), _weights_reshaped(), _biases_grouped(), _im2col_output(), _gemm_input(), _gemm_output(), _col2im_input(),
+      _data_layout(DataLayout::NCHW), _run_activation(false), _is_prepared(false)
+{
+}
+
+NEGEMMGroupedConvolutionLayer::~NEGEMMGroupedConvolutionLayer() = default;
+
+void NEGEMMGroupedConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                              const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NEGEMMGroupedConvolutionLayer::validate(input->info(),
+                                                                       weights->info(),
+                                                                       biases != nullptr ? biases->info() : nullptr,
+                                                                       output->info(),
+                                                                       conv_info,
+                                                                       weights_info,
+                                                                       dilation,
+                                                                       act_info,
+                                                                       enable_fast_math,
+                                                                       num_groups));
+
+    const DataType     data_type   = input->info()->data_type();
+    const unsigned int idx_width   = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::WIDTH);
+    const unsigned int idx_height  = get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::HEIGHT);
+    const unsigned int kernel_w    = weights->info()->dimension(idx_width);
+    const unsigned int kernel_h    = weights->info()->dimension(idx_height);
+    const unsigned int ofm_a_group = weights->info()->dimension(3) / num_groups;
+
+    _data_layout      = input->info()->data_layout();
+    _original_weights = weights;
+    _original_biases  = biases;
+    _is_prepared      = false;
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(idx_width), input->info()->dimension(idx_height), kernel_w, kernel_h, conv_info, dilation);
+
+    // Reshape the weights of all the groups at once: the grouped view aliases the original weights in prepare()
+    _num_groups = num_groups;
+    _weights_grouped.allocator()->init(grouped_weights_info(*weights->info(), num_groups));
+    _weights_reshape_kernel = std::make_unique<NEWeightsReshapeKernel>();
+    _weights_reshape_kernel->configure(&_weights_grouped, nullptr, &_weights_reshaped);
+
+    // Each group adds its own row of biases
+    if(biases != nullptr)
+    {
+        _biases_grouped.allocator()->init(TensorInfo(TensorShape(ofm_a_group, num_groups), 1, biases->info()->data_type()));
+    }
+
+    // Im2col writes the patches of each group to its own plane
+    _memory_group.manage(&_im2col_output);
+    _im2col_kernel = std::make_unique<NEIm2ColKernel>();
+    _im2col_kernel->configure(input, &_im2col_output, Size2D(kernel_w, kernel_h), conv_info, false, dilation, num_groups);
+    _gemm_input.allocator()->init(groups_as_multis(_im2col_output.info()->tensor_shape(), data_type));
+
+    // One multi of the assembly GEMM per group
+    const TensorShape col2im_input_shape(ofm_a_group, conv_w * conv_h, num_groups, input->info()->tensor_shape().total_size_upper(3));
+    _gemm_output.allocator()->init(groups_as_multis(col2im_input_shape, data_type));
+    _col2im_input.allocator()->init(TensorInfo(col2im_input_shape, 1, data_type));
+    _memory_group.manage(&_gemm_output);
+
+    _gemm_asm_func->configure(&_gemm_input, &_weights_reshaped, biases != nullptr ? &_biases_grouped : nullptr, &_gemm_output, init_assembly_metadata(act_info, enable_fast_math));
+    ARM_COMPUTE_ERROR_ON_MSG(!_gemm_asm_func->is_configured(), "No assembly GEMM available for the grouped convolution");
+    _im2col_output.allocator()->allocate();
+
+    // Col2im interleaves the groups back into the output channels
+    _col2im_kernel = std::make_unique<NECol2ImKernel>();
+    _col2im_kernel->configure(&_col2im_input, output, Size2D(conv_w, conv_h), num_groups);
+    _gemm_output.allocator()->allocate();
+
+    _run_activation = act_info.enabled() && !NEGEMMAssemblyDispatch::is_activation_supported(act_info);
+    if(_run_activation)
+    {
+        _activation_func.configure(output, nullptr, act_info);
+    }
+}
+
+Status NEGEMMGroupedConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
+                                               const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(input, weights);
+    ARM_COMPUTE_RETURN_ERROR_ON(num_groups == 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.are_reshaped(), "Weights already reshaped are not supported for grouped convolutions!");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(weights_info.retain_internal_weights(), "Retaining the reshaped weights of another function is not supported for grouped convolutions!");
+
+    const DataLayout   data_layout = input->data_layout();
+    const unsigned int idx_width   = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_height  = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int idx_channel = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    const unsigned int kernel_w    = weights->dimension(idx_width);
+    const unsigned int kernel_h    = weights->dimension(idx_height);
+
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_channel) * num_groups != input->dimension(idx_channel));
+    ARM_COMPUTE_RETURN_ERROR_ON((weights->dimension(3) % num_groups) != 0);
+
+    const unsigned int ofm_a_group = weights->dimension(3) / num_groups;
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->dimension(0) != weights->dimension(3));
+        ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
+    }
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->dimension(idx_width), input->dimension(idx_height), kernel_w, kernel_h, conv_info, dilation);
+
+    // Validate weights reshape
+    const TensorInfo weights_grouped_info = grouped_weights_info(*weights, num_groups);
+    const TensorInfo weights_reshaped_info(compute_weights_reshaped_shape(weights_grouped_info, false), 1, input->data_type());
+    ARM_COMPUTE_RETURN_ON_ERROR(NEWeightsReshapeKernel::validate(&weights_grouped_info, nullptr, &weights_reshaped_info));
+
+    // Validate im2col
+    const TensorInfo im2col_info(compute_im2col_conv_shape(input, Size2D(kernel_w, kernel_h), conv_info, false, dilation, false, num_groups), 1, input->data_type());
+    ARM_COMPUTE_RETURN_ON_ERROR(NEIm2ColKernel::validate(input, &im2col_info, Size2D(kernel_w, kernel_h), conv_info, false, dilation, num_groups));
+
+    // Validate GEMM
+    const TensorShape col2im_input_shape(ofm_a_group, conv_w * conv_h, num_groups, input->tensor_shape().total_size_upper(3));
+    const TensorInfo  gemm_input_info  = groups_as_multis(im2col_info.tensor_shape(), input->data_type());
+    const TensorInfo  gemm_output_info = groups_as_multis(col2im_input_shape, input->data_type());
+    const TensorInfo  biases_grouped_info(TensorShape(ofm_a_group, num_groups), 1, input->data_type());
+    ARM_COMPUTE_RETURN_ON_ERROR(NEGEMMAssemblyDispatch::validate(&gemm_input_info, &weights_reshaped_info, biases != nullptr ? &biases_grouped_info : nullptr, &gemm_output_info,
+                                                                 init_assembly_metadata(act_info, enable_fast_math)));
+
+    // Validate col2im
+    const TensorInfo col2im_input_info(col2im_input_shape, 1, input->data_type());
+    ARM_COMPUTE_RETURN_ON_ERROR(NECol2ImKernel::validate(&col2im_input_info, output, Size2D(conv_w, conv_h), num_groups));
+
+    if(act_info.enabled() && !NEGEMMAssemblyDispatch::is_activation_supported(act_info))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, act_info));
+    }
+
+    return Status{};
+}
+
+void NEGEMMGroupedConvolutionLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    // The GEMM reads and writes the im2col and col2im buffers through views with the groups on the multi dimension
+    _gemm_input.allocator()->import_memory(_im2col_output.buffer());
+    _col2im_input.allocator()->import_memory(_gemm_output.buffer());
+
+    NEScheduler::get().schedule(_im2col_kernel.get(), get_data_layout_dimension_index(_data_layout, DataLayoutDimension::HEIGHT));
+    _gemm_asm_func->run();
+    NEScheduler::get().schedule(_col2im_kernel.get(), Window::DimY);
+
+    if(_run_activation)
+    {
+        _activation_func.run();
+    }
+
+    _gemm_input.allocator()->free();
+    _col2im_input.allocator()->free();
+}
+
+void NEGEMMGroupedConvolutionLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+        // Run weights reshaping of all the groups and mark original weights tensor as unused.
+        // The padding of the weights can grow after configure(), so the grouped view takes their final strides here
+        _weights_grouped.allocator()->init(grouped_weights_info(*_original_weights->info(), _num_groups));
+        _weights_grouped.allocator()->import_memory(_original_weights->buffer() + _original_weights->info()->offset_first_element_in_bytes());
+        _weights_reshaped.allocator()->allocate();
+        NEScheduler::get().schedule(_weights_reshape_kernel.get(), 3);
+        _weights_grouped.allocator()->free();
+        _original_weights->mark_as_unused();
+
+        if(_original_biases != nullptr)
+        {
+            _biases_grouped.allocator()->import_memory(_original_biases->buffer() + _original_biases->info()->offset_first_element_in_bytes());
+        }
+
+        // Prepare GEMM
+        _gemm_asm_func->prepare();
+        if(!_weights_reshaped.is_used())
+        {
+            _weights_reshaped.allocator()->free();
+        }
+
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
@@ -36,7 +36,7 @@ namespace arm_compute
 NENormalizationLayer::~NENormalizationLayer() = default;
 
 NENormalizationLayer::NENormalizationLayer(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _norm_kernel(), _multiply_f(), _input_squared()
+    : _memory_group(std::move(memory_manager)), _norm_kernel(), _multiply_f(), _input_squared(), _is_fused(false)
 {
 }
 
@@ -44,6 +44,16 @@ void NENormalizationLayer::configure(const ITensor *input, ITensor *output, cons
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
 
+    // CROSS_MAP squares the input inside the normalization kernel, no squared tensor is needed
+    _is_fused = is_fused(input->info(), output->info(), norm_info);
+
+    _norm_kernel = std::make_unique<NENormalizationLayerKernel>();
+    if(_is_fused)
+    {
+        _norm_kernel->configure(input, nullptr, output, norm_info);
+        return;
+    }
+
     TensorInfo tensor_info(input->info()->tensor_shape(), 1, input->info()->data_type());
     _input_squared.allocator()->init(tensor_info);
 
@@ -51,7 +61,6 @@ void NENormalizationLayer::configure(const ITensor *input, ITensor *output, cons
     _memory_group.manage(&_input_squared);
 
     // Configure kernels
-    _norm_kernel = std::make_unique<NENormalizationLayerKernel>();
     _norm_kernel->configure(input, &_input_squared, output, norm_info);
     _multiply_f.configure(input, input, &_input_squared, 1.0f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO);
 
@@ -64,6 +73,12 @@ Status NENormalizationLayer::validate(const ITensorInfo *input, const ITensorInf
     // Perform validation step
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
 
+    if(is_fused(input, output, norm_info))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NENormalizationLayerKernel::validate(input, nullptr, output, norm_info));
+        return Status{};
+    }
+
     ARM_COMPUTE_RETURN_ON_ERROR(NENormalizationLayerKernel::validate(input, input, output, norm_info));
     ARM_COMPUTE_RETURN_ON_ERROR(NEPixelWiseMultiplication::validate(input, input, output, 1.0f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO));
 
@@ -73,7 +88,15 @@ Status NENormalizationLayer::validate(const ITensorInfo *input, const ITensorInf
 void NENormalizationLayer::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
-    _multiply_f.run();
+    if(!_is_fused)
+    {
+        _multiply_f.run();
+    }
     NEScheduler::get().schedule(_norm_kernel.get(), Window::DimY);
 }
+
+bool NENormalizationLayer::is_fused(const ITensorInfo *input, const ITensorInfo *output, const NormalizationLayerInfo &norm_info)
+{
+    return norm_info.type() == NormType::CROSS_MAP && input != output;
+}
 }
\ No newline at end of file
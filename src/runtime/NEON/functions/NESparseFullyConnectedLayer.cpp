@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NESparseFullyConnectedLayer.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/KernelSelectionLog.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/NEON/kernels/NESparseGEMVKernel.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+using namespace arm_compute::misc::shape_calculator;
+
+namespace
+{
+/** Checks whether the input comes from a convolution and has to be flattened, as in @ref NEFullyConnectedLayer */
+bool is_fc_after_conv(const ITensorInfo &input, const ITensorInfo &output)
+{
+    const bool is_batched_fc_layer = output.dimension(1) > 1;
+    if(is_batched_fc_layer)
+    {
+        return (TensorShape::num_max_dimensions >= 4) && (std::equal(input.tensor_shape().cbegin() + 3, input.tensor_shape().cend(), output.tensor_shape().cbegin() + 1));
+    }
+    return input.num_dimensions() > 1;
+}
+} // namespace
+
+NESparseFullyConnectedLayer::~NESparseFullyConnectedLayer() = default;
+
+NESparseFullyConnectedLayer::NESparseFullyConnectedLayer(std::shared_ptr<IMemoryManager> memory_manager)
+    : _memory_group(std::move(memory_manager)), _flatten(), _sparse_gemv_kernel(), _packed_weights(), _activation_func(), _flatten_output(), _original_weights(nullptr), _block_height(1),
+      _weights_transposed(false), _is_fc_after_conv(false), _run_activation(false), _is_prepared(false)
+{
+}
+
+void NESparseFullyConnectedLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output,
+                                            FullyConnectedLayerInfo fc_info, unsigned int block_height)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_ERROR_THROW_ON(NESparseFullyConnectedLayer::validate(input->info(), weights->info(), biases != nullptr ? biases->info() : nullptr, output->info(), fc_info, block_height));
+
+    _original_weights   = weights;
+    _block_height       = block_height;
+    _weights_transposed = fc_info.transpose_weights ? fc_info.are_weights_reshaped : true;
+    _is_fc_after_conv   = is_fc_after_conv(*input->info(), *output->info());
+    _run_activation     = fc_info.activation_info.enabled();
+    _is_prepared        = false;
+
+    const ITensor *gemv_input = input;
+    if(_is_fc_after_conv)
+    {
+        _memory_group.manage(&_flatten_output);
+        _flatten_output.allocator()->init(input->info()->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_flatten_shape(input->info())));
+        _flatten.configure(input, &_flatten_output);
+        gemv_input = &_flatten_output;
+    }
+
+    _packed_weights     = std::make_unique<BlockSparseMatrix>();
+    _sparse_gemv_kernel = std::make_unique<NESparseGEMVKernel>();
+    _sparse_gemv_kernel->configure(gemv_input, _packed_weights.get(), biases, output, block_height);
+    KernelSelectionLog::record(std::string(_sparse_gemv_kernel->name()) + (block_height == 4 ? " 4x4" : " 1x4"));
+
+    if(_is_fc_after_conv)
+    {
+        _flatten_output.allocator()->allocate();
+    }
+
+    if(_run_activation)
+    {
+        _activation_func.configure(output, nullptr, fc_info.activation_info);
+    }
+}
+
+Status NESparseFullyConnectedLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output,
+                                             FullyConnectedLayerInfo fc_info, unsigned int block_height)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 2);
+    ARM_COMPUTE_RETURN_ERROR_ON(biases != nullptr && biases->num_dimensions() > 1);
+
+    const bool weights_transposed = fc_info.transpose_weights ? fc_info.are_weights_reshaped : true;
+    const bool after_conv         = is_fc_after_conv(*input, *output);
+
+    const unsigned int num_inputs  = weights_transposed ? weights->dimension(1) : weights->dimension(0);
+    const unsigned int num_outputs = weights_transposed ? weights->dimension(0) : weights->dimension(1);
+    ARM_COMPUTE_RETURN_ERROR_ON(num_outputs != output->dimension(0));
+
+    const ITensorInfo *gemv_input = input;
+    TensorInfo         flatten_output;
+    if(after_conv)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(input->data_layout() != fc_info.weights_trained_layout, "Weights trained in another data layout are not supported");
+        ARM_COMPUTE_RETURN_ERROR_ON(num_inputs != input->tensor_shape().total_size_lower(3));
+
+        flatten_output = input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_flatten_shape(input));
+        ARM_COMPUTE_RETURN_ON_ERROR(NEFlattenLayer::validate(input, &flatten_output));
+        gemv_input = &flatten_output;
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(num_inputs != input->dimension(0));
+    }
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NESparseGEMVKernel::validate(gemv_input, biases, output, block_height));
+
+    if(fc_info.activation_info.enabled())
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(NEActivationLayer::validate(output, nullptr, fc_info.activation_info));
+    }
+
+    return Status{};
+}
+
+float NESparseFullyConnectedLayer::density() const
+{
+    return _packed_weights != nullptr ? _packed_weights->density() : 0.f;
+}
+
+void NESparseFullyConnectedLayer::run()
+{
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_memory_group);
+
+    if(_is_fc_after_conv)
+    {
+        _flatten.run();
+    }
+
+    NEScheduler::get().schedule(_sparse_gemv_kernel.get(), Window::DimX);
+
+    if(_run_activation)
+    {
+        _activation_func.run();
+    }
+}
+
+void NESparseFullyConnectedLayer::prepare()
+{
+    if(!_is_prepared)
+    {
+        ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
+
+        // Pack the non-zero blocks and release the dense weights
+        NESparseGEMVKernel::pack_weights(_original_weights, _weights_transposed, _block_height, *_packed_weights);
+        _original_weights->mark_as_unused();
+
+        _is_prepared = true;
+    }
+}
+} // namespace arm_compute
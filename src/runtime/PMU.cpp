@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019 Arm Limited.
+ * Copyright (c) 2017-2021 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,7 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#include "PMU.h"
+#include "arm_compute/runtime/PMU.h"
 
 #include <asm/unistd.h>
 #include <cstring>
@@ -30,10 +30,6 @@
 
 namespace arm_compute
 {
-namespace test
-{
-namespace framework
-{
 PMU::PMU()
     : _perf_config()
 {
@@ -80,6 +76,25 @@ void PMU::open(const perf_event_attr &perf_config)
     }
 }
 
+bool PMU::open_thread(const perf_event_attr &perf_config, int tid)
+{
+    close();
+    _perf_config = perf_config;
+    _fd          = syscall(__NR_perf_event_open, &_perf_config, tid, -1, -1, 0);
+    if(_fd < 0)
+    {
+        _fd = -1;
+        return false;
+    }
+
+    if(ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0) == -1)
+    {
+        close();
+        return false;
+    }
+    return true;
+}
+
 void PMU::close()
 {
     if(_fd != -1)
@@ -97,6 +112,4 @@ void PMU::reset()
         ARM_COMPUTE_ERROR_VAR("Failed to reset PMU counter: %d", errno);
     }
 }
-} // namespace framework
-} // namespace test
 } // namespace arm_compute
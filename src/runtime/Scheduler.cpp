@@ -53,6 +53,9 @@ std::shared_ptr<IScheduler> Scheduler::_custom_scheduler = nullptr;
 
 namespace
 {
+/** Scheduler overriding the active one on the current thread */
+thread_local IScheduler *thread_scheduler = nullptr;
+
 std::map<Scheduler::Type, std::unique_ptr<IScheduler>> init()
 {
     std::map<Scheduler::Type, std::unique_ptr<IScheduler>> m;
@@ -94,8 +97,17 @@ Scheduler::Type Scheduler::get_type()
     return _scheduler_type;
 }
 
+void Scheduler::set_thread_scheduler(IScheduler *scheduler)
+{
+    thread_scheduler = scheduler;
+}
+
 IScheduler &Scheduler::get()
 {
+    if(thread_scheduler != nullptr)
+    {
+        return *thread_scheduler;
+    }
 
     if(_scheduler_type == Type::CUSTOM)
     {
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/benchmark/fixtures/ConvolutionLayerFixture.h"
+#include "tests/datasets/system_tests/alexnet/AlexNetConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/googlenet/inceptionv1/GoogLeNetInceptionV1ConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/mobilenet/MobileNetConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/resnet50/ResNet50ConvolutionLayerDataset.h"
+#include "tests/datasets/system_tests/squeezenet/SqueezeNetConvolutionLayerDataset.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+const auto data_types = framework::dataset::make("DataType", { DataType::F32,
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+                                                                   DataType::F16,
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+                                                                   DataType::QASYMM8
+                                                                 });
+const auto data_layouts = framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC });
+} // namespace
+
+using NEConvolutionLayerFixture = ConvolutionLayerFixture<Tensor, NEConvolutionLayer, Accessor>;
+
+TEST_SUITE(NEON)
+TEST_SUITE(ConvolutionLayer)
+REGISTER_FIXTURE_DATA_TEST_CASE(AlexNet, NEConvolutionLayerFixture, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::AlexNetConvolutionLayerDataset(), data_types), data_layouts));
+REGISTER_FIXTURE_DATA_TEST_CASE(MobileNet, NEConvolutionLayerFixture, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::MobileNetConvolutionLayerDataset(), data_types), data_layouts));
+REGISTER_FIXTURE_DATA_TEST_CASE(SqueezeNet, NEConvolutionLayerFixture, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SqueezeNetConvolutionLayerDataset(), data_types), data_layouts));
+REGISTER_FIXTURE_DATA_TEST_CASE(ResNet50, NEConvolutionLayerFixture, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::ResNet50ConvolutionLayerDataset(), data_types), data_layouts));
+REGISTER_FIXTURE_DATA_TEST_CASE(GoogLeNetInceptionV1, NEConvolutionLayerFixture, framework::DatasetMode::NIGHTLY, combine(combine(datasets::GoogLeNetInceptionV1ConvolutionLayerDataset(), data_types), data_layouts));
+TEST_SUITE_END() // ConvolutionLayer
+TEST_SUITE_END() // Neon
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "tests/benchmark/fixtures/GraphPipelineFixture.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "utils/TypePrinter.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace
+{
+// Run with --instruments=wall_clock_timer,scheduler_timer --log-format=json --log-file=<file> to get machine-readable results
+const auto threads = framework::dataset::make("Threads", { 1, 2, 4 });
+const auto layouts = framework::dataset::make("DataLayout", { DataLayout::NHWC });
+
+/** Every combination of cut points and stage orders with matching number of stages */
+std::vector<GraphPipelineConfig> pipelines(std::initializer_list<std::vector<unsigned int>> partitions)
+{
+    const std::vector<std::vector<std::string>> orders{ { "B", "L" }, { "B-L", "L-B" }, { "B-L-B", "L-B-L", "B-B-L", "L-L-B" } };
+
+    std::vector<GraphPipelineConfig> configs;
+    for(const auto &cuts : partitions)
+    {
+        for(const auto &order : orders.at(cuts.size()))
+        {
+            configs.push_back(GraphPipelineConfig{ cuts, order });
+        }
+    }
+    return configs;
+}
+
+template <typename Pipelines>
+auto sweep(GraphNetwork network, Pipelines &&pipelines_dataset)
+-> decltype(combine(combine(combine(framework::dataset::make("Network", { network }), std::forward<Pipelines>(pipelines_dataset)), threads), layouts))
+{
+    return combine(combine(combine(framework::dataset::make("Network", { network }), std::forward<Pipelines>(pipelines_dataset)), threads), layouts);
+}
+} // namespace
+
+using NEGraphPipelineFixture = GraphPipelineFixture;
+
+TEST_SUITE(NEON)
+TEST_SUITE(GraphPipeline)
+
+TEST_SUITE(AlexNet)
+REGISTER_FIXTURE_DATA_TEST_CASE(SingleStage, NEGraphPipelineFixture, framework::DatasetMode::PRECOMMIT,
+                                sweep(GraphNetwork::AlexNet, framework::dataset::make("Pipeline", pipelines({ {} }))));
+REGISTER_FIXTURE_DATA_TEST_CASE(Pipeline, NEGraphPipelineFixture, framework::DatasetMode::NIGHTLY,
+                                sweep(GraphNetwork::AlexNet, framework::dataset::make("Pipeline", pipelines({ { 1 }, { 2 }, { 5 }, { 1, 5 }, { 2, 5 } }))));
+TEST_SUITE_END() // AlexNet
+
+TEST_SUITE(GoogleNet)
+REGISTER_FIXTURE_DATA_TEST_CASE(SingleStage, NEGraphPipelineFixture, framework::DatasetMode::PRECOMMIT,
+                                sweep(GraphNetwork::GoogleNet, framework::dataset::make("Pipeline", pipelines({ {} }))));
+REGISTER_FIXTURE_DATA_TEST_CASE(Pipeline, NEGraphPipelineFixture, framework::DatasetMode::NIGHTLY,
+                                sweep(GraphNetwork::GoogleNet, framework::dataset::make("Pipeline", pipelines({ { 2 }, { 4 }, { 7 }, { 2, 6 }, { 4, 8 } }))));
+TEST_SUITE_END() // GoogleNet
+
+TEST_SUITE(MobileNet)
+REGISTER_FIXTURE_DATA_TEST_CASE(SingleStage, NEGraphPipelineFixture, framework::DatasetMode::PRECOMMIT,
+                                sweep(GraphNetwork::MobileNet, framework::dataset::make("Pipeline", pipelines({ {} }))));
+REGISTER_FIXTURE_DATA_TEST_CASE(Pipeline, NEGraphPipelineFixture, framework::DatasetMode::NIGHTLY,
+                                sweep(GraphNetwork::MobileNet, framework::dataset::make("Pipeline", pipelines({ { 3 }, { 7 }, { 11 }, { 3, 9 }, { 5, 11 } }))));
+TEST_SUITE_END() // MobileNet
+
+TEST_SUITE(ResNet50)
+REGISTER_FIXTURE_DATA_TEST_CASE(SingleStage, NEGraphPipelineFixture, framework::DatasetMode::PRECOMMIT,
+                                sweep(GraphNetwork::ResNet50, framework::dataset::make("Pipeline", pipelines({ {} }))));
+REGISTER_FIXTURE_DATA_TEST_CASE(Pipeline, NEGraphPipelineFixture, framework::DatasetMode::NIGHTLY,
+                                sweep(GraphNetwork::ResNet50, framework::dataset::make("Pipeline", pipelines({ { 4 }, { 8 }, { 14 }, { 4, 8 }, { 6, 14 } }))));
+TEST_SUITE_END() // ResNet50
+
+TEST_SUITE(SqueezeNet)
+REGISTER_FIXTURE_DATA_TEST_CASE(SingleStage, NEGraphPipelineFixture, framework::DatasetMode::PRECOMMIT,
+                                sweep(GraphNetwork::SqueezeNet, framework::dataset::make("Pipeline", pipelines({ {} }))));
+REGISTER_FIXTURE_DATA_TEST_CASE(Pipeline, NEGraphPipelineFixture, framework::DatasetMode::NIGHTLY,
+                                sweep(GraphNetwork::SqueezeNet, framework::dataset::make("Pipeline", pipelines({ { 2 }, { 4 }, { 8 }, { 2, 6 }, { 4, 8 } }))));
+TEST_SUITE_END() // SqueezeNet
+
+TEST_SUITE_END() // GraphPipeline
+TEST_SUITE_END() // NEON
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
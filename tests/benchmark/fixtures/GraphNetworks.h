@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_GRAPH_NETWORKS
+#define ARM_COMPUTE_TEST_GRAPH_NETWORKS
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph.h"
+
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+/** Networks of the graph benchmarks */
+enum class GraphNetwork
+{
+    AlexNet,
+    GoogleNet,
+    MobileNet,
+    ResNet50,
+    SqueezeNet
+};
+
+inline std::ostream &operator<<(std::ostream &os, GraphNetwork network)
+{
+    switch(network)
+    {
+        case GraphNetwork::AlexNet:
+            os << "AlexNet";
+            break;
+        case GraphNetwork::GoogleNet:
+            os << "GoogleNet";
+            break;
+        case GraphNetwork::MobileNet:
+            os << "MobileNet";
+            break;
+        case GraphNetwork::ResNet50:
+            os << "ResNet50";
+            break;
+        case GraphNetwork::SqueezeNet:
+            os << "SqueezeNet";
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unknown network");
+    }
+    return os;
+}
+
+namespace networks
+{
+/** Accessor zero-filling a tensor the first time it is called
+ *
+ * Keeps weights and inputs free of denormals without shipping trained parameters.
+ */
+class ZeroAccessor final : public graph::ITensorAccessor
+{
+public:
+    bool access_tensor(ITensor &tensor) override
+    {
+        if(!_filled)
+        {
+            std::memset(tensor.buffer(), 0, tensor.info()->total_size());
+            _filled = true;
+        }
+        return true;
+    }
+
+private:
+    bool _filled{ false };
+};
+
+inline graph::ITensorAccessorUPtr zeros()
+{
+    return std::make_unique<ZeroAccessor>();
+}
+
+/** A block of layers, the unit a network can be cut at */
+using GraphBlock = std::function<void(graph::frontend::IStream &)>;
+
+/** Input shape of a network in NCHW, batch 1 */
+inline TensorShape input_shape(GraphNetwork network)
+{
+    switch(network)
+    {
+        case GraphNetwork::AlexNet:
+        case GraphNetwork::SqueezeNet:
+            return TensorShape(227U, 227U, 3U, 1U);
+        default:
+            return TensorShape(224U, 224U, 3U, 1U);
+    }
+}
+
+/** Blocks of a network, in execution order
+ *
+ * Blocks follow the layers the pipe examples partition at (a convolution with its activation,
+ * normalization and pooling, an inception or fire module, a residual bottleneck...).
+ * Parameters are zero-filled since only the execution time matters.
+ *
+ * @param[in] network Network to build
+ * @param[in] layout  Data layout the layers run in
+ *
+ * @return The blocks of the network
+ */
+inline std::vector<GraphBlock> network_blocks(GraphNetwork network, DataLayout layout)
+{
+    using namespace arm_compute::graph::frontend;
+    using graph::EltwiseOperation;
+
+    const auto relu  = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU);
+    const auto relu6 = ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 6.f);
+    const auto lrn   = NormalizationLayerInfo(NormType::CROSS_MAP, 5, 0.0001f, 0.75f);
+
+    auto conv = [relu](IStream & s, unsigned int k, unsigned int ofm, PadStrideInfo info, unsigned int groups = 1)
+    {
+        s << ConvolutionLayer(k, k, ofm, zeros(), zeros(), info, groups) << ActivationLayer(relu);
+    };
+    auto max_pool = [layout](IStream & s, unsigned int size, unsigned int stride, unsigned int pad = 0)
+    {
+        s << PoolingLayer(PoolingLayerInfo(PoolingType::MAX, size, layout, PadStrideInfo(stride, stride, pad, pad, DimensionRoundingType::CEIL)));
+    };
+    auto classifier = [layout](IStream & s, unsigned int classes)
+    {
+        s << PoolingLayer(PoolingLayerInfo(PoolingType::AVG, layout)) << FullyConnectedLayer(classes, zeros(), zeros()) << SoftmaxLayer();
+    };
+
+    std::vector<GraphBlock> blocks;
+    switch(network)
+    {
+        case GraphNetwork::AlexNet:
+        {
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 11U, 96U, PadStrideInfo(4, 4, 0, 0));
+                s << NormalizationLayer(lrn);
+                max_pool(s, 3U, 2U);
+            });
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 5U, 256U, PadStrideInfo(1, 1, 2, 2), 2U);
+                s << NormalizationLayer(lrn);
+                max_pool(s, 3U, 2U);
+            });
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 3U, 384U, PadStrideInfo(1, 1, 1, 1));
+            });
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 3U, 384U, PadStrideInfo(1, 1, 1, 1), 2U);
+            });
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 3U, 256U, PadStrideInfo(1, 1, 1, 1), 2U);
+                max_pool(s, 3U, 2U);
+            });
+            blocks.emplace_back([=](IStream & s)
+            {
+                s << FullyConnectedLayer(4096U, zeros(), zeros()) << ActivationLayer(relu);
+            });
+            blocks.emplace_back([=](IStream & s)
+            {
+                s << FullyConnectedLayer(4096U, zeros(), zeros()) << ActivationLayer(relu);
+            });
+            blocks.emplace_back([=](IStream & s)
+            {
+                s << FullyConnectedLayer(1000U, zeros(), zeros()) << SoftmaxLayer();
+            });
+            break;
+        }
+        case GraphNetwork::GoogleNet:
+        {
+            auto inception = [=](unsigned int a, unsigned int b_reduce, unsigned int b, unsigned int c_reduce, unsigned int c, unsigned int d)
+            {
+                return [=](IStream & s)
+                {
+                    SubStream i_a(s);
+                    conv(i_a, 1U, a, PadStrideInfo(1, 1, 0, 0));
+                    SubStream i_b(s);
+                    conv(i_b, 1U, b_reduce, PadStrideInfo(1, 1, 0, 0));
+                    conv(i_b, 3U, b, PadStrideInfo(1, 1, 1, 1));
+                    SubStream i_c(s);
+                    conv(i_c, 1U, c_reduce, PadStrideInfo(1, 1, 0, 0));
+                    conv(i_c, 5U, c, PadStrideInfo(1, 1, 2, 2));
+                    SubStream i_d(s);
+                    max_pool(i_d, 3U, 1U, 1U);
+                    conv(i_d, 1U, d, PadStrideInfo(1, 1, 0, 0));
+                    s << ConcatLayer(std::move(i_a), std::move(i_b), std::move(i_c), std::move(i_d));
+                };
+            };
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 7U, 64U, PadStrideInfo(2, 2, 3, 3));
+                max_pool(s, 3U, 2U);
+                s << NormalizationLayer(lrn);
+            });
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 1U, 64U, PadStrideInfo(1, 1, 0, 0));
+                conv(s, 3U, 192U, PadStrideInfo(1, 1, 1, 1));
+                s << NormalizationLayer(lrn);
+                max_pool(s, 3U, 2U);
+            });
+            blocks.emplace_back(inception(64U, 96U, 128U, 16U, 32U, 32U));
+            blocks.emplace_back([=](IStream & s)
+            {
+                inception(128U, 128U, 192U, 32U, 96U, 64U)(s);
+                max_pool(s, 3U, 2U);
+            });
+            blocks.emplace_back(inception(192U, 96U, 208U, 16U, 48U, 64U));
+            blocks.emplace_back(inception(160U, 112U, 224U, 24U, 64U, 64U));
+            blocks.emplace_back(inception(128U, 128U, 256U, 24U, 64U, 64U));
+            blocks.emplace_back(inception(112U, 144U, 288U, 32U, 64U, 64U));
+            blocks.emplace_back([=](IStream & s)
+            {
+                inception(256U, 160U, 320U, 32U, 128U, 128U)(s);
+                max_pool(s, 3U, 2U);
+            });
+            blocks.emplace_back(inception(256U, 160U, 320U, 32U, 128U, 128U));
+            blocks.emplace_back([=](IStream & s)
+            {
+                inception(384U, 192U, 384U, 48U, 128U, 128U)(s);
+                classifier(s, 1000U);
+            });
+            break;
+        }
+        case GraphNetwork::MobileNet:
+        {
+            // Batch normalization is folded into the convolutions by the graph mutators, so it is left out
+            auto separable = [=](unsigned int ofm, unsigned int stride)
+            {
+                return [=](IStream & s)
+                {
+                    s << DepthwiseConvolutionLayer(3U, 3U, zeros(), zeros(), PadStrideInfo(stride, stride, 1, 1)) << ActivationLayer(relu6)
+                      << ConvolutionLayer(1U, 1U, ofm, zeros(), zeros(), PadStrideInfo(1, 1, 0, 0)) << ActivationLayer(relu6);
+                };
+            };
+            blocks.emplace_back([=](IStream & s)
+            {
+                s << ConvolutionLayer(3U, 3U, 32U, zeros(), zeros(), PadStrideInfo(2, 2, 0, 1, 0, 1, DimensionRoundingType::CEIL)) << ActivationLayer(relu6);
+            });
+            blocks.emplace_back(separable(64U, 1U));
+            blocks.emplace_back(separable(128U, 2U));
+            blocks.emplace_back(separable(128U, 1U));
+            blocks.emplace_back(separable(256U, 2U));
+            blocks.emplace_back(separable(256U, 1U));
+            blocks.emplace_back(separable(512U, 2U));
+            for(int i = 0; i < 5; ++i)
+            {
+                blocks.emplace_back(separable(512U, 1U));
+            }
+            blocks.emplace_back(separable(1024U, 2U));
+            blocks.emplace_back([=](IStream & s)
+            {
+                separable(1024U, 1U)(s);
+                s << PoolingLayer(PoolingLayerInfo(PoolingType::AVG, layout))
+                  << ConvolutionLayer(1U, 1U, 1001U, zeros(), zeros(), PadStrideInfo(1, 1, 0, 0))
+                  << ReshapeLayer(TensorShape(1001U)) << SoftmaxLayer();
+            });
+            break;
+        }
+        case GraphNetwork::ResNet50:
+        {
+            auto bottleneck = [=](unsigned int base, unsigned int stride, bool projection)
+            {
+                return [=](IStream & s)
+                {
+                    SubStream right(s);
+                    conv(right, 1U, base, PadStrideInfo(1, 1, 0, 0));
+                    conv(right, 3U, base, PadStrideInfo(stride, stride, 1, 1));
+                    right << ConvolutionLayer(1U, 1U, base * 4, zeros(), zeros(), PadStrideInfo(1, 1, 0, 0));
+                    SubStream left(s);
+                    if(projection)
+                    {
+                        left << ConvolutionLayer(1U, 1U, base * 4, zeros(), zeros(), PadStrideInfo(stride, stride, 0, 0));
+                    }
+                    s << EltwiseLayer(std::move(left), std::move(right), EltwiseOperation::Add) << ActivationLayer(relu);
+                };
+            };
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 7U, 64U, PadStrideInfo(2, 2, 3, 3));
+                max_pool(s, 3U, 2U);
+            });
+            const unsigned int units[] = { 3, 4, 6, 3 };
+            const unsigned int bases[]  = { 64, 128, 256, 512 };
+            for(unsigned int stage = 0; stage < 4; ++stage)
+            {
+                for(unsigned int unit = 0; unit < units[stage]; ++unit)
+                {
+                    const unsigned int stride = (unit == 0 && stage > 0) ? 2 : 1;
+                    blocks.emplace_back(bottleneck(bases[stage], stride, unit == 0));
+                }
+            }
+            blocks.emplace_back([=](IStream & s)
+            {
+                classifier(s, 1000U);
+            });
+            break;
+        }
+        case GraphNetwork::SqueezeNet:
+        {
+            auto fire = [=](unsigned int squeeze, unsigned int expand)
+            {
+                return [=](IStream & s)
+                {
+                    conv(s, 1U, squeeze, PadStrideInfo(1, 1, 0, 0));
+                    SubStream i_a(s);
+                    conv(i_a, 1U, expand, PadStrideInfo(1, 1, 0, 0));
+                    SubStream i_b(s);
+                    conv(i_b, 3U, expand, PadStrideInfo(1, 1, 1, 1));
+                    s << ConcatLayer(std::move(i_a), std::move(i_b));
+                };
+            };
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 7U, 96U, PadStrideInfo(2, 2, 0, 0));
+                max_pool(s, 3U, 2U);
+            });
+            blocks.emplace_back(fire(16U, 64U));
+            blocks.emplace_back(fire(16U, 64U));
+            blocks.emplace_back([=](IStream & s)
+            {
+                fire(32U, 128U)(s);
+                max_pool(s, 3U, 2U);
+            });
+            blocks.emplace_back(fire(32U, 128U));
+            blocks.emplace_back(fire(48U, 192U));
+            blocks.emplace_back(fire(48U, 192U));
+            blocks.emplace_back([=](IStream & s)
+            {
+                fire(64U, 256U)(s);
+                max_pool(s, 3U, 2U);
+            });
+            blocks.emplace_back(fire(64U, 256U));
+            blocks.emplace_back([=](IStream & s)
+            {
+                conv(s, 1U, 1000U, PadStrideInfo(1, 1, 0, 0));
+                s << PoolingLayer(PoolingLayerInfo(PoolingType::AVG, layout)) << FlattenLayer() << SoftmaxLayer();
+            });
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unknown network");
+    }
+    return blocks;
+}
+} // namespace networks
+} // namespace benchmark
+} // namespace test
+
+inline std::string to_string(test::benchmark::GraphNetwork network)
+{
+    std::stringstream str;
+    str << network;
+    return str.str();
+}
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_GRAPH_NETWORKS */
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_GRAPH_PIPELINE_FIXTURE
+#define ARM_COMPUTE_TEST_GRAPH_PIPELINE_FIXTURE
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "tests/Utils.h"
+#include "tests/benchmark/fixtures/GraphNetworks.h"
+#include "tests/framework/Fixture.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif /* defined(__linux__) */
+
+namespace arm_compute
+{
+namespace test
+{
+namespace benchmark
+{
+namespace detail
+{
+/** Single-slot hand-off between two pipeline stages
+ *
+ * The producer blocks while the previous frame has not been consumed, so a slow
+ * consumer back-pressures the pipeline like the bounded queues of the pipe examples.
+ */
+class PipelineEdge
+{
+public:
+    /** Allocates the slot for the tensor crossing the cut */
+    void init(const graph::TensorDescriptor &desc)
+    {
+        TensorInfo info(desc.shape, 1, desc.data_type, desc.quant_info);
+        info.set_data_layout(desc.layout);
+        _slot.allocator()->init(info);
+        _slot.allocator()->allocate();
+    }
+    void push(const ITensor &tensor)
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _cv.wait(lock, [this] { return !_full; });
+        _slot.copy_from(tensor);
+        _full = true;
+        _cv.notify_all();
+    }
+    void pop(ITensor &tensor)
+    {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _cv.wait(lock, [this] { return _full; });
+        tensor.copy_from(_slot);
+        _full = false;
+        _cv.notify_all();
+    }
+
+private:
+    Tensor                  _slot{};
+    std::mutex              _mtx{};
+    std::condition_variable _cv{};
+    bool                    _full{ false };
+};
+
+/** Output accessor of a stage feeding the next one */
+class EdgeSenderAccessor final : public graph::ITensorAccessor
+{
+public:
+    explicit EdgeSenderAccessor(PipelineEdge &edge)
+        : _edge(edge)
+    {
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        _edge.push(tensor);
+        // Ends the execution of the stage for this frame
+        return false;
+    }
+
+private:
+    PipelineEdge &_edge;
+};
+
+/** Input accessor of a stage fed by the previous one */
+class EdgeReceiverAccessor final : public graph::ITensorAccessor
+{
+public:
+    explicit EdgeReceiverAccessor(PipelineEdge &edge)
+        : _edge(edge)
+    {
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        _edge.pop(tensor);
+        return true;
+    }
+
+private:
+    PipelineEdge &_edge;
+};
+} // namespace detail
+
+/** Partition of a network in pipeline stages */
+struct GraphPipelineConfig
+{
+    std::vector<unsigned int> cuts{};  /**< Block indices the network is cut before, one stage more than cuts */
+    std::string               order{}; /**< Cluster of each stage, B for the big cores and L for the little ones (e.g. "B-L-B") */
+};
+
+inline std::string to_string(const GraphPipelineConfig &config)
+{
+    std::stringstream str;
+    str << config.order;
+    for(size_t i = 0; i < config.cuts.size(); ++i)
+    {
+        str << (i == 0 ? ":" : ",") << config.cuts[i];
+    }
+    return str.str();
+}
+
+/** Runs a whole network split in pipeline stages, each on its own cluster
+ *
+ * One benchmark iteration pushes @ref frames_per_run frames through the pipeline, so the
+ * throughput of a configuration is frames_per_run divided by the measured time.
+ */
+class GraphPipelineFixture : public framework::Fixture
+{
+public:
+    /** Number of frames pushed through the pipeline per iteration */
+    static constexpr int frames_per_run = 10;
+
+    template <typename...>
+    void setup(GraphNetwork network, GraphPipelineConfig pipeline, int num_threads, DataLayout data_layout)
+    {
+        const std::vector<networks::GraphBlock> blocks = networks::network_blocks(network, data_layout);
+
+        std::vector<size_t> cuts;
+        for(unsigned int cut : pipeline.cuts)
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(cut == 0 || cut >= blocks.size(), "Cut point out of the network");
+            ARM_COMPUTE_ERROR_ON_MSG(!cuts.empty() && cut <= cuts.back(), "Cut points must be increasing");
+            cuts.push_back(cut);
+        }
+        cuts.push_back(blocks.size());
+
+        std::vector<int>  clusters;
+        std::stringstream order_ss(pipeline.order);
+        for(std::string cluster; std::getline(order_ss, cluster, '-');)
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(cluster != "B" && cluster != "L", "Only B and L stages are supported");
+            clusters.push_back(cluster == "B" ? 1 : 0);
+        }
+        ARM_COMPUTE_ERROR_ON_MSG(clusters.size() != cuts.size(), "Order must name one cluster per stage");
+
+        TensorShape input_shape = networks::input_shape(network);
+        if(data_layout == DataLayout::NHWC)
+        {
+            permute(input_shape, PermutationVector(2U, 0U, 1U));
+        }
+        graph::TensorDescriptor desc = graph::TensorDescriptor(input_shape, DataType::F32).set_layout(data_layout);
+
+#if defined(__linux__)
+        cpu_set_t original_mask;
+        sched_getaffinity(0, sizeof(original_mask), &original_mask);
+#endif /* defined(__linux__) */
+
+        _edges.clear();
+        _streams.clear();
+        _cores.clear();
+        size_t begin = 0;
+        for(size_t i = 0; i < cuts.size(); ++i)
+        {
+            graph::GraphConfig config;
+            config.cluster     = clusters[i];
+            config.num_threads = std::min(num_threads, clusters[i] ? config.big_cores : config.little_cores);
+            _cores.push_back(clusters[i] ? config.total_cores - 1 : config.little_cores - 1);
+
+            // The scheduler serving a stage is picked from the core the stage is configured and run on
+            pin_to_core(_cores.back());
+
+            _streams.emplace_back(std::make_unique<graph::frontend::Stream>(i, "GraphPipeline"));
+            graph::frontend::Stream &stream = *_streams.back();
+            stream << graph::Target::NEON << graph::FastMathHint::Disabled;
+            if(i == 0)
+            {
+                stream << graph::frontend::InputLayer(desc, networks::zeros());
+            }
+            else
+            {
+                stream << graph::frontend::InputLayer(desc, std::make_unique<detail::EdgeReceiverAccessor>(*_edges.back()));
+            }
+            for(size_t b = begin; b < cuts[i]; ++b)
+            {
+                blocks[b](stream);
+            }
+            begin = cuts[i];
+
+            if(i + 1 < cuts.size())
+            {
+                desc = stream.graph().node(stream.tail_node())->output(0)->desc();
+                _edges.emplace_back(std::make_unique<detail::PipelineEdge>());
+                _edges.back()->init(desc);
+                stream << graph::frontend::OutputLayer(std::make_unique<detail::EdgeSenderAccessor>(*_edges.back()));
+            }
+            else
+            {
+                stream << graph::frontend::OutputLayer(nullptr);
+            }
+
+            std::set<int> blocking_set;
+            stream.finalize(graph::Target::NEON, config, &blocking_set);
+        }
+
+#if defined(__linux__)
+        sched_setaffinity(0, sizeof(original_mask), &original_mask);
+#endif /* defined(__linux__) */
+    }
+
+    void run()
+    {
+        std::vector<std::thread> stages;
+        for(size_t i = 0; i < _streams.size(); ++i)
+        {
+            stages.emplace_back([this, i]()
+            {
+                pin_to_core(_cores[i]);
+                for(int frame = 0; frame < frames_per_run; ++frame)
+                {
+                    _streams[i]->run(0);
+                }
+            });
+        }
+        for(auto &stage : stages)
+        {
+            stage.join();
+        }
+    }
+
+    void sync()
+    {
+    }
+
+    void teardown()
+    {
+        _streams.clear();
+        _edges.clear();
+        _cores.clear();
+    }
+
+private:
+    static void pin_to_core(int core)
+    {
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+#else  /* defined(__linux__) */
+        ARM_COMPUTE_UNUSED(core);
+#endif /* defined(__linux__) */
+    }
+
+    std::vector<std::unique_ptr<detail::PipelineEdge>>    _edges{};
+    std::vector<std::unique_ptr<graph::frontend::Stream>> _streams{};
+    std::vector<int>                                      _cores{};
+};
+} // namespace benchmark
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_GRAPH_PIPELINE_FIXTURE */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_RESNET50_CONVOLUTION_LAYER_DATASET
+#define ARM_COMPUTE_TEST_RESNET50_CONVOLUTION_LAYER_DATASET
+
+#include "tests/datasets/ConvolutionLayerDataset.h"
+
+#include "utils/TypePrinter.h"
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace datasets
+{
+class ResNet50ConvolutionLayerDataset final : public ConvolutionLayerDataset
+{
+public:
+    ResNet50ConvolutionLayerDataset()
+    {
+        // conv1
+        add_config(TensorShape(224U, 224U, 3U), TensorShape(7U, 7U, 3U, 64U), TensorShape(64U), TensorShape(112U, 112U, 64U), PadStrideInfo(2, 2, 3, 3));
+        // block1 bottlenecks
+        add_config(TensorShape(56U, 56U, 64U), TensorShape(1U, 1U, 64U, 64U), TensorShape(64U), TensorShape(56U, 56U, 64U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(56U, 56U, 64U), TensorShape(3U, 3U, 64U, 64U), TensorShape(64U), TensorShape(56U, 56U, 64U), PadStrideInfo(1, 1, 1, 1));
+        add_config(TensorShape(56U, 56U, 64U), TensorShape(1U, 1U, 64U, 256U), TensorShape(256U), TensorShape(56U, 56U, 256U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(56U, 56U, 256U), TensorShape(1U, 1U, 256U, 64U), TensorShape(64U), TensorShape(56U, 56U, 64U), PadStrideInfo(1, 1, 0, 0));
+        // block2 bottlenecks
+        add_config(TensorShape(56U, 56U, 256U), TensorShape(1U, 1U, 256U, 128U), TensorShape(128U), TensorShape(56U, 56U, 128U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(56U, 56U, 128U), TensorShape(3U, 3U, 128U, 128U), TensorShape(128U), TensorShape(28U, 28U, 128U), PadStrideInfo(2, 2, 1, 1));
+        add_config(TensorShape(56U, 56U, 256U), TensorShape(1U, 1U, 256U, 512U), TensorShape(512U), TensorShape(28U, 28U, 512U), PadStrideInfo(2, 2, 0, 0));
+        add_config(TensorShape(28U, 28U, 128U), TensorShape(1U, 1U, 128U, 512U), TensorShape(512U), TensorShape(28U, 28U, 512U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(28U, 28U, 512U), TensorShape(1U, 1U, 512U, 128U), TensorShape(128U), TensorShape(28U, 28U, 128U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(28U, 28U, 128U), TensorShape(3U, 3U, 128U, 128U), TensorShape(128U), TensorShape(28U, 28U, 128U), PadStrideInfo(1, 1, 1, 1));
+        // block3 bottlenecks
+        add_config(TensorShape(28U, 28U, 512U), TensorShape(1U, 1U, 512U, 256U), TensorShape(256U), TensorShape(28U, 28U, 256U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(28U, 28U, 256U), TensorShape(3U, 3U, 256U, 256U), TensorShape(256U), TensorShape(14U, 14U, 256U), PadStrideInfo(2, 2, 1, 1));
+        add_config(TensorShape(28U, 28U, 512U), TensorShape(1U, 1U, 512U, 1024U), TensorShape(1024U), TensorShape(14U, 14U, 1024U), PadStrideInfo(2, 2, 0, 0));
+        add_config(TensorShape(14U, 14U, 256U), TensorShape(1U, 1U, 256U, 1024U), TensorShape(1024U), TensorShape(14U, 14U, 1024U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(14U, 14U, 1024U), TensorShape(1U, 1U, 1024U, 256U), TensorShape(256U), TensorShape(14U, 14U, 256U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(14U, 14U, 256U), TensorShape(3U, 3U, 256U, 256U), TensorShape(256U), TensorShape(14U, 14U, 256U), PadStrideInfo(1, 1, 1, 1));
+        // block4 bottlenecks
+        add_config(TensorShape(14U, 14U, 1024U), TensorShape(1U, 1U, 1024U, 512U), TensorShape(512U), TensorShape(14U, 14U, 512U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(14U, 14U, 512U), TensorShape(3U, 3U, 512U, 512U), TensorShape(512U), TensorShape(7U, 7U, 512U), PadStrideInfo(2, 2, 1, 1));
+        add_config(TensorShape(14U, 14U, 1024U), TensorShape(1U, 1U, 1024U, 2048U), TensorShape(2048U), TensorShape(7U, 7U, 2048U), PadStrideInfo(2, 2, 0, 0));
+        add_config(TensorShape(7U, 7U, 512U), TensorShape(1U, 1U, 512U, 2048U), TensorShape(2048U), TensorShape(7U, 7U, 2048U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(7U, 7U, 2048U), TensorShape(1U, 1U, 2048U, 512U), TensorShape(512U), TensorShape(7U, 7U, 512U), PadStrideInfo(1, 1, 0, 0));
+        add_config(TensorShape(7U, 7U, 512U), TensorShape(3U, 3U, 512U, 512U), TensorShape(512U), TensorShape(7U, 7U, 512U), PadStrideInfo(1, 1, 1, 1));
+    }
+};
+} // namespace datasets
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_RESNET50_CONVOLUTION_LAYER_DATASET */
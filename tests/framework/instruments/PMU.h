@@ -24,14 +24,7 @@
 #ifndef ARM_COMPUTE_TEST_PMU
 #define ARM_COMPUTE_TEST_PMU
 
-#include "arm_compute/core/Error.h"
-
-#include <cstdint>
-#include <errno.h>
-#include <linux/perf_event.h>
-#include <stdexcept>
-#include <sys/syscall.h>
-#include <unistd.h>
+#include "arm_compute/runtime/PMU.h"
 
 namespace arm_compute
 {
@@ -39,67 +32,8 @@ namespace test
 {
 namespace framework
 {
-/** Class provides access to CPU hardware counters. */
-class PMU
-{
-public:
-    /** Default constructor. */
-    PMU();
-
-    /** Create PMU with specified counter.
-     *
-     * This constructor automatically calls @ref open with the default
-     * configuration.
-     *
-     * @param[in] config Counter identifier.
-     */
-    explicit PMU(uint64_t config);
-
-    /** Default destructor. */
-    ~PMU();
-
-    /** Get the counter value.
-     *
-     * @return Counter value casted to the specified type. */
-    template <typename T>
-    T get_value() const;
-
-    /** Open the specified counter based on the default configuration.
-     *
-     * @param[in] config The default configuration.
-     */
-    void open(uint64_t config);
-
-    /** Open the specified configuration.
-     *
-     * @param[in] perf_config The specified configuration.
-     */
-    void open(const perf_event_attr &perf_config);
-
-    /** Close the currently open counter. */
-    void close();
-
-    /** Reset counter. */
-    void reset();
-
-private:
-    perf_event_attr _perf_config;
-    long            _fd{ -1 };
-};
-
-template <typename T>
-T PMU::get_value() const
-{
-    T             value{};
-    const ssize_t result = read(_fd, &value, sizeof(T));
-
-    if(result == -1)
-    {
-        ARM_COMPUTE_ERROR_VAR("Can't get PMU counter value: %d", errno);
-    }
-
-    return value;
-}
+/** CPU hardware counters, shared with the runtime so the graph can profile layers with the same wrapper */
+using PMU = arm_compute::PMU;
 } // namespace framework
 } // namespace test
 } // namespace arm_compute
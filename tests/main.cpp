@@ -56,6 +56,10 @@
 #include <random>
 #include <utility>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif /* defined(__linux__) */
+
 using namespace arm_compute;
 using namespace arm_compute::test;
 
@@ -150,6 +154,8 @@ int main(int argc, char **argv)
 #endif /* ARM_COMPUTE_CL */
     auto threads = parser.add_option<utils::SimpleOption<int>>("threads", 1);
     threads->set_help("Number of threads to use");
+    auto cluster = parser.add_option<utils::SimpleOption<int>>("cluster", -1);
+    cluster->set_help("Pin the benchmark and its worker threads to a cluster (0 = little, 1 = big, -1 = no affinity)");
     auto cooldown_sec = parser.add_option<utils::SimpleOption<float>>("delay", -1.f);
     cooldown_sec->set_help("Delay to add between test executions in seconds");
 
@@ -166,7 +172,27 @@ int main(int argc, char **argv)
         std::vector<std::unique_ptr<framework::Printer>> printers = options.create_printers();
 
         // Setup CPU Scheduler
-        Scheduler::get().set_num_threads(threads->value());
+        if(cluster->value() < 0)
+        {
+            Scheduler::get().set_num_threads(threads->value());
+        }
+        else
+        {
+            arm_compute::graph::GraphConfig cfg;
+            cfg.cluster = cluster->value();
+#if defined(__linux__)
+            // The scheduler serving the benchmarks is picked from the core the main thread runs on
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cfg.cluster > 0 ? cfg.total_cores - 1 : cfg.little_cores - 1, &set);
+            sched_setaffinity(0, sizeof(set), &set);
+#endif /* defined(__linux__) */
+            Scheduler::get().set_num_threads_with_affinity(threads->value(), cfg, [](int t_id, int max_cores, arm_compute::graph::GraphConfig cfg)
+            {
+                ARM_COMPUTE_UNUSED(max_cores);
+                return cfg.cluster > 0 ? (cfg.total_cores - 1) - (t_id % cfg.total_cores) : t_id;
+            });
+        }
 
         // Create CPU context
         auto cpu_ctx = std::make_unique<RuntimeContext>();
@@ -260,6 +286,7 @@ int main(int argc, char **argv)
                 }
                 p->print_entry("Iterations", support::cpp11::to_string(options.iterations->value()));
                 p->print_entry("Threads", support::cpp11::to_string(threads->value()));
+                p->print_entry("Cluster", support::cpp11::to_string(cluster->value()));
                 {
                     using support::cpp11::to_string;
                     p->print_entry("Dataset mode", to_string(dataset_mode->value()));
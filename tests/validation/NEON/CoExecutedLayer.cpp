@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/backends/CoExecutedLayerFunction.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/CoExecutedFullyConnectedLayerFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>           rel_tolerance_f32(0.01f);  /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr AbsoluteTolerance<float> abs_tolerance_f32(0.001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+
+/** Tensor types of the Neon graph backend */
+struct NETargetInfo
+{
+    using TensorType         = ITensor;
+    using TensorConcreteType = Tensor;
+};
+
+using NECoExecutedLayer = graph::backends::CoExecutedLayerFunction<NETargetInfo>;
+
+/** Fully connected layers split at a multiple of 4 outputs, at an odd number of outputs and with a batch whose output rows are strided views */
+const auto CoExecutedFullyConnectedLayerDataset = combine(zip(zip(
+                                                                  framework::dataset::make("InputShape", { TensorShape(9U, 5U, 7U), TensorShape(9U, 5U, 7U, 3U), TensorShape(4U, 4U, 16U) }),
+                                                                  framework::dataset::make("NumOutputs", { 271U, 271U, 130U })),
+                                                              framework::dataset::make("Split", { 136U, 21U, 128U })),
+                                                          framework::dataset::make("DataType", DataType::F32));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(CoExecutedLayer)
+
+// The parts run on another cluster with the threads of the C++ scheduler
+#if defined(ARM_COMPUTE_CPP_SCHEDULER)
+template <typename T>
+using NECoExecutedFullyConnectedLayerFixture = CoExecutedFullyConnectedLayerValidationFixture<Tensor, Accessor, NECoExecutedLayer, NEFullyConnectedLayer, T>;
+
+TEST_SUITE(FullyConnected)
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NECoExecutedFullyConnectedLayerFixture<float>, framework::DatasetMode::ALL, CoExecutedFullyConnectedLayerDataset)
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+TEST_SUITE_END() // FullyConnected
+#endif /* defined(ARM_COMPUTE_CPP_SCHEDULER) */
+
+TEST_SUITE_END() // CoExecutedLayer
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NESparseFullyConnectedLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
@@ -33,6 +34,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/FullyConnectedLayerFixture.h"
+#include "tests/validation/fixtures/SparseFullyConnectedLayerFixture.h"
 
 namespace arm_compute
 {
@@ -45,6 +47,11 @@ namespace
 /** Tolerance for float operations */
 constexpr RelativeTolerance<float> rel_tolerance_f32(0.01f);  /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 */
 constexpr AbsoluteTolerance<float> abs_tolerance_f32(0.001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+#ifdef __aarch64__
+constexpr AbsoluteTolerance<float> abs_tolerance_gemv_f16(0.01f);   /**< Absolute tolerance value for DataType::F32 layers storing their GEMV weights in F16 */
+#endif                                                              /* __aarch64__ */
+constexpr AbsoluteTolerance<float> abs_tolerance_gemv_int8(0.1f);   /**< Absolute tolerance value for DataType::F32 layers storing their GEMV weights in 8 bits */
+constexpr float                    tolerance_num_gemv_int8 = 0.02f; /**< Tolerance number for DataType::F32 layers storing their GEMV weights in 8 bits */
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
 const AbsoluteTolerance<float>            abs_tolerance_f16(0.3f);                   /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F16 */
 const RelativeTolerance<half_float::half> rel_tolerance_f16(half_float::half(0.2f)); /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F16 */
@@ -89,6 +96,35 @@ const auto ActivationFunctionsQuantizedDataset = framework::dataset::make("Activ
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, 0.5f),
     ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 0.75f, 0.25f),
 });
+
+/** Fully connected layer storing the weights of its single vector inputs in @p WeightsType */
+template <DataType WeightsType>
+class NEFullyConnectedLayerGEMVWeights : public NEFullyConnectedLayer
+{
+public:
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, FullyConnectedLayerInfo fc_info)
+    {
+        fc_info.gemv_weights_type = WeightsType;
+        NEFullyConnectedLayer::configure(input, weights, biases, output, fc_info);
+    }
+};
+
+/** Fully connected layers with partial blocks at the end of the rows and, for 4x4 blocks, at the end of the columns */
+const auto SparseFullyConnectedLayerDataset = zip(zip(zip(framework::dataset::make("InputShape", { TensorShape(9U, 5U, 7U), TensorShape(9U, 5U, 7U, 3U), TensorShape(201U), TensorShape(128U) }),
+                                                          framework::dataset::make("WeightsShape", { TensorShape(315U, 271U), TensorShape(315U, 271U), TensorShape(201U, 529U), TensorShape(128U, 64U) })),
+                                                      framework::dataset::make("BiasShape", { TensorShape(271U), TensorShape(271U), TensorShape(529U), TensorShape(64U) })),
+                                                  framework::dataset::make("OutputShape", { TensorShape(271U), TensorShape(271U, 3U), TensorShape(529U), TensorShape(64U) }));
+const auto WeightsPruningDataset = framework::dataset::make("Pruning", { WeightsPruning::BLOCK_ROWS, WeightsPruning::TAIL_COLUMNS, WeightsPruning::ALL_ZERO });
+
+/** Sparse fully connected layer packing its weights in 4x4 blocks */
+class NESparseFullyConnectedLayer4x4 : public NESparseFullyConnectedLayer
+{
+public:
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, FullyConnectedLayerInfo fc_info)
+    {
+        NESparseFullyConnectedLayer::configure(input, weights, biases, output, fc_info, 4);
+    }
+};
 } // namespace
 
 TEST_SUITE(NEON)
@@ -143,6 +179,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(
 
 template <typename T>
 using NEFullyConnectedLayerFixture = FullyConnectedLayerValidationFixture<Tensor, Accessor, NEFullyConnectedLayer, T>;
+template <DataType WeightsType>
+using NEFullyConnectedLayerGEMVWeightsFixture = FullyConnectedLayerValidationFixture<Tensor, Accessor, NEFullyConnectedLayerGEMVWeights<WeightsType>, float>;
 
 TEST_SUITE(Float)
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -199,6 +237,24 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEFullyConnectedLayerFixture<float>, framework:
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
 }
+#ifdef __aarch64__
+FIXTURE_DATA_TEST_CASE(RunSmallGEMVF16Weights, NEFullyConnectedLayerGEMVWeightsFixture<DataType::F16>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(datasets::SmallFullyConnectedLayerDataset(), FullyConnectedParameters),
+                                       framework::dataset::make("DataType", DataType::F32)),
+                               EmptyActivationFunctionDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_gemv_f16);
+}
+#endif /* __aarch64__ */
+FIXTURE_DATA_TEST_CASE(RunSmallGEMVInt8Weights, NEFullyConnectedLayerGEMVWeightsFixture<DataType::QSYMM8_PER_CHANNEL>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(datasets::SmallFullyConnectedLayerDataset(), FullyConnectedParameters),
+                                       framework::dataset::make("DataType", DataType::F32)),
+                               EmptyActivationFunctionDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, tolerance_num_gemv_int8, abs_tolerance_gemv_int8);
+}
 TEST_SUITE_END()
 TEST_SUITE_END()
 
@@ -265,6 +321,61 @@ FIXTURE_DATA_TEST_CASE(RunWithActivation, NEFullyConnectedLayerQuantizedFixture<
 TEST_SUITE_END()
 TEST_SUITE_END()
 
+TEST_SUITE_END()
+
+TEST_SUITE(SparseFullyConnectedLayer)
+template <typename T>
+using NESparseFullyConnectedLayerFixture = FullyConnectedLayerValidationFixture<Tensor, Accessor, NESparseFullyConnectedLayer, T>;
+template <typename T>
+using NESparseFullyConnectedLayer4x4Fixture = FullyConnectedLayerValidationFixture<Tensor, Accessor, NESparseFullyConnectedLayer4x4, T>;
+template <typename T>
+using NESparseFullyConnectedLayerPrunedFixture = SparseFullyConnectedLayerValidationFixture<Tensor, Accessor, NESparseFullyConnectedLayer, T>;
+template <typename T>
+using NESparseFullyConnectedLayer4x4PrunedFixture = SparseFullyConnectedLayerValidationFixture<Tensor, Accessor, NESparseFullyConnectedLayer4x4, T>;
+
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NESparseFullyConnectedLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallFullyConnectedLayerDataset(),
+                                                                                                                       FullyConnectedParameters),
+                                                                                                                       framework::dataset::make("DataType", DataType::F32)),
+                                                                                                               EmptyActivationFunctionDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunSmall4x4, NESparseFullyConnectedLayer4x4Fixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(datasets::SmallFullyConnectedLayerDataset(),
+                                                                                                                             FullyConnectedParameters),
+                                                                                                                             framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                     EmptyActivationFunctionDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunPruned, NESparseFullyConnectedLayerPrunedFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(SparseFullyConnectedLayerDataset,
+                                                                                                                             WeightsPruningDataset),
+                                                                                                                             framework::dataset::make("BlockHeight", 1U)),
+                                                                                                                     framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunPruned4x4, NESparseFullyConnectedLayer4x4PrunedFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(SparseFullyConnectedLayerDataset,
+                                                                                                                                   WeightsPruningDataset),
+                                                                                                                                   framework::dataset::make("BlockHeight", 4U)),
+                                                                                                                           framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+}
+FIXTURE_DATA_TEST_CASE(RunWithActivation, NESparseFullyConnectedLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(
+                           combine(datasets::FullyConnectedLayerWithActivationDataset(),
+                                   FullyConnectedParameters),
+                           framework::dataset::make("DataType", DataType::F32)),
+                       ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0, abs_tolerance_f32);
+}
+TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
 } // namespace validation
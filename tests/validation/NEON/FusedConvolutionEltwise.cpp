@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/backends/FusedConvolutionEltwiseFunction.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFuseBatchNormalization.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPadLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/FusedConvolutionEltwiseFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>           rel_tolerance_f32(0.01f);  /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr AbsoluteTolerance<float> abs_tolerance_f32(0.001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+
+/** Tensor types of the Neon graph backend */
+struct NETargetInfo
+{
+    using TensorType         = ITensor;
+    using TensorConcreteType = Tensor;
+};
+
+/** Function types of the Neon graph backend used by the fused layer */
+struct NEFusedLayerTypes
+{
+    using GEMMConvolutionLayer      = NEGEMMConvolutionLayer;
+    using DepthwiseConvolutionLayer = NEDepthwiseConvolutionLayer;
+    using FuseBatchNormalization    = NEFuseBatchNormalization;
+    using PadLayer                  = NEPadLayer;
+    using Addition                  = NEArithmeticAddition;
+    using ActivationLayer           = NEActivationLayer;
+};
+
+using NEFusedConvolutionEltwise = graph::backends::FusedConvolutionEltwiseFunction<NETargetInfo, NEFusedLayerTypes>;
+
+/** Convolutions whose output heights are not a multiple of the rows of a band, so the last band overlaps the previous one
+ *
+ * A band holds about 64KB of convolution output: 12 rows for the first shape, 15 for the second, 22 for the third and 8 for the fourth.
+ * The first and fourth convolutions are padded, so their bands are copied with their padding, the other two read their input in place.
+ */
+const auto FusedConvolutionEltwiseDataset = combine(combine(combine(zip(zip(zip(
+                                                                                   framework::dataset::make("InputShape", { TensorShape(20U, 30U, 16U), TensorShape(33U, 50U, 8U), TensorShape(17U, 41U, 24U), TensorShape(40U, 45U, 8U) }),
+                                                                                   framework::dataset::make("KernelSize", { Size2D(3U, 3U), Size2D(1U, 1U), Size2D(3U, 3U), Size2D(3U, 3U) })),
+                                                                               framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 0, 0), PadStrideInfo(1, 1, 0, 0), PadStrideInfo(2, 2, 1, 1) })),
+                                                                           framework::dataset::make("NumOutputs", { 64U, 32U, 48U, 96U })),
+                                                                       framework::dataset::make("UseBatchNormalization", { false, true })),
+                                                               framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)
+})),
+framework::dataset::make("DataType", DataType::F32));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(FusedConvolutionEltwise)
+
+template <typename T>
+using NEFusedConvolutionEltwiseFixture = FusedConvolutionEltwiseValidationFixture<Tensor, Accessor, NEFusedConvolutionEltwise, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedConvolutionEltwiseFixture<float>, framework::DatasetMode::ALL,
+                       combine(FusedConvolutionEltwiseDataset, framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // FusedConvolutionEltwise
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
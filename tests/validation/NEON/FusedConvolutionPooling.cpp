@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/backends/FusedConvolutionPoolingFunction.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFuseBatchNormalization.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPadLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/FusedConvolutionPoolingFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>           rel_tolerance_f32(0.01f);  /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr AbsoluteTolerance<float> abs_tolerance_f32(0.001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+
+/** Tensor types of the Neon graph backend */
+struct NETargetInfo
+{
+    using TensorType         = ITensor;
+    using TensorConcreteType = Tensor;
+};
+
+/** Function types of the Neon graph backend used by the fused layer */
+struct NEFusedLayerTypes
+{
+    using GEMMConvolutionLayer      = NEGEMMConvolutionLayer;
+    using DepthwiseConvolutionLayer = NEDepthwiseConvolutionLayer;
+    using FuseBatchNormalization    = NEFuseBatchNormalization;
+    using PadLayer                  = NEPadLayer;
+    using PoolingLayer              = NEPoolingLayer;
+};
+
+using NEFusedConvolutionPooling = graph::backends::FusedConvolutionPoolingFunction<NETargetInfo, NEFusedLayerTypes>;
+
+/** Convolutions followed by a max pooling whose output heights are not a multiple of the pooled rows of a band, so the last band overlaps the previous one
+ *
+ * A band holds about 64KB of convolution rows: 3 pooled rows from 7 convolution rows for the first shape, padded on both sides,
+ * 11 pooled rows from 22 convolution rows for the second and 4 pooled rows from 9 convolution rows for the third, padded at the bottom only.
+ */
+const auto FusedConvolutionPoolingDataset = combine(combine(combine(zip(zip(zip(zip(
+                                                                                       framework::dataset::make("InputShape", { TensorShape(32U, 40U, 8U), TensorShape(24U, 35U, 16U), TensorShape(28U, 30U, 8U) }),
+                                                                                       framework::dataset::make("KernelSize", { Size2D(3U, 3U), Size2D(3U, 3U), Size2D(1U, 1U) })),
+                                                                                   framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 0, 0), PadStrideInfo(1, 1, 0, 0) })),
+                                                                               framework::dataset::make("NumOutputs", { 64U, 32U, 64U })),
+                                                                           framework::dataset::make("PoolingInfo",
+{
+    PoolingLayerInfo(PoolingType::MAX, 3, DataLayout::NHWC, PadStrideInfo(2, 2, 1, 1)),
+    PoolingLayerInfo(PoolingType::MAX, 2, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 0)),
+    PoolingLayerInfo(PoolingType::MAX, 3, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 1, 0, 1, DimensionRoundingType::FLOOR))
+})),
+framework::dataset::make("UseBatchNormalization", { false, true })),
+framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)
+})),
+framework::dataset::make("DataType", DataType::F32));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(FusedConvolutionPooling)
+
+template <typename T>
+using NEFusedConvolutionPoolingFixture = FusedConvolutionPoolingValidationFixture<Tensor, Accessor, NEFusedConvolutionPooling, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+// Only NHWC convolutions are fused with a pooling layer: the NCHW pooling kernels need padding around each band
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedConvolutionPoolingFixture<float>, framework::DatasetMode::ALL,
+                       combine(FusedConvolutionPoolingDataset, framework::dataset::make("DataLayout", DataLayout::NHWC)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // FusedConvolutionPooling
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/backends/FusedDepthwisePointwiseConvolutionFunction.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFuseBatchNormalization.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPadLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/FusedDepthwisePointwiseConvolutionFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>           rel_tolerance_f32(0.01f);  /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr AbsoluteTolerance<float> abs_tolerance_f32(0.001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+
+/** Tensor types of the Neon graph backend */
+struct NETargetInfo
+{
+    using TensorType         = ITensor;
+    using TensorConcreteType = Tensor;
+};
+
+/** Function types of the Neon graph backend used by the fused layer */
+struct NEFusedLayerTypes
+{
+    using GEMMConvolutionLayer      = NEGEMMConvolutionLayer;
+    using DepthwiseConvolutionLayer = NEDepthwiseConvolutionLayer;
+    using FuseBatchNormalization    = NEFuseBatchNormalization;
+    using PadLayer                  = NEPadLayer;
+};
+
+using NEFusedDepthwisePointwiseConvolution = graph::backends::FusedDepthwisePointwiseConvolutionFunction<NETargetInfo, NEFusedLayerTypes>;
+
+/** Depthwise convolutions whose output heights are not a multiple of the rows of a band, so the last band overlaps the previous one
+ *
+ * A band holds about 64KB of depthwise output: 6 rows for the first shape, 30 for the second and 9 for the third.
+ */
+const auto FusedDepthwisePointwiseConvolutionDataset = combine(combine(combine(zip(zip(zip(
+                                                                                              framework::dataset::make("InputShape", { TensorShape(40U, 27U, 64U), TensorShape(33U, 90U, 32U), TensorShape(20U, 41U, 96U) }),
+                                                                                              framework::dataset::make("KernelSize", { Size2D(3U, 3U), Size2D(3U, 3U), Size2D(3U, 3U) })),
+                                                                                          framework::dataset::make("DepthwiseInfo", { PadStrideInfo(1, 1, 1, 1), PadStrideInfo(2, 2, 1, 1), PadStrideInfo(1, 1, 0, 0) })),
+                                                                                      framework::dataset::make("NumOutputs", { 48U, 24U, 32U })),
+                                                                                  framework::dataset::make("UseBatchNormalization", { false, true })),
+                                                                          framework::dataset::make("ActivationInfo",
+{
+    ActivationLayerInfo(),
+    ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU, 6.f)
+})),
+framework::dataset::make("DataType", DataType::F32));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(FusedDepthwisePointwiseConvolution)
+
+template <typename T>
+using NEFusedDepthwisePointwiseConvolutionFixture = FusedDepthwisePointwiseConvolutionValidationFixture<Tensor, Accessor, NEFusedDepthwisePointwiseConvolution, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEFusedDepthwisePointwiseConvolutionFixture<float>, framework::DatasetMode::ALL,
+                       combine(FusedDepthwisePointwiseConvolutionDataset, framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // FusedDepthwisePointwiseConvolution
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
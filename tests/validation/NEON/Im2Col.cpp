@@ -102,6 +102,18 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEIm2ColFixture<float>, framework::DatasetMode:
     // Validate output
     validate(Accessor(_target), _reference);
 }
+FIXTURE_DATA_TEST_CASE(RunGrouped, NEIm2ColFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(combine(framework::dataset::make("Shape", { TensorShape{ 11U, 11U, 12U }, TensorShape{ 27U, 13U, 6U, 2U } }),
+                                                                       framework::dataset::make("DataType", DataType::F32)),
+                                                               conv_filter_sizes_small),
+                                                       framework::dataset::make("PadStride", { PadStrideInfo(1U, 1U, 0U, 0U), PadStrideInfo(2U, 2U, 1U, 1U) })),
+                                               framework::dataset::make("QuantizationInfo", QuantizationInfo(0.5f, 10))),
+                                       framework::dataset::make("DataLayout", { DataLayout::NCHW })),
+                               framework::dataset::make("NumGroups", { 2, 3 })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
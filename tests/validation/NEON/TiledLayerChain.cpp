@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/backends/TiledLayerChainFunction.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEDepthwiseConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFuseBatchNormalization.h"
+#include "arm_compute/runtime/NEON/functions/NEGEMMConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPadLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/NEON/Accessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/Validation.h"
+#include "tests/validation/fixtures/TiledLayerChainFixture.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+RelativeTolerance<float>           rel_tolerance_f32(0.01f);  /**< Relative tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+constexpr AbsoluteTolerance<float> abs_tolerance_f32(0.001f); /**< Absolute tolerance value for comparing reference's output against implementation's output for DataType::F32 */
+
+/** Tensor types of the Neon graph backend */
+struct NETargetInfo
+{
+    using TensorType         = ITensor;
+    using TensorConcreteType = Tensor;
+};
+
+/** Function types of the Neon graph backend used by the tiled chain */
+struct NEFusedLayerTypes
+{
+    using GEMMConvolutionLayer      = NEGEMMConvolutionLayer;
+    using DepthwiseConvolutionLayer = NEDepthwiseConvolutionLayer;
+    using FuseBatchNormalization    = NEFuseBatchNormalization;
+    using PadLayer                  = NEPadLayer;
+    using ActivationLayer           = NEActivationLayer;
+    using PoolingLayer              = NEPoolingLayer;
+    using NormalizationLayer        = NENormalizationLayer;
+};
+
+using NETiledLayerChain = graph::backends::TiledLayerChainFunction<NETargetInfo, NEFusedLayerTypes>;
+
+/** Chains whose output heights are not a multiple of the rows of a band, so the last band overlaps the previous one
+ *
+ * A band holds about 256KB of intermediate rows: 11 output rows out of 30 for the first shape, 10 out of 25 for the second
+ * and 15 out of 21 for the third. The 3x3 convolutions recompute the rows in the halo of two bands, and the pooling
+ * layers are padded on both sides, not padded, and padded at the bottom and right only.
+ */
+const auto TiledLayerChainDataset = combine(combine(zip(zip(zip(
+                                                                   framework::dataset::make("InputShape", { TensorShape(32U, 60U, 8U), TensorShape(24U, 50U, 16U), TensorShape(28U, 44U, 8U) }),
+                                                                   framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 1, 1), PadStrideInfo(1, 1, 0, 0) })),
+                                                               framework::dataset::make("NumOutputs", { 32U, 48U, 32U })),
+                                                           framework::dataset::make("PoolingInfo",
+{
+    PoolingLayerInfo(PoolingType::MAX, 3, DataLayout::NHWC, PadStrideInfo(2, 2, 1, 1)),
+    PoolingLayerInfo(PoolingType::MAX, 2, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 0)),
+    PoolingLayerInfo(PoolingType::MAX, 3, DataLayout::NHWC, PadStrideInfo(2, 2, 0, 1, 0, 1, DimensionRoundingType::FLOOR))
+})),
+framework::dataset::make("UseBatchNormalization", { false, true })),
+framework::dataset::make("DataType", DataType::F32));
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(TiledLayerChain)
+
+template <typename T>
+using NETiledLayerChainFixture = TiledLayerChainValidationFixture<Tensor, Accessor, NETiledLayerChain, T>;
+
+TEST_SUITE(Float)
+TEST_SUITE(FP32)
+// Only NHWC pooling layers are tiled: the NCHW pooling kernels need padding around each band
+FIXTURE_DATA_TEST_CASE(RunSmall, NETiledLayerChainFixture<float>, framework::DatasetMode::ALL,
+                       combine(TiledLayerChainDataset, framework::dataset::make("DataLayout", DataLayout::NHWC)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+TEST_SUITE_END() // FP32
+TEST_SUITE_END() // Float
+
+TEST_SUITE_END() // TiledLayerChain
+TEST_SUITE_END() // Neon
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
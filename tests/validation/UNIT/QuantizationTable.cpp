@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/QuantizationTable.h"
+#include "arm_compute/graph/detail/CalibrationHelpers.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "tests/Globals.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Checks that two floats match within an absolute tolerance */
+bool is_close(float a, float b, float tolerance = 1e-6f)
+{
+    return std::abs(a - b) <= tolerance;
+}
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(QuantizationTable)
+
+TEST_CASE(SaveLoadRoundTrip, framework::DatasetMode::ALL)
+{
+    const std::string filename = "quantization_table_unit_test.txt";
+    auto             &table    = graph::QuantizationTable::get();
+
+    // Ranges that need all the digits of a float to be read back exactly
+    graph::TensorRange conv_range;
+    conv_range.min = -1.2345678e-7f;
+    conv_range.max = 3.14159274f;
+    graph::TensorRange split_range;
+    split_range.min = -65504.5f;
+    split_range.max = 0.1f;
+    table.record("UNIT/conv", conv_range);
+    table.record("UNIT/split:1", split_range);
+    table.save(filename);
+
+    // Widen the ranges in memory, loading the file must restore the saved ones
+    graph::TensorRange wide_range;
+    wide_range.min = -1000.f;
+    wide_range.max = 1000.f;
+    table.record("UNIT/conv", wide_range);
+    table.record("UNIT/split:1", wide_range);
+    ARM_COMPUTE_EXPECT(table.load(filename), framework::LogLevel::ERRORS);
+
+    graph::TensorRange range;
+    ARM_COMPUTE_EXPECT(table.find("UNIT/conv", range), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(range.min == conv_range.min && range.max == conv_range.max, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(table.find("UNIT/split:1", range), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(range.min == split_range.min && range.max == split_range.max, framework::LogLevel::ERRORS);
+    std::remove(filename.c_str());
+}
+
+TEST_CASE(LoadSkipsMalformedLines, framework::DatasetMode::ALL)
+{
+    const std::string filename = "quantization_table_unit_test_malformed.txt";
+    {
+        std::ofstream file(filename);
+        file << "UNIT/relu;-0.5;6" << std::endl;
+        file << "UNIT/no_range" << std::endl;
+        file << "UNIT/no_max;1" << std::endl;
+        file << std::endl;
+    }
+
+    auto &table = graph::QuantizationTable::get();
+    ARM_COMPUTE_EXPECT(table.load(filename), framework::LogLevel::ERRORS);
+    std::remove(filename.c_str());
+
+    graph::TensorRange range;
+    ARM_COMPUTE_EXPECT(table.find("UNIT/relu", range), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(range.min == -0.5f && range.max == 6.f, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!table.find("UNIT/no_range", range), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!table.find("UNIT/no_max", range), framework::LogLevel::ERRORS);
+
+    // Missing files are reported
+    ARM_COMPUTE_EXPECT(!table.load("quantization_table_unit_test_missing.txt"), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(BatchNormalizationFolding, framework::DatasetMode::ALL)
+{
+    // scale = gamma / sqrt(var + epsilon) and shift = beta - mean * scale
+    const graph::detail::BatchNormalizationFolding folding = graph::detail::compute_batch_normalization_folding({ 1.f, -2.f, 0.5f }, { 4.f, 0.25f, 1.f },
+                                                                                                                { 0.5f, 0.f, -1.f }, { 2.f, 1.f, -0.5f }, 0.f);
+    const std::vector<float> expected_scale{ 1.f, 2.f, -0.5f };
+    const std::vector<float> expected_shift{ -0.5f, 4.f, -0.75f };
+    ARM_COMPUTE_ASSERT(folding.scale.size() == 3 && folding.shift.size() == 3);
+    for(size_t c = 0; c < 3; ++c)
+    {
+        ARM_COMPUTE_EXPECT(is_close(folding.scale[c], expected_scale[c]), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(is_close(folding.shift[c], expected_shift[c]), framework::LogLevel::ERRORS);
+    }
+
+    // Missing beta and gamma are zeros and ones, epsilon is added to the variance
+    const graph::detail::BatchNormalizationFolding defaults = graph::detail::compute_batch_normalization_folding({ 3.f, -1.f }, { 0.999f, 3.999f }, {}, {}, 0.001f);
+    ARM_COMPUTE_ASSERT(defaults.scale.size() == 2 && defaults.shift.size() == 2);
+    ARM_COMPUTE_EXPECT(is_close(defaults.scale[0], 1.f) && is_close(defaults.shift[0], -3.f), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(defaults.scale[1], 0.5f) && is_close(defaults.shift[1], 0.5f), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(FoldedWeightsRange, framework::DatasetMode::ALL)
+{
+    // NCHW convolution weights [kernel_x, kernel_y, IFM, OFM], the output channels are folded with a negative and a large factor
+    constexpr size_t                               ofm_dim = 3;
+    const graph::detail::BatchNormalizationFolding folding = graph::detail::compute_batch_normalization_folding({ 0.f, 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f, 1.f },
+                                                                                                                {}, { 2.f, -0.5f, 1.f, 4.f }, 0.f);
+
+    Tensor weights;
+    weights.allocator()->init(TensorInfo(TensorShape(3U, 3U, 2U, 4U), 1, DataType::F32));
+    weights.allocator()->allocate();
+    float                                *values = reinterpret_cast<float *>(weights.buffer());
+    std::mt19937                          gen(library->seed());
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    const size_t                          num_values = weights.info()->tensor_shape().total_size();
+    for(size_t i = 0; i < num_values; ++i)
+    {
+        values[i] = distribution(gen);
+    }
+
+    // The range recorded when calibrating is the one of the folded weights
+    const graph::TensorRange range = graph::detail::compute_range(weights, &folding.scale, ofm_dim);
+    float                    low   = std::numeric_limits<float>::max();
+    float                    high  = std::numeric_limits<float>::lowest();
+    const size_t             per_c = num_values / 4;
+    for(size_t i = 0; i < num_values; ++i)
+    {
+        low  = std::min(low, values[i] * folding.scale[i / per_c]);
+        high = std::max(high, values[i] * folding.scale[i / per_c]);
+    }
+    ARM_COMPUTE_EXPECT(range.min == low && range.max == high, framework::LogLevel::ERRORS);
+
+    // Quantizing with that range as the quantizing accessor does must not clip any folded weight
+    Tensor quantized;
+    quantized.allocator()->init(TensorInfo(weights.info()->tensor_shape(), 1, DataType::QASYMM8, range.quantization_info()));
+    quantized.allocator()->allocate();
+    graph::detail::quantize_values(weights, quantized, &folding, ofm_dim);
+
+    const UniformQuantizationInfo qinfo = quantized.info()->quantization_info().uniform();
+    for(size_t i = 0; i < num_values; ++i)
+    {
+        const float folded = values[i] * folding.scale[i / per_c];
+        ARM_COMPUTE_EXPECT(is_close(dequantize_qasymm8(quantized.buffer()[i], qinfo), folded, qinfo.scale * 0.5f + 1e-5f), framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // QuantizationTable
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
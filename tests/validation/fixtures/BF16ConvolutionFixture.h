@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_BF16_CONVOLUTION_FIXTURE
+#define ARM_COMPUTE_TEST_BF16_CONVOLUTION_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+
+#include <cmath>
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Common parts of the fixtures validating F32 convolutions that compute their GEMM in BF16
+ *
+ * The reference is the F32 convolution run on the input and the weights rounded to BF16, as the functions convert them.
+ */
+template <typename TensorType, typename AccessorType>
+class BF16ConvolutionValidationBaseFixture : public framework::Fixture
+{
+protected:
+    template <typename U>
+    void fill(U &&tensor, int seed, float min = -1.f, float max = 1.f)
+    {
+        std::uniform_real_distribution<float> distribution(min, max);
+        library->fill(tensor, distribution, seed);
+    }
+
+    /** Rounds the values of a reference tensor to BF16 */
+    void round_to_bf16(SimpleTensor<float> &tensor)
+    {
+        for(int i = 0; i < tensor.num_elements(); ++i)
+        {
+            tensor[i] = float(bfloat16(tensor[i]));
+        }
+    }
+
+    /** Permutes the shapes of the target to the data layout */
+    void permute_shapes(TensorShape &src_shape, TensorShape &w_shape, TensorShape &dst_shape)
+    {
+        if(_data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+            permute(w_shape, PermutationVector(2U, 0U, 1U));
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+    }
+
+    /** Convolution of the input and the weights rounded to BF16, followed by the activation */
+    SimpleTensor<float> compute_bf16_convolution(SimpleTensor<float> &src, SimpleTensor<float> &w, const SimpleTensor<float> &b, const TensorShape &dst_shape, const PadStrideInfo &info,
+                                                 const Size2D &dilation, const ActivationLayerInfo &act_info)
+    {
+        round_to_bf16(src);
+        round_to_bf16(w);
+        SimpleTensor<float> dst = reference::convolution_layer<float>(src, w, b, dst_shape, info, dilation);
+        return act_info.enabled() ? reference::activation_layer<float>(dst, act_info) : dst;
+    }
+
+    TensorType          _target{};
+    SimpleTensor<float> _reference{};
+    DataLayout          _data_layout{};
+};
+
+/** Validates an F32 convolution computing its GEMM in BF16
+ *
+ * The function is run twice: the input and the original weights are overwritten in between, the second run must
+ * convert the new input and keep using the weights converted when preparing.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class BF16ConvolutionValidationFixture : public BF16ConvolutionValidationBaseFixture<TensorType, AccessorType>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, Size2D dilation, DataLayout data_layout,
+               ActivationLayerInfo act_info)
+    {
+        this->_data_layout = data_layout;
+        this->_target      = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, dilation, act_info);
+        this->_reference   = compute_reference(input_shape, weights_shape, bias_shape, output_shape, info, dilation, act_info);
+    }
+
+protected:
+    TensorType compute_target(TensorShape src_shape, TensorShape w_shape, const TensorShape &b_shape, TensorShape dst_shape, const PadStrideInfo &info, const Size2D &dilation,
+                              const ActivationLayerInfo &act_info)
+    {
+        this->permute_shapes(src_shape, w_shape, dst_shape);
+
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(src_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType w   = create_tensor<TensorType>(w_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType b   = create_tensor<TensorType>(b_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType dst = create_tensor<TensorType>(dst_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+
+        // Create and configure function
+        FunctionType conv;
+        conv.configure(&src, &w, &b, &dst, info, WeightsInfo(), dilation, act_info);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        for(TensorType *tensor : { &src, &w, &b, &dst })
+        {
+            tensor->allocator()->allocate();
+        }
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // First run on another input, the weights are converted to BF16 when preparing
+        this->fill(AccessorType(src), 3);
+        this->fill(AccessorType(w), 1);
+        this->fill(AccessorType(b), 2);
+        conv.run();
+        ARM_COMPUTE_EXPECT(!w.is_used(), framework::LogLevel::ERRORS);
+
+        // Second run on the validated input, after the original weights are overwritten
+        this->fill(AccessorType(src), 0);
+        this->fill(AccessorType(w), 4);
+        conv.run();
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const TensorShape &src_shape, const TensorShape &w_shape, const TensorShape &b_shape, const TensorShape &dst_shape, const PadStrideInfo &info,
+                                          const Size2D &dilation, const ActivationLayerInfo &act_info)
+    {
+        // Create reference
+        SimpleTensor<float> src{ src_shape, DataType::F32 };
+        SimpleTensor<float> w{ w_shape, DataType::F32 };
+        SimpleTensor<float> b{ b_shape, DataType::F32 };
+
+        // Fill reference
+        this->fill(src, 0);
+        this->fill(w, 1);
+        this->fill(b, 2);
+
+        return this->compute_bf16_convolution(src, w, b, dst_shape, info, dilation, act_info);
+    }
+};
+
+/** Validates a convolution computing its GEMM in BF16 with a batch normalization fused into its weights
+ *
+ * The batch normalization is folded into the F32 weights and biases before they are converted to BF16, so the reference
+ * rounds the folded weights. Without biases, the fused function creates the biases the batch normalization is folded into.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType>
+class BF16FusedConvolutionBatchNormalizationValidationFixture : public BF16ConvolutionValidationBaseFixture<TensorType, AccessorType>
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, PadStrideInfo info, Size2D dilation, bool has_bias,
+               DataLayout data_layout, ActivationLayerInfo act_info)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(dilation != Size2D(1U, 1U), "The fused function does not take a dilation");
+        this->_data_layout = data_layout;
+        _has_bias          = has_bias;
+        _epsilon           = 0.001f;
+        this->_target      = compute_target(input_shape, weights_shape, bias_shape, output_shape, info, act_info);
+        this->_reference   = compute_reference(input_shape, weights_shape, bias_shape, output_shape, info, act_info);
+    }
+
+protected:
+    TensorType compute_target(TensorShape src_shape, TensorShape w_shape, const TensorShape &b_shape, TensorShape dst_shape, const PadStrideInfo &info, const ActivationLayerInfo &act_info)
+    {
+        this->permute_shapes(src_shape, w_shape, dst_shape);
+
+        // Create tensors
+        TensorType src   = create_tensor<TensorType>(src_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType w     = create_tensor<TensorType>(w_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType b     = create_tensor<TensorType>(b_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType mean  = create_tensor<TensorType>(b_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType var   = create_tensor<TensorType>(b_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType beta  = create_tensor<TensorType>(b_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType gamma = create_tensor<TensorType>(b_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+        TensorType dst   = create_tensor<TensorType>(dst_shape, DataType::F32, 1, QuantizationInfo(), this->_data_layout);
+
+        // Create and configure function
+        FunctionType fused;
+        fused.configure(&src, &w, _has_bias ? &b : nullptr, &dst, &mean, &var, &beta, &gamma, _epsilon, info, 1 /* num_groups */, false /* fast_math */, act_info);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        for(TensorType *tensor : { &src, &w, &b, &mean, &var, &beta, &gamma, &dst })
+        {
+            tensor->allocator()->allocate();
+        }
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        this->fill(AccessorType(src), 0);
+        this->fill(AccessorType(w), 1);
+        this->fill(AccessorType(b), 2);
+        this->fill(AccessorType(mean), 3);
+        this->fill(AccessorType(var), 4, 0.5f, 1.5f);
+        this->fill(AccessorType(beta), 5);
+        this->fill(AccessorType(gamma), 6);
+
+        // Compute function twice, the batch normalization must only be folded once
+        fused.run();
+        fused.run();
+
+        return dst;
+    }
+
+    SimpleTensor<float> compute_reference(const TensorShape &src_shape, const TensorShape &w_shape, const TensorShape &b_shape, const TensorShape &dst_shape, const PadStrideInfo &info,
+                                          const ActivationLayerInfo &act_info)
+    {
+        // Create reference
+        SimpleTensor<float> src{ src_shape, DataType::F32 };
+        SimpleTensor<float> w{ w_shape, DataType::F32 };
+        SimpleTensor<float> b{ b_shape, DataType::F32 };
+        SimpleTensor<float> mean{ b_shape, DataType::F32 };
+        SimpleTensor<float> var{ b_shape, DataType::F32 };
+        SimpleTensor<float> beta{ b_shape, DataType::F32 };
+        SimpleTensor<float> gamma{ b_shape, DataType::F32 };
+
+        // Fill reference
+        this->fill(src, 0);
+        this->fill(w, 1);
+        _has_bias ? this->fill(b, 2) : library->fill_tensor_value(b, 0.f);
+        this->fill(mean, 3);
+        this->fill(var, 4, 0.5f, 1.5f);
+        this->fill(beta, 5);
+        this->fill(gamma, 6);
+
+        // Fold the batch normalization into the weights [kernel_x, kernel_y, IFM, OFM] and the biases
+        const int weights_per_ofm = w_shape[0] * w_shape[1] * w_shape[2];
+        for(int ofm = 0; ofm < static_cast<int>(w_shape[3]); ++ofm)
+        {
+            const float scale = gamma[ofm] / std::sqrt(var[ofm] + _epsilon);
+            for(int i = 0; i < weights_per_ofm; ++i)
+            {
+                w[ofm * weights_per_ofm + i] *= scale;
+            }
+            b[ofm] = (b[ofm] - mean[ofm]) * scale + beta[ofm];
+        }
+
+        return this->compute_bf16_convolution(src, w, b, dst_shape, info, Size2D(1U, 1U), act_info);
+    }
+
+    bool  _has_bias{};
+    float _epsilon{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_BF16_CONVOLUTION_FIXTURE */
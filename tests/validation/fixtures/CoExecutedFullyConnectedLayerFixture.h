@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_CO_EXECUTED_FULLY_CONNECTED_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_CO_EXECUTED_FULLY_CONNECTED_LAYER_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/detail/ClusterWorker.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/FullyConnectedLayer.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Validates a fully connected layer whose outputs are split between the calling thread and the worker of the other cluster
+ *
+ * The first @p split outputs are computed by a @p PartFunctionType on the calling thread, the others by a second one on the
+ * worker of the little cluster, both writing straight into the output of the layer.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename PartFunctionType, typename T>
+class CoExecutedFullyConnectedLayerValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape src_shape, unsigned int num_outputs, unsigned int split, DataType data_type)
+    {
+        _data_type = data_type;
+
+        const TensorShape w_shape(src_shape[0] * src_shape[1] * src_shape[2], num_outputs);
+        const TensorShape b_shape(num_outputs);
+        TensorShape       dst_shape(num_outputs);
+        if(src_shape.num_dimensions() > 3)
+        {
+            dst_shape.set(1, src_shape[3]);
+        }
+
+        _target    = compute_target(src_shape, w_shape, b_shape, dst_shape, split);
+        _reference = compute_reference(src_shape, w_shape, b_shape, dst_shape);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int seed)
+    {
+        static_assert(std::is_floating_point<T>::value, "Only floating point data types supported.");
+        std::uniform_real_distribution<T> distribution(T(-1.f), T(1.f));
+        library->fill(tensor, distribution, seed);
+    }
+
+    TensorType compute_target(const TensorShape &src_shape, const TensorShape &w_shape, const TensorShape &b_shape, const TensorShape &dst_shape, unsigned int split)
+    {
+        // Create tensors
+        TensorType src = create_tensor<TensorType>(src_shape, _data_type, 1);
+        TensorType w   = create_tensor<TensorType>(w_shape, _data_type, 1);
+        TensorType b   = create_tensor<TensorType>(b_shape, _data_type, 1);
+        TensorType dst = create_tensor<TensorType>(dst_shape, _data_type, 1);
+
+        // Create and configure function, the outputs are in the second dimension of the weights
+        using PartTensorType                  = typename FunctionType::TensorType;
+        graph::detail::ClusterWorker &partner = graph::detail::ClusterWorker::get(graph::GraphConfig(), 0);
+        FunctionType                  co_executed(partner);
+        co_executed.configure(&w, &b, &dst, 1 /* weights_dim */, 0 /* output_dim */, split, [&](PartTensorType * wei, PartTensorType * bia, PartTensorType * out)
+        {
+            auto part = std::make_unique<PartFunctionType>();
+            part->configure(&src, wei, bia, out, FullyConnectedLayerInfo());
+            return part;
+        });
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        for(TensorType *tensor : { &src, &w, &b, &dst })
+        {
+            tensor->allocator()->allocate();
+        }
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(w), 1);
+        fill(AccessorType(b), 2);
+
+        // Compute function twice, the views of the parts are imported again on each run
+        co_executed.run();
+        co_executed.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &src_shape, const TensorShape &w_shape, const TensorShape &b_shape, const TensorShape &dst_shape)
+    {
+        // Create reference
+        SimpleTensor<T> src{ src_shape, _data_type, 1 };
+        SimpleTensor<T> w{ w_shape, _data_type, 1 };
+        SimpleTensor<T> b{ b_shape, _data_type, 1 };
+
+        // Fill reference
+        fill(src, 0);
+        fill(w, 1);
+        fill(b, 2);
+
+        return reference::fully_connected_layer<T>(src, w, b, dst_shape);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    DataType        _data_type{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_CO_EXECUTED_FULLY_CONNECTED_LAYER_FIXTURE */
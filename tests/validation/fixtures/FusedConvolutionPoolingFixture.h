@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_FUSED_CONVOLUTION_POOLING_FIXTURE
+#define ARM_COMPUTE_TEST_FUSED_CONVOLUTION_POOLING_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/BatchNormalizationLayer.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/PoolingLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Validates a convolution fused with the pooling layer reading its output against the convolution and the pooling run one after the other
+ *
+ * With @p use_bn, a batch normalization is folded into the weights of the convolution and the convolution has no biases.
+ * The activation is fused in the convolution, before the pooling.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FusedConvolutionPoolingValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape src_shape, Size2D kernel_size, PadStrideInfo conv_info, unsigned int num_outputs, PoolingLayerInfo pool_info, bool use_bn, ActivationLayerInfo act_info, DataType data_type,
+               DataLayout data_layout)
+    {
+        _data_type   = data_type;
+        _data_layout = data_layout;
+        _use_bn      = use_bn;
+        _epsilon     = 0.001f;
+
+        pool_info.data_layout = data_layout;
+
+        const TensorShape w_shape(kernel_size.width, kernel_size.height, src_shape[2], num_outputs);
+        const TensorShape conv_shape = misc::shape_calculator::compute_deep_convolution_shape(TensorInfo(src_shape, 1, data_type), TensorInfo(w_shape, 1, data_type), conv_info);
+        const TensorShape dst_shape  = misc::shape_calculator::compute_pool_shape(TensorInfo(conv_shape, 1, data_type), pool_info);
+
+        _target    = compute_target(src_shape, w_shape, dst_shape, conv_info, pool_info, act_info);
+        _reference = compute_reference(src_shape, w_shape, conv_shape, conv_info, pool_info, act_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int seed, bool positive = false)
+    {
+        static_assert(std::is_floating_point<T>::value || std::is_same<T, half>::value, "Only floating point data types supported.");
+        using DistributionType = typename std::conditional<std::is_same<T, half>::value, arm_compute::utils::uniform_real_distribution_16bit<T>, std::uniform_real_distribution<T>>::type;
+
+        DistributionType distribution{ T(positive ? 0.f : -1.f), T(1.f) };
+        library->fill(tensor, distribution, seed);
+    }
+
+    TensorType compute_target(TensorShape src_shape, TensorShape w_shape, TensorShape dst_shape, const PadStrideInfo &conv_info, const PoolingLayerInfo &pool_info, const ActivationLayerInfo &act_info)
+    {
+        if(_data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+            permute(w_shape, PermutationVector(2U, 0U, 1U));
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+        const TensorShape b_shape(w_shape[3]);
+
+        // Create tensors
+        TensorType src   = create_tensor<TensorType>(src_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType w     = create_tensor<TensorType>(w_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType b     = create_tensor<TensorType>(b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType mean  = create_tensor<TensorType>(b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType var   = create_tensor<TensorType>(b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType beta  = create_tensor<TensorType>(b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType gamma = create_tensor<TensorType>(b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType dst   = create_tensor<TensorType>(dst_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+
+        // Create and configure function
+        FunctionType fused;
+        fused.configure(&src, &w, _use_bn ? nullptr : &b, &dst,
+                        _use_bn ? &mean : nullptr, _use_bn ? &var : nullptr, _use_bn ? &beta : nullptr, _use_bn ? &gamma : nullptr,
+                        _epsilon, conv_info, act_info, pool_info);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        for(TensorType *tensor : { &src, &w, &b, &mean, &var, &beta, &gamma, &dst })
+        {
+            tensor->allocator()->allocate();
+        }
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(w), 1);
+        fill(AccessorType(b), 2);
+        fill(AccessorType(mean), 3);
+        fill(AccessorType(var), 4, true);
+        fill(AccessorType(beta), 5);
+        fill(AccessorType(gamma), 6);
+
+        // Compute function
+        fused.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &src_shape, const TensorShape &w_shape, const TensorShape &conv_shape, const PadStrideInfo &conv_info, const PoolingLayerInfo &pool_info,
+                                      const ActivationLayerInfo &act_info)
+    {
+        const TensorShape b_shape(w_shape[3]);
+
+        // Create reference
+        SimpleTensor<T> src{ src_shape, _data_type, 1 };
+        SimpleTensor<T> w{ w_shape, _data_type, 1 };
+        SimpleTensor<T> b{ b_shape, _data_type, 1 };
+        SimpleTensor<T> mean{ b_shape, _data_type, 1 };
+        SimpleTensor<T> var{ b_shape, _data_type, 1 };
+        SimpleTensor<T> beta{ b_shape, _data_type, 1 };
+        SimpleTensor<T> gamma{ b_shape, _data_type, 1 };
+
+        // Fill reference
+        fill(src, 0);
+        fill(w, 1);
+        _use_bn ? library->fill_tensor_value(b, T(0.f)) : fill(b, 2);
+        fill(mean, 3);
+        fill(var, 4, true);
+        fill(beta, 5);
+        fill(gamma, 6);
+
+        // Calculate convolution (+ BN) + activation, then pooling
+        SimpleTensor<T> conv = reference::convolution_layer(src, w, b, conv_shape, conv_info);
+        if(_use_bn)
+        {
+            conv = reference::batch_normalization_layer(conv, mean, var, beta, gamma, _epsilon, act_info);
+        }
+        else if(act_info.enabled())
+        {
+            conv = reference::activation_layer(conv, act_info);
+        }
+
+        return reference::pooling_layer<T>(conv, pool_info, QuantizationInfo(), nullptr);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    DataType        _data_type{};
+    DataLayout      _data_layout{};
+    bool            _use_bn{};
+    float           _epsilon{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_FUSED_CONVOLUTION_POOLING_FIXTURE */
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_FUSED_DEPTHWISE_POINTWISE_CONVOLUTION_FIXTURE
+#define ARM_COMPUTE_TEST_FUSED_DEPTHWISE_POINTWISE_CONVOLUTION_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/ActivationLayer.h"
+#include "tests/validation/reference/BatchNormalizationLayer.h"
+#include "tests/validation/reference/ConvolutionLayer.h"
+#include "tests/validation/reference/DepthwiseConvolutionLayer.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Validates a depthwise convolution fused with the 1x1 convolution reading its output against the two convolutions run one after the other
+ *
+ * With @p use_bn, a batch normalization is folded into the weights of each convolution and the convolutions have no biases,
+ * as in the layers of MobileNet. The activation is fused in both convolutions.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class FusedDepthwisePointwiseConvolutionValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape src_shape, Size2D kernel_size, PadStrideInfo dwc_info, unsigned int num_outputs, bool use_bn, ActivationLayerInfo act_info, DataType data_type, DataLayout data_layout)
+    {
+        _data_type   = data_type;
+        _data_layout = data_layout;
+        _use_bn      = use_bn;
+        _epsilon     = 0.001f;
+
+        const unsigned int num_channels = src_shape[2];
+        const TensorShape  dwc_w_shape(kernel_size.width, kernel_size.height, num_channels);
+        const TensorShape  dwc_shape = misc::shape_calculator::compute_depthwise_convolution_shape(TensorInfo(src_shape, 1, data_type), TensorInfo(dwc_w_shape, 1, data_type), dwc_info, 1U);
+        const TensorShape  pwc_w_shape(1U, 1U, num_channels, num_outputs);
+        TensorShape        dst_shape = dwc_shape;
+        dst_shape.set(2, num_outputs);
+
+        _target    = compute_target(src_shape, dwc_w_shape, pwc_w_shape, dst_shape, dwc_info, act_info);
+        _reference = compute_reference(src_shape, dwc_w_shape, dwc_shape, pwc_w_shape, dst_shape, dwc_info, act_info);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int seed, bool positive = false)
+    {
+        static_assert(std::is_floating_point<T>::value || std::is_same<T, half>::value, "Only floating point data types supported.");
+        using DistributionType = typename std::conditional<std::is_same<T, half>::value, arm_compute::utils::uniform_real_distribution_16bit<T>, std::uniform_real_distribution<T>>::type;
+
+        DistributionType distribution{ T(positive ? 0.f : -1.f), T(1.f) };
+        library->fill(tensor, distribution, seed);
+    }
+
+    TensorType compute_target(TensorShape src_shape, TensorShape dwc_w_shape, TensorShape pwc_w_shape, TensorShape dst_shape, const PadStrideInfo &dwc_info, const ActivationLayerInfo &act_info)
+    {
+        if(_data_layout == DataLayout::NHWC)
+        {
+            permute(src_shape, PermutationVector(2U, 0U, 1U));
+            permute(dwc_w_shape, PermutationVector(2U, 0U, 1U));
+            permute(pwc_w_shape, PermutationVector(2U, 0U, 1U));
+            permute(dst_shape, PermutationVector(2U, 0U, 1U));
+        }
+        const TensorShape dwc_b_shape(src_shape[get_data_layout_dimension_index(_data_layout, DataLayoutDimension::CHANNEL)]);
+        const TensorShape pwc_b_shape(pwc_w_shape[3]);
+
+        // Create tensors
+        TensorType src       = create_tensor<TensorType>(src_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType dwc_w     = create_tensor<TensorType>(dwc_w_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType dwc_b     = create_tensor<TensorType>(dwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType dwc_mean  = create_tensor<TensorType>(dwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType dwc_var   = create_tensor<TensorType>(dwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType dwc_beta  = create_tensor<TensorType>(dwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType dwc_gamma = create_tensor<TensorType>(dwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType pwc_w     = create_tensor<TensorType>(pwc_w_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType pwc_b     = create_tensor<TensorType>(pwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType pwc_mean  = create_tensor<TensorType>(pwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType pwc_var   = create_tensor<TensorType>(pwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType pwc_beta  = create_tensor<TensorType>(pwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType pwc_gamma = create_tensor<TensorType>(pwc_b_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+        TensorType dst       = create_tensor<TensorType>(dst_shape, _data_type, 1, QuantizationInfo(), _data_layout);
+
+        // Create and configure function
+        FunctionType fused;
+        fused.configure(&src,
+                        &dwc_w, _use_bn ? nullptr : &dwc_b,
+                        _use_bn ? &dwc_mean : nullptr, _use_bn ? &dwc_var : nullptr, _use_bn ? &dwc_beta : nullptr, _use_bn ? &dwc_gamma : nullptr,
+                        _epsilon, dwc_info, act_info,
+                        &pwc_w, _use_bn ? nullptr : &pwc_b,
+                        _use_bn ? &pwc_mean : nullptr, _use_bn ? &pwc_var : nullptr, _use_bn ? &pwc_beta : nullptr, _use_bn ? &pwc_gamma : nullptr,
+                        _epsilon, act_info,
+                        &dst);
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        for(TensorType *tensor : { &src, &dwc_w, &dwc_b, &dwc_mean, &dwc_var, &dwc_beta, &dwc_gamma, &pwc_w, &pwc_b, &pwc_mean, &pwc_var, &pwc_beta, &pwc_gamma, &dst })
+        {
+            tensor->allocator()->allocate();
+        }
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill(AccessorType(dwc_w), 1);
+        fill(AccessorType(dwc_b), 2);
+        fill(AccessorType(dwc_mean), 3);
+        fill(AccessorType(dwc_var), 4, true);
+        fill(AccessorType(dwc_beta), 5);
+        fill(AccessorType(dwc_gamma), 6);
+        fill(AccessorType(pwc_w), 7);
+        fill(AccessorType(pwc_b), 8);
+        fill(AccessorType(pwc_mean), 9);
+        fill(AccessorType(pwc_var), 10, true);
+        fill(AccessorType(pwc_beta), 11);
+        fill(AccessorType(pwc_gamma), 12);
+
+        // Compute function
+        fused.run();
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &src_shape, const TensorShape &dwc_w_shape, const TensorShape &dwc_shape, const TensorShape &pwc_w_shape, const TensorShape &dst_shape,
+                                      const PadStrideInfo &dwc_info, const ActivationLayerInfo &act_info)
+    {
+        const TensorShape dwc_b_shape(dwc_shape[2]);
+        const TensorShape pwc_b_shape(dst_shape[2]);
+
+        // Create reference
+        SimpleTensor<T> src{ src_shape, _data_type, 1 };
+        SimpleTensor<T> dwc_w{ dwc_w_shape, _data_type, 1 };
+        SimpleTensor<T> dwc_b{ dwc_b_shape, _data_type, 1 };
+        SimpleTensor<T> dwc_mean{ dwc_b_shape, _data_type, 1 };
+        SimpleTensor<T> dwc_var{ dwc_b_shape, _data_type, 1 };
+        SimpleTensor<T> dwc_beta{ dwc_b_shape, _data_type, 1 };
+        SimpleTensor<T> dwc_gamma{ dwc_b_shape, _data_type, 1 };
+        SimpleTensor<T> pwc_w{ pwc_w_shape, _data_type, 1 };
+        SimpleTensor<T> pwc_b{ pwc_b_shape, _data_type, 1 };
+        SimpleTensor<T> pwc_mean{ pwc_b_shape, _data_type, 1 };
+        SimpleTensor<T> pwc_var{ pwc_b_shape, _data_type, 1 };
+        SimpleTensor<T> pwc_beta{ pwc_b_shape, _data_type, 1 };
+        SimpleTensor<T> pwc_gamma{ pwc_b_shape, _data_type, 1 };
+
+        // Fill reference
+        fill(src, 0);
+        fill(dwc_w, 1);
+        _use_bn ? library->fill_tensor_value(dwc_b, T(0.f)) : fill(dwc_b, 2);
+        fill(dwc_mean, 3);
+        fill(dwc_var, 4, true);
+        fill(dwc_beta, 5);
+        fill(dwc_gamma, 6);
+        fill(pwc_w, 7);
+        _use_bn ? library->fill_tensor_value(pwc_b, T(0.f)) : fill(pwc_b, 8);
+        fill(pwc_mean, 9);
+        fill(pwc_var, 10, true);
+        fill(pwc_beta, 11);
+        fill(pwc_gamma, 12);
+
+        // Calculate depthwise convolution (+ BN) + activation, then 1x1 convolution (+ BN) + activation
+        SimpleTensor<T> dwc = reference::depthwise_convolution(src, dwc_w, dwc_b, dwc_shape, dwc_info, 1U);
+        dwc                 = _use_bn ? reference::batch_normalization_layer(dwc, dwc_mean, dwc_var, dwc_beta, dwc_gamma, _epsilon, act_info) : apply_activation(dwc, act_info);
+
+        SimpleTensor<T> pwc = reference::convolution_layer(dwc, pwc_w, pwc_b, dst_shape, PadStrideInfo(1, 1, 0, 0));
+        return _use_bn ? reference::batch_normalization_layer(pwc, pwc_mean, pwc_var, pwc_beta, pwc_gamma, _epsilon, act_info) : apply_activation(pwc, act_info);
+    }
+
+    static SimpleTensor<T> apply_activation(const SimpleTensor<T> &src, const ActivationLayerInfo &act_info)
+    {
+        return act_info.enabled() ? reference::activation_layer(src, act_info) : src;
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    DataType        _data_type{};
+    DataLayout      _data_layout{};
+    bool            _use_bn{};
+    float           _epsilon{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_FUSED_DEPTHWISE_POINTWISE_CONVOLUTION_FIXTURE */
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2021 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_SPARSE_FULLY_CONNECTED_LAYER_FIXTURE
+#define ARM_COMPUTE_TEST_SPARSE_FULLY_CONNECTED_LAYER_FIXTURE
+
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+#include "tests/AssetsLibrary.h"
+#include "tests/Globals.h"
+#include "tests/IAccessor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Fixture.h"
+#include "tests/validation/Helpers.h"
+#include "tests/validation/reference/FullyConnectedLayer.h"
+
+#include <random>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Blocks of the dense weights set to zero before they are packed
+ *
+ * Unscoped so that the datasets print it as an integer.
+ */
+enum WeightsPruning
+{
+    BLOCK_ROWS,   /**< Two block rows out of three are zero, and three blocks out of four in the others */
+    TAIL_COLUMNS, /**< Only the last block of each row is non-zero, which is partial when the number of inputs is not a multiple of 4 */
+    ALL_ZERO      /**< All the weights are zero, the output is the biases */
+};
+
+/** Validates a sparse fully connected layer on weights pruned block by block
+ *
+ * The weights are [num_inputs, num_outputs] and are packed in blocks of @p block_height outputs by 4 inputs,
+ * so @p block_height must be the one of the function.
+ */
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class SparseFullyConnectedLayerValidationFixture : public framework::Fixture
+{
+public:
+    template <typename...>
+    void setup(TensorShape input_shape, TensorShape weights_shape, TensorShape bias_shape, TensorShape output_shape, WeightsPruning pruning, unsigned int block_height, DataType data_type)
+    {
+        _data_type    = data_type;
+        _pruning      = pruning;
+        _block_height = block_height;
+
+        _target    = compute_target(input_shape, weights_shape, bias_shape, output_shape);
+        _reference = compute_reference(input_shape, weights_shape, bias_shape, output_shape);
+    }
+
+protected:
+    template <typename U>
+    void fill(U &&tensor, int seed)
+    {
+        static_assert(std::is_floating_point<T>::value, "Only floating point data types supported.");
+        std::uniform_real_distribution<T> distribution(T(-1.f), T(1.f));
+        library->fill(tensor, distribution, seed);
+    }
+
+    /** Checks if a weight is in a pruned block */
+    bool is_pruned(int input, int output, int num_inputs) const
+    {
+        const int block_row = output / static_cast<int>(_block_height);
+        const int block_col = input / 4;
+        switch(_pruning)
+        {
+            case WeightsPruning::BLOCK_ROWS:
+                return (block_row % 3) != 0 || ((block_row + block_col) % 4) != 0;
+            case WeightsPruning::TAIL_COLUMNS:
+                return block_col != (num_inputs - 1) / 4;
+            case WeightsPruning::ALL_ZERO:
+            default:
+                return true;
+        }
+    }
+
+    /** Fills the weights and sets the pruned blocks to zero */
+    template <typename U>
+    void fill_pruned_weights(U &&weights, const TensorShape &shape)
+    {
+        fill(weights, 1);
+        for(int o = 0; o < static_cast<int>(shape[1]); ++o)
+        {
+            for(int i = 0; i < static_cast<int>(shape[0]); ++i)
+            {
+                if(is_pruned(i, o, shape[0]))
+                {
+                    *reinterpret_cast<T *>(weights(Coordinates(i, o))) = T(0);
+                }
+            }
+        }
+    }
+
+    TensorType compute_target(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape)
+    {
+        // Create tensors
+        TensorType src     = create_tensor<TensorType>(input_shape, _data_type, 1);
+        TensorType weights = create_tensor<TensorType>(weights_shape, _data_type, 1);
+        TensorType bias    = create_tensor<TensorType>(bias_shape, _data_type, 1);
+        TensorType dst     = create_tensor<TensorType>(output_shape, _data_type, 1);
+
+        // Create and configure function
+        FunctionType fc;
+        fc.configure(&src, &weights, &bias, &dst, FullyConnectedLayerInfo());
+
+        ARM_COMPUTE_EXPECT(src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Allocate tensors
+        src.allocator()->allocate();
+        weights.allocator()->allocate();
+        bias.allocator()->allocate();
+        dst.allocator()->allocate();
+
+        ARM_COMPUTE_EXPECT(!src.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!weights.info()->is_resizable(), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!dst.info()->is_resizable(), framework::LogLevel::ERRORS);
+
+        // Fill tensors
+        fill(AccessorType(src), 0);
+        fill_pruned_weights(AccessorType(weights), weights_shape);
+        fill(AccessorType(bias), 2);
+
+        // Compute function
+        fc.run();
+
+        // Only the blocks left are packed, none at all for zero weights
+        if(_pruning == WeightsPruning::ALL_ZERO)
+        {
+            ARM_COMPUTE_EXPECT(fc.density() == 0.f, framework::LogLevel::ERRORS);
+        }
+        else
+        {
+            ARM_COMPUTE_EXPECT(fc.density() > 0.f && fc.density() < 0.5f, framework::LogLevel::ERRORS);
+        }
+
+        return dst;
+    }
+
+    SimpleTensor<T> compute_reference(const TensorShape &input_shape, const TensorShape &weights_shape, const TensorShape &bias_shape, const TensorShape &output_shape)
+    {
+        // Create reference
+        SimpleTensor<T> src{ input_shape, _data_type, 1 };
+        SimpleTensor<T> weights{ weights_shape, _data_type, 1 };
+        SimpleTensor<T> bias{ bias_shape, _data_type, 1 };
+
+        // Fill reference
+        fill(src, 0);
+        fill_pruned_weights(weights, weights_shape);
+        fill(bias, 2);
+
+        return reference::fully_connected_layer<T>(src, weights, bias, output_shape);
+    }
+
+    TensorType      _target{};
+    SimpleTensor<T> _reference{};
+    DataType        _data_type{};
+    WeightsPruning  _pruning{};
+    unsigned int    _block_height{};
+};
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_SPARSE_FULLY_CONNECTED_LAYER_FIXTURE */
@@ -24,6 +24,7 @@
 #include "CommonGraphOptions.h"
 
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/Utility.h"
 #include "arm_compute/graph/TypeLoader.h"
 #include "arm_compute/graph/TypePrinter.h"
 
@@ -68,6 +69,21 @@ std::pair<unsigned int, unsigned int> parse_validation_range(const std::string &
     }
     return range;
 }
+
+arm_compute::DataType parse_gemv_weights_type(const std::string &gemv_weights)
+{
+    if(gemv_weights.empty())
+    {
+        return arm_compute::DataType::UNKNOWN;
+    }
+    if(arm_compute::utility::tolower(gemv_weights) == "int8")
+    {
+        return arm_compute::DataType::QSYMM8_PER_CHANNEL;
+    }
+    const arm_compute::DataType data_type = arm_compute::data_type_from_name(gemv_weights);
+    ARM_COMPUTE_EXIT_ON_MSG(data_type != arm_compute::DataType::F32 && data_type != arm_compute::DataType::F16, "Only F32, F16 and INT8 GEMV weights are supported");
+    return data_type;
+}
 } // namespace
 
 namespace arm_compute
@@ -138,6 +154,23 @@ namespace utils
 
     os<<"Run network for "<<common_params.n<<" times.\n";
     os<<"Layer timing: "<<common_params.layer_time<<std::endl;
+    os<<"Task counters sampling: "<<common_params.counters<<std::endl;
+    os<<"Layer PMU counters: "<<common_params.pmu<<std::endl;
+    os<<"Tiled layer chains: "<<common_params.tile<<std::endl;
+    os<<"Measured convolution methods: "<<common_params.conv_table<<std::endl;
+    os<<"Concurrent branches: "<<common_params.branches<<std::endl;
+    os<<"Layers split with the other cluster: "<<common_params.co_execute<<std::endl;
+    os<<"Data layout planning: "<<common_params.plan_layouts<<std::endl;
+    os<<"Static transition memory: "<<common_params.static_memory<<std::endl;
+    os<<"Calibration: "<<common_params.calibrate<<std::endl;
+    os<<"Quantization table: "<<common_params.quant_table<<std::endl;
+    os<<"Pipeline bottleneck analysis: "<<common_params.bottleneck<<std::endl;
+    os<<"Stage data types: "<<(common_params.precision.empty() ? "all " + arm_compute::string_from_data_type(common_params.data_type) : common_params.precision)<<std::endl;
+    os<<"BF16 layers: "<<(common_params.bf16_layers.empty() ? "all convolutions" : common_params.bf16_layers)<<std::endl;
+    os<<"Kernel report: "<<common_params.kernel_report<<std::endl;
+    os<<"Sparse FC layers: "<<(common_params.sparse_fc.empty() ? "none" : common_params.sparse_fc)<<std::endl;
+    os<<"Sparse block: "<<common_params.sparse_block<<"x4"<<std::endl;
+    os<<"GEMV weights: "<<(common_params.gemv_weights == arm_compute::DataType::UNKNOWN ? "F32" : arm_compute::string_from_data_type(common_params.gemv_weights))<<std::endl;
     return os;
 }
 
@@ -167,6 +200,23 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
 	  n(parser.add_option<SimpleOption<int>>("n", 1)),
 	  total_cores(parser.add_option<SimpleOption<int>>("total_cores", 6)),
 	  layer_time(parser.add_option<SimpleOption<int>>("layer_time", 0)),
+	  counters(parser.add_option<SimpleOption<int>>("counters", 0)),
+	  pmu(parser.add_option<SimpleOption<int>>("pmu", 0)),
+	  tile(parser.add_option<SimpleOption<int>>("tile", 0)),
+	  conv_table(parser.add_option<SimpleOption<int>>("conv_table", 0)),
+	  branches(parser.add_option<SimpleOption<int>>("branches", 0)),
+	  co_execute(parser.add_option<SimpleOption<std::string>>("co_execute", "")),
+	  plan_layouts(parser.add_option<SimpleOption<int>>("plan_layouts", 0)),
+	  static_memory(parser.add_option<SimpleOption<int>>("static_memory", 0)),
+	  calibrate(parser.add_option<SimpleOption<int>>("calibrate", 0)),
+	  quant_table(parser.add_option<SimpleOption<std::string>>("quant_table", "")),
+	  bottleneck(parser.add_option<SimpleOption<int>>("bottleneck", 0)),
+	  precision(parser.add_option<SimpleOption<std::string>>("precision", "")),
+	  bf16_layers(parser.add_option<SimpleOption<std::string>>("bf16_layers", "")),
+	  kernel_report(parser.add_option<SimpleOption<int>>("kernel_report", 0)),
+	  sparse_fc(parser.add_option<SimpleOption<std::string>>("sparse_fc", "")),
+	  sparse_block(parser.add_option<SimpleOption<int>>("sparse_block", 1)),
+	  gemv_weights(parser.add_option<SimpleOption<std::string>>("gemv_weights", "")),
 	  order(parser.add_option<SimpleOption<std::string>>("order")),
 	  input_s(parser.add_option<SimpleOption<int>>("input_s", 227)),
 	  input_c(parser.add_option<SimpleOption<int>>("input_c", 3)),
@@ -235,6 +285,23 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     n->set_help("number of run");
     total_cores->set_help("total number of cores");
     layer_time->set_help("Layer timing");
+    counters->set_help("Sample always-on per-task counters every N frames without synchronization (0 disables)");
+    pmu->set_help("Count cycles, instructions, cache and branch misses per layer and report IPC and miss rates");
+    tile->set_help("Run chains of convolution, activation, normalization and pooling layers band by band so intermediates stay in cache");
+    conv_table->set_help("Use the fastest convolution method per layer for the cluster and number of threads of each stage, measured once and cached in conv_methods.csv");
+    branches->set_help("Run independent branches (e.g. inception towers) concurrently, each on half of the cores of the stage");
+    co_execute->set_help("Comma-separated names of heavy convolution and fully connected layers whose output channels are split between the big and little clusters, eg., conv5_1,fc6");
+    plan_layouts->set_help("Run each stage in the fastest data layout of its target (NHWC on Neon, NCHW on OpenCL), permuting only around layers that cannot be converted and when tensors cross stages");
+    static_memory->set_help("Place the tensors passed between layers at fixed offsets of one arena planned at finalize time instead of mapping memory pools every frame");
+    calibrate->set_help("Run the float graph over the input images and write the range of every tensor to the file given by quant_table");
+    quant_table->set_help("Ranges of the tensors written by a calibration run, used to quantize the graph when running in QASYMM8");
+    bottleneck->set_help("Report per-edge stall times, per-stage utilization and the bottleneck stage of the pipeline");
+    precision->set_help("Precision of each stage of the pipeline, eg., F32-F16-BF16 runs the second stage in half precision (needs FP16 arithmetic on its cores) and the convolutions of the third one on BF16 inputs with F32 accumulation (needs BF16 dot products), converting tensors when they cross stages. Empty runs every stage in type");
+    bf16_layers->set_help("Comma-separated names of the convolutions the BF16 stages run in BF16, eg., conv2,conv3. Empty converts every convolution of those stages");
+    kernel_report->set_help("Print the function and assembly kernel chosen for each layer when a stage is finalized");
+    sparse_fc->set_help("Comma-separated names of the pruned fully connected layers to run with block-sparse weights, eg., fc6,fc7");
+    sparse_block->set_help("Outputs per block of the sparse fully connected weights: 1 (1x4 blocks) or 4 (4x4 blocks)");
+    gemv_weights->set_help("Data type the weights of the batch-1 F32 fully connected layers are stored in: F32, F16 (halves their traffic) or INT8 (symmetric per output, quarters it)");
     order->set_help("order of processors for sub graphs, eg., B-L-G");
 }
 
@@ -273,6 +340,23 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     common_params.n						 = options.n->value();
     common_params.total_cores			 = options.total_cores->value();
     common_params.layer_time			 = options.layer_time->value();
+    common_params.counters			 = options.counters->value();
+    common_params.pmu				 = options.pmu->value();
+    common_params.tile				 = options.tile->value();
+    common_params.conv_table			 = options.conv_table->value();
+    common_params.branches			 = options.branches->value();
+    common_params.co_execute		 = options.co_execute->value();
+    common_params.plan_layouts		 = options.plan_layouts->value();
+    common_params.static_memory		 = options.static_memory->value();
+    common_params.calibrate			 = options.calibrate->value();
+    common_params.quant_table		 = options.quant_table->value();
+    common_params.bottleneck		 = options.bottleneck->value();
+    common_params.precision			 = options.precision->value();
+    common_params.bf16_layers		 = options.bf16_layers->value();
+    common_params.kernel_report		 = options.kernel_report->value();
+    common_params.sparse_fc			 = options.sparse_fc->value();
+    common_params.sparse_block		 = options.sparse_block->value();
+    common_params.gemv_weights		 = parse_gemv_weights_type(options.gemv_weights->value());
     common_params.order              = options.order->value();
 
     common_params.input_c			 = options.input_c->value();
@@ -283,5 +367,31 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
 
     return common_params;
 }
+
+std::vector<StagePrecision> parse_stage_precisions(const std::string &precision, size_t num_stages, arm_compute::DataType default_type)
+{
+    if(precision.empty())
+    {
+        return std::vector<StagePrecision>(num_stages, StagePrecision{ default_type, arm_compute::graph::PrecisionPolicy::F32 });
+    }
+
+    ARM_COMPUTE_EXIT_ON_MSG(arm_compute::is_data_type_quantized(default_type), "Stages of a quantized graph cannot change data type");
+
+    std::vector<StagePrecision> precisions;
+    std::stringstream           stream(precision);
+    for(std::string name; std::getline(stream, name, '-');)
+    {
+        if(arm_compute::utility::tolower(name) == "bf16")
+        {
+            precisions.push_back(StagePrecision{ arm_compute::DataType::F32, arm_compute::graph::PrecisionPolicy::BF16 });
+            continue;
+        }
+        const arm_compute::DataType data_type = arm_compute::data_type_from_name(name);
+        ARM_COMPUTE_EXIT_ON_MSG(data_type != arm_compute::DataType::F32 && data_type != arm_compute::DataType::F16, "Only F32, F16 and BF16 stages are supported");
+        precisions.push_back(StagePrecision{ data_type, arm_compute::graph::PrecisionPolicy::F32 });
+    }
+    ARM_COMPUTE_EXIT_ON_MSG(precisions.size() != num_stages, "Precision must give one data type per stage");
+    return precisions;
+}
 } // namespace utils
 } // namespace arm_compute
@@ -120,6 +120,23 @@ struct CommonGraphParams
     int								 n{1};
     int								 total_cores{6};
     int								 layer_time{0};
+    int								 counters{0};
+    int								 pmu{0};
+    int								 tile{0};
+    int								 conv_table{0};
+    int								 branches{0};
+    std::string						 co_execute{};
+    int								 plan_layouts{0};
+    int								 static_memory{0};
+    int								 calibrate{0};
+    std::string						 quant_table{};
+    int								 bottleneck{0};
+    std::string						 precision{};
+    std::string						 bf16_layers{};
+    int								 kernel_report{0};
+    std::string						 sparse_fc{};
+    int								 sparse_block{1};
+    arm_compute::DataType			 gemv_weights{ arm_compute::DataType::UNKNOWN };
     std::string						 order{"B-L-G"};
 
     int								 input_c{3};
@@ -193,6 +210,23 @@ public:
     SimpleOption<int>					   *n;
     SimpleOption<int>					   *total_cores;
     SimpleOption<int>					   *layer_time;
+    SimpleOption<int>					   *counters;         /**< Sampling period of the always-on per-task counters */
+    SimpleOption<int>					   *pmu;              /**< Per-layer CPU hardware counters */
+    SimpleOption<int>					   *tile;             /**< Tile-wise execution of chains of spatially local layers */
+    SimpleOption<int>					   *conv_table;       /**< Measured convolution method selection */
+    SimpleOption<int>					   *branches;         /**< Concurrent execution of independent branches */
+    SimpleOption<std::string>			   *co_execute;       /**< Layers split between the big and little clusters */
+    SimpleOption<int>					   *plan_layouts;     /**< Per-stage data layout planning */
+    SimpleOption<int>					   *static_memory;    /**< Statically planned transition memory */
+    SimpleOption<int>					   *calibrate;        /**< Calibration of the float graph */
+    SimpleOption<std::string>			   *quant_table;      /**< Ranges of the tensors for quantization */
+    SimpleOption<int>					   *bottleneck;       /**< Pipeline stall and bottleneck analysis */
+    SimpleOption<std::string>			   *precision;        /**< Data type of each pipeline stage */
+    SimpleOption<std::string>			   *bf16_layers;      /**< Convolutions run in BF16 by the BF16 stages */
+    SimpleOption<int>					   *kernel_report;    /**< Report of the kernels chosen per layer */
+    SimpleOption<std::string>			   *sparse_fc;        /**< Fully connected layers run with block-sparse weights */
+    SimpleOption<int>					   *sparse_block;     /**< Outputs per block of the sparse weights */
+    SimpleOption<std::string>			   *gemv_weights;     /**< Data type of the weights of the batch-1 fully connected layers */
 
     SimpleOption<int>					   *input_c;
     SimpleOption<int>					   *input_s;
@@ -209,6 +243,25 @@ public:
  * @return Structure containing the common graph parameters
  */
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options);
+
+/** Data type and arithmetic of a stage of a pipelined graph */
+struct StagePrecision
+{
+    arm_compute::DataType               data_type;      /**< Data type of the tensors of the stage */
+    arm_compute::graph::PrecisionPolicy gemm_precision; /**< Arithmetic of the GEMM based convolutions of the stage */
+};
+
+/** Parses the precision of each stage of a pipelined graph
+ *
+ * A BF16 stage keeps F32 tensors and runs its GEMM based convolutions on BF16 inputs and weights with F32 accumulation.
+ *
+ * @param[in] precision    Precisions of the stages separated by '-' (e.g. F32-F16-BF16), F32, F16 and BF16 are supported
+ * @param[in] num_stages   Number of stages of the pipeline
+ * @param[in] default_type Data type of every stage when @p precision is empty
+ *
+ * @return The precision of each stage
+ */
+std::vector<StagePrecision> parse_stage_precisions(const std::string &precision, size_t num_stages, arm_compute::DataType default_type);
 } // namespace utils
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_EXAMPLES_UTILS_COMMON_GRAPH_OPTIONS */
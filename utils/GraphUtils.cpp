@@ -38,6 +38,7 @@ std::vector<arm_compute::graph::Tensor*> Receivers;
 
 std::vector<bool*> __waiting;//=true
 std::vector<bool*> __ready;//=false
+std::vector<PipelineEdgeStats*> edge_stats;
 
 bool *start_frame=new bool(true);
 
@@ -55,6 +56,7 @@ bool *start_frame=new bool(true);
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/frontend/Stream.h"
 #include "arm_compute/runtime/SubTensor.h"
 
 #pragma GCC diagnostic push
@@ -63,6 +65,8 @@ bool *start_frame=new bool(true);
 #pragma GCC diagnostic pop
 #include "utils/Utils.h"
 
+#include <algorithm>
+#include <cstring>
 #include <inttypes.h>
 #include <iomanip>
 #include <limits>
@@ -91,6 +95,94 @@ std::pair<arm_compute::TensorShape, arm_compute::PermutationVector> compute_perm
 
     return std::make_pair(permuted_shape, perm);
 }
+
+/** Reads an element of a float or QASYMM8 tensor as float */
+inline float load_as_float(const uint8_t *ptr, arm_compute::DataType data_type, const arm_compute::UniformQuantizationInfo &qinfo)
+{
+    switch(data_type)
+    {
+        case arm_compute::DataType::F32:
+            return *reinterpret_cast<const float *>(ptr);
+        case arm_compute::DataType::F16:
+            return static_cast<float>(*reinterpret_cast<const arm_compute::half *>(ptr));
+        case arm_compute::DataType::QASYMM8:
+            return arm_compute::dequantize_qasymm8(*ptr, qinfo);
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported across pipeline stages");
+            return 0.f;
+    }
+}
+
+/** Writes a float to an element of a float or QASYMM8 tensor */
+inline void store_from_float(uint8_t *ptr, arm_compute::DataType data_type, const arm_compute::UniformQuantizationInfo &qinfo, float value)
+{
+    switch(data_type)
+    {
+        case arm_compute::DataType::F32:
+            *reinterpret_cast<float *>(ptr) = value;
+            break;
+        case arm_compute::DataType::F16:
+            *reinterpret_cast<arm_compute::half *>(ptr) = arm_compute::half(value);
+            break;
+        case arm_compute::DataType::QASYMM8:
+            *ptr = arm_compute::quantize_qasymm8(value, qinfo);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported across pipeline stages");
+    }
+}
+
+/** Copies a tensor crossing a pipeline cut
+ *
+ * The two stages may run in different data layouts and data types (e.g. an F32 stage feeding an F16 one):
+ * the tensor is then permuted and converted in a single pass, so a mixed precision cut costs no more than a plain copy.
+ *
+ * @param[out] dst Tensor of the receiving stage
+ * @param[in]  src Tensor of the sending stage
+ */
+void copy_across_stages(arm_compute::ITensor &dst, const arm_compute::ITensor &src)
+{
+    const arm_compute::DataLayout src_layout = src.info()->data_layout();
+    const arm_compute::DataLayout dst_layout = dst.info()->data_layout();
+    const arm_compute::DataType   src_type   = src.info()->data_type();
+    const arm_compute::DataType   dst_type   = dst.info()->data_type();
+    // Only spatial tensors are permuted: the outputs of fully connected and flatten layers also carry the layout of their stage
+    const bool permute = src_layout != dst_layout && src_layout != arm_compute::DataLayout::UNKNOWN && dst_layout != arm_compute::DataLayout::UNKNOWN
+                         && src.info()->num_dimensions() >= 3 && dst.info()->num_dimensions() >= 3;
+    const bool convert = src_type != dst_type || (arm_compute::is_data_type_quantized(dst_type) && src.info()->quantization_info() != dst.info()->quantization_info());
+    if(!permute && !convert)
+    {
+        dst.copy_from(src);
+        return;
+    }
+
+    const arm_compute::DataLayoutDimension     dims[]       = { arm_compute::DataLayoutDimension::WIDTH, arm_compute::DataLayoutDimension::HEIGHT, arm_compute::DataLayoutDimension::CHANNEL };
+    const size_t                               element_size = dst.info()->element_size();
+    const arm_compute::UniformQuantizationInfo src_qinfo    = src.info()->quantization_info().uniform();
+    const arm_compute::UniformQuantizationInfo dst_qinfo    = dst.info()->quantization_info().uniform();
+
+    arm_compute::Window window;
+    window.use_tensor_dimensions(dst.info()->tensor_shape());
+    arm_compute::execute_window_loop(window, [&](const arm_compute::Coordinates & id)
+    {
+        arm_compute::Coordinates src_id = id;
+        if(permute)
+        {
+            for(const auto dim : dims)
+            {
+                src_id.set(arm_compute::get_data_layout_dimension_index(src_layout, dim), id[arm_compute::get_data_layout_dimension_index(dst_layout, dim)]);
+            }
+        }
+        if(convert)
+        {
+            store_from_float(dst.ptr_to_element(id), dst_type, dst_qinfo, load_as_float(src.ptr_to_element(src_id), src_type, src_qinfo));
+        }
+        else
+        {
+            std::memcpy(dst.ptr_to_element(id), src.ptr_to_element(src_id), element_size);
+        }
+    });
+}
 } // namespace
 
 TFPreproccessor::TFPreproccessor(float min_range, float max_range)
@@ -264,6 +356,7 @@ ReceiverAccessor::ReceiverAccessor(bool tran, int Src_id, unsigned int maximum)
 	buffer_tensors[Src_id]->allocator()->allocate();
 	//buffer_tensors.push_back(t);
 	Qs.push_back(new std::queue<arm_compute::Tensor*>);
+	edge_stats.push_back(new PipelineEdgeStats);
 	////PrintThread{}<<"src:"<<Src_id<<std::endl;
 	////PrintThread{}<<"receiver node for graph with src id:"<<Source_id<<"  trans:"<<transition<<std::endl;
 	////PrintThread{}<<"salam"<<std::endl;
@@ -298,7 +391,9 @@ bool ReceiverAccessor::access_tensor(ITensor &tensor)
 			*__waiting[id]=true;
 		}
 		//PrintThread{}<<"receiver after while before wait;waiting["<<id<<"]:"<<__waiting[id]<<", ready["<<id<<"]:"<<*__ready[id]<<std::endl<<std::flush;
+		auto twait=std::chrono::high_resolution_clock::now();
 		cvs[id]->wait(lk,[id]{*__waiting[id]=true;return *__ready[id];});
+		edge_stats[id]->consumer_starved += std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::high_resolution_clock::now() - twait).count();
 		//->PrintThread{}<<std::flush<<"graph:"<<Source_id+1<<" receiver wake up press\n"<<std::flush;
 		//std::cin>>c;
 		*__ready[id]=false;
@@ -323,9 +418,10 @@ bool ReceiverAccessor::access_tensor(ITensor &tensor)
 			//PrintThread{}<<std::flush<<"\n transfering data from source directly press\n"<<std::flush;
 			//std::cin>>c;
 			auto tstart=std::chrono::high_resolution_clock::now();
-			tensor.copy_from(Transmitters[id]->handle()->tensor());
+			copy_across_stages(tensor, Transmitters[id]->handle()->tensor());
 			auto tfinish=std::chrono::high_resolution_clock::now();
 			double cost0 = std::chrono::duration_cast<std::chrono::duration<double>>(tfinish - tstart).count();
+			edge_stats[id]->receive_transfer += cost0;
 #if My_print > 0
 			//PrintThread{}<<"\nTransfer time from source:"<<cost0<<std::endl<<std::endl;
 #endif
@@ -339,17 +435,19 @@ bool ReceiverAccessor::access_tensor(ITensor &tensor)
 		//->PrintThread{}<<std::flush<<"\ngraph:"<<Source_id+1<<" Receive frame:"<<frame<<" from Queue\n"<<std::flush;
 
 		auto tstart=std::chrono::high_resolution_clock::now();
-		tensor.copy_from(*(Qs[id]->front()));
+		copy_across_stages(tensor, *(Qs[id]->front()));
 		//tensor.copy_from(Tensors_Q.front().handle()->tensor());
 		Qs[id]->pop();
 		auto tfinish=std::chrono::high_resolution_clock::now();
 		double cost0 = std::chrono::duration_cast<std::chrono::duration<double>>(tfinish - tstart).count();
+		edge_stats[id]->receive_transfer += cost0;
 #if My_print > 0
 		PrintThread{}<<"\nTransfer time from queue:"<<cost0<<std::endl<<std::endl;
 #endif
 		lk.unlock();
 	}
 	//->PrintThread{}<<"Graph "<<Source_id+1<<" Receiver done for frame "<<frame<<std::endl<<std::endl<<std::flush;
+	edge_stats[id]->frames++;
 	frame++;
 	return true;
 
@@ -447,7 +545,10 @@ void SenderAccessor::my_access_predictions_tensor(ITensor &tensor)
     {
     	//PrintThread{}<<std::flush<<" graph:"<<Destination_id-1<<" sender waiting for mutex"<<std::endl<<std::flush;
     	int id=Destination_id-1;
+		auto tlock=std::chrono::high_resolution_clock::now();
 		std::lock_guard<std::mutex> lk(*(mx[id]));
+		auto tlocked=std::chrono::high_resolution_clock::now();
+		edge_stats[id]->producer_blocked += std::chrono::duration_cast<std::chrono::duration<double>>(tlocked - tlock).count();
 		//PrintThread{}<<std::flush<<" graph:"<<Destination_id-1<<" sender unlocked\n"<<std::flush;
 
 		//PrintThread{}<<"sender before decision;waiting["<<id<<"]:"<<__waiting[id]<<", ready["<<id<<"]:"<<__ready[id]<<std::endl<<std::flush;
@@ -458,6 +559,8 @@ void SenderAccessor::my_access_predictions_tensor(ITensor &tensor)
 			////Tensors_Q.push(dynamic_cast<arm_compute::Tensor*>(&(f_out->handle()->tensor())));
 			buffer_tensors[id]->copy_from(Transmitters[id]->handle()->tensor());
 			Qs[id]->push(buffer_tensors[id]);
+			edge_stats[id]->send_transfer += std::chrono::duration_cast<std::chrono::duration<double>>(std::chrono::high_resolution_clock::now() - tlocked).count();
+			edge_stats[id]->queued++;
 			//auto tfinish=std::chrono::high_resolution_clock::now();
 			//double cost0 = std::chrono::duration_cast<std::chrono::duration<double>>(tfinish - tstart).count();
 			////PrintThread{}<<"\npushing to queue time:"<<cost0<<std::endl;
@@ -477,9 +580,10 @@ void SenderAccessor::my_access_predictions_tensor(ITensor &tensor)
 				////PrintThread{}<<"first graph is responsible for transition\n";
 				auto tstart=std::chrono::high_resolution_clock::now();
 				//PrintThread{}<<"len rec: "<<Receivers.size()<<" shape receiver: "<<Receivers[id]->desc().shape<<std::endl;
-				Receivers[id]->handle()->tensor().copy_from(tensor);
+				copy_across_stages(Receivers[id]->handle()->tensor(), tensor);
 				auto tfinish=std::chrono::high_resolution_clock::now();
 				double cost0 = std::chrono::duration_cast<std::chrono::duration<double>>(tfinish - tstart).count();
+				edge_stats[id]->send_transfer += cost0;
 				////PrintThread{}<<"\nTransfer0 time:"<<cost0<<std::endl<<std::endl;
 			}
 			*__ready[id] = true;
@@ -1092,7 +1196,7 @@ void TopNPredictionsAccessor::access_predictions_tensor(ITensor &tensor)
 
 bool TopNPredictionsAccessor::access_tensor(ITensor &tensor)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&tensor, 1, DataType::F32, DataType::QASYMM8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&tensor, 1, DataType::F32, DataType::F16, DataType::QASYMM8);
     //Ehsan
     //ARM_COMPUTE_ERROR_ON(_labels.size() != tensor.info()->dimension(0));
 
@@ -1101,6 +1205,9 @@ bool TopNPredictionsAccessor::access_tensor(ITensor &tensor)
         case DataType::QASYMM8:
             access_predictions_tensor<uint8_t>(tensor);
             break;
+        case DataType::F16:
+            access_predictions_tensor<half>(tensor);
+            break;
         case DataType::F32:
             access_predictions_tensor<float>(tensor);
         	//Ehsan
@@ -1116,7 +1223,7 @@ bool TopNPredictionsAccessor::access_tensor(ITensor &tensor)
 //Ehsan
 bool SenderAccessor::access_tensor(ITensor &tensor)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&tensor, 1, DataType::F32, DataType::QASYMM8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&tensor, 1, DataType::F32, DataType::F16, DataType::QASYMM8);
     //Ehsan
     //ARM_COMPUTE_ERROR_ON(_labels.size() != tensor.info()->dimension(0));
 
@@ -1264,3 +1371,98 @@ bool NumPyBinLoader::access_tensor(ITensor &tensor)
     _already_loaded = !_already_loaded;
     return _already_loaded;
 }
+
+void arm_compute::graph_utils::reset_pipeline_stats()
+{
+    for(auto e : edge_stats)
+    {
+        *e = PipelineEdgeStats();
+    }
+}
+
+void arm_compute::graph_utils::print_pipeline_analysis(std::ostream &os, const std::vector<graph::frontend::Stream *> &stages, int n)
+{
+    if(stages.empty() || n <= 0)
+    {
+        return;
+    }
+    const size_t num_stages = stages.size();
+    const double to_ms      = 1000. / n;
+
+    std::vector<double>              busy(num_stages, 0);
+    std::vector<std::vector<double>> layers(num_stages);
+    double                           period = 0;
+    for(size_t i = 0; i < num_stages; ++i)
+    {
+        graph::frontend::Stream *stage = stages[i];
+        const double             input = stage->get_input_time();
+        const double             task  = stage->get_task_time();
+        const double             output = stage->get_output_time();
+        const PipelineEdgeStats  in_edge  = (i > 0 && i - 1 < edge_stats.size()) ? *edge_stats[i - 1] : PipelineEdgeStats();
+        const PipelineEdgeStats  out_edge = (i < edge_stats.size() && i + 1 < num_stages) ? *edge_stats[i] : PipelineEdgeStats();
+
+        // The first stage waits for the previous frame to leave the pipeline on its input when frames are gated
+        const double input_busy  = (i == 0 && per_frame) ? 0 : std::max(0., input - in_edge.consumer_starved);
+        const double output_busy = std::max(0., output - out_edge.producer_blocked);
+        busy[i]                  = task + input_busy + output_busy;
+        layers[i]                = stage->layer_times(n);
+        period                   = std::max(period, stage->get_cost_time());
+
+        os << "Stage " << i << ": task " << task * to_ms << " ms"
+           << " \t input " << input * to_ms << " ms (starved " << in_edge.consumer_starved * to_ms << ")"
+           << " \t output " << output * to_ms << " ms (blocked " << out_edge.producer_blocked * to_ms << ")"
+           << " \t busy " << busy[i] * to_ms << " ms" << std::endl;
+    }
+    for(size_t i = 0; i + 1 < num_stages && i < edge_stats.size(); ++i)
+    {
+        const PipelineEdgeStats &e = *edge_stats[i];
+        os << "Edge " << i << "->" << i + 1 << ": producer blocked " << e.producer_blocked * to_ms << " ms"
+           << " \t consumer starved " << e.consumer_starved * to_ms << " ms"
+           << " \t transfer " << (e.send_transfer + e.receive_transfer) * to_ms << " ms"
+           << " \t queued " << e.queued << "/" << e.frames << " frames" << std::endl;
+    }
+
+    const size_t bottleneck = std::distance(busy.begin(), std::max_element(busy.begin(), busy.end()));
+    for(size_t i = 0; i < num_stages; ++i)
+    {
+        os << "Stage " << i << " utilization: " << (period > 0 ? 100. * busy[i] * n / period : 0.) << "%" << std::endl;
+    }
+    os << "Bottleneck: stage " << bottleneck << " (" << busy[bottleneck] * to_ms << " ms per frame, bound "
+       << (busy[bottleneck] > 0 ? n / busy[bottleneck] : 0.) << " fps, measured " << (period > 0 ? n / period : 0.) << " fps)" << std::endl;
+
+    // Moving one layer across a cut only changes the busy time of the two stages around it
+    double best_gain = 0;
+    auto   estimate  = [&](size_t from, size_t to, double layer, const char *which, size_t cut)
+    {
+        std::vector<double> moved = busy;
+        moved[from] -= layer * n;
+        moved[to] += layer * n;
+        const double bound = *std::max_element(moved.begin(), moved.end());
+        const double gain  = bound > 0 ? busy[bottleneck] / bound - 1. : 0.;
+        best_gain          = std::max(best_gain, gain);
+        os << "Cut " << cut << ": moving the " << which << " layer of stage " << from << " (" << layer * 1000 << " ms) to stage " << to
+           << " changes throughput by " << 100. * gain << "%" << std::endl;
+    };
+    bool estimated = false;
+    for(size_t cut = 0; cut + 1 < num_stages; ++cut)
+    {
+        if(layers[cut].size() > 1)
+        {
+            estimate(cut, cut + 1, layers[cut].back(), "last", cut);
+            estimated = true;
+        }
+        if(layers[cut + 1].size() > 1)
+        {
+            estimate(cut + 1, cut, layers[cut + 1].front(), "first", cut);
+            estimated = true;
+        }
+    }
+    if(!estimated)
+    {
+        os << "No per-layer times, run with --layer_time or --counters to estimate moving layers across cuts" << std::endl;
+    }
+    else
+    {
+        os << "Best single-layer move: " << 100. * best_gain << "% throughput (layer cost assumed equal on both stages)" << std::endl;
+    }
+}
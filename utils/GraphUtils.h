@@ -42,6 +42,7 @@ static arm_compute::graph::Target g1t;
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/ITensorAccessor.h"
 #include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/Workload.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include "utils/CommonGraphOptions.h"
@@ -55,6 +56,21 @@ static arm_compute::graph::Target g1t;
 extern std::vector<arm_compute::graph::Tensor*> Transmitters;
 extern std::vector<arm_compute::graph::Tensor*> Receivers;
 
+/** Stall and transfer times of one pipeline edge, in seconds
+ *
+ * Every field has a single writer (the sender or the receiver stage), read them once the stages are joined.
+ */
+struct PipelineEdgeStats
+{
+    double producer_blocked{ 0 }; /**< Sender time spent waiting for the edge mutex */
+    double consumer_starved{ 0 }; /**< Receiver time spent waiting for a frame while the queue was empty */
+    double send_transfer{ 0 };    /**< Sender time spent copying frames into the queue or the destination */
+    double receive_transfer{ 0 }; /**< Receiver time spent copying frames out of the queue or the source */
+    int    frames{ 0 };           /**< Frames received over the edge */
+    int    queued{ 0 };           /**< Frames handed over through the queue because the receiver was busy */
+};
+extern std::vector<PipelineEdgeStats*> edge_stats;
+
 static std::vector<std::mutex*> mx;
 static std::vector<std::condition_variable*> cvs;
 
@@ -71,6 +87,13 @@ extern bool per_frame;
 
 namespace arm_compute
 {
+namespace graph
+{
+namespace frontend
+{
+class Stream;
+} // namespace frontend
+} // namespace graph
 namespace graph_utils
 {
 /** Preprocessor interface **/
@@ -683,6 +706,12 @@ inline void del(){
 		delete p;
 	}
 	Qs.clear();
+
+	for (auto p : edge_stats)
+	{
+		delete p;
+	}
+	edge_stats.clear();
 }
 /** Generates appropriate input accessor according to the specified graph parameters
  *
@@ -971,6 +1000,45 @@ inline graph::Target set_target_hint(int target)
         return graph::Target::NEON;
     }
 }
+
+/** Prints the always-on per-task counters of a graph
+ *
+ * @param[out] os    Output stream
+ * @param[in]  stats Task statistics as returned by Stream::task_stats()
+ */
+inline void print_task_stats(std::ostream &os, const std::vector<graph::ExecutionTaskStats> &stats)
+{
+    for(const auto &s : stats)
+    {
+        os << "Layer Name: " << s.name
+           << " \t calls: " << s.calls
+           << " \t samples: " << s.samples
+           << " \t mean: " << s.mean
+           << " \t min: " << s.min
+           << " \t max: " << s.max
+           << " \t ewma: " << s.ewma << std::endl;
+    }
+}
+
+/** Clears the stall and transfer times of every pipeline edge
+ *
+ * @note Call it once the warm-up frame went through all stages and before the timed frames start.
+ */
+void reset_pipeline_stats();
+
+/** Prints where a pipeline stalls and which stage bounds its throughput
+ *
+ * For each stage reports its busy time per frame (compute plus transfers, without the time spent
+ * starved on its input edge or blocked on its output edge) and its utilization of the frame period.
+ * The stage with the largest busy time is reported as the bottleneck. When per-layer times are available
+ * (layer timing or always-on counters) also estimates the throughput gain of moving one layer across
+ * each cut, assuming the layer costs the same on both sides of the cut.
+ *
+ * @param[out] os     Output stream
+ * @param[in]  stages Pipeline stages, in order
+ * @param[in]  n      Number of timed frames
+ */
+void print_pipeline_analysis(std::ostream &os, const std::vector<graph::frontend::Stream *> &stages, int n);
 } // namespace graph_utils
 } // namespace arm_compute
 
@@ -419,13 +419,17 @@ public:
             const size_t end_position = _fs.tellg();
             _fs.seekg(current_position, std::ios_base::beg);
 
-            ARM_COMPUTE_ERROR_ON_MSG((end_position - current_position) < tensor.info()->tensor_shape().total_size() * tensor.info()->element_size(),
+            // F32 files also fill F16 tensors, so that half precision stages load the same trained parameters
+            const bool   is_f32_to_f16     = tensor.info()->data_type() == arm_compute::DataType::F16 && _typestring == get_typestring(arm_compute::DataType::F32);
+            const size_t file_element_size = is_f32_to_f16 ? sizeof(float) : tensor.info()->element_size();
+
+            ARM_COMPUTE_ERROR_ON_MSG((end_position - current_position) < tensor.info()->tensor_shape().total_size() * file_element_size,
                                      "Not enough data in file");
-            ARM_COMPUTE_UNUSED(end_position);
+            ARM_COMPUTE_UNUSED(end_position, file_element_size);
 
             // Check if the typestring matches the given one
             std::string expect_typestr = get_typestring(tensor.info()->data_type());
-            ARM_COMPUTE_ERROR_ON_MSG(_typestring != expect_typestr, "Typestrings mismatch");
+            ARM_COMPUTE_ERROR_ON_MSG(_typestring != expect_typestr && !is_f32_to_f16, "Typestrings mismatch");
 
             bool are_layouts_different = (_file_layout != tensor.info()->data_layout());
             // Correct dimensions (Needs to match TensorShape dimension corrections)
@@ -469,7 +473,7 @@ public:
                 case arm_compute::DataType::F16:
                 {
                     // Read data
-                    if(!are_layouts_different && !_fortran_order && tensor.info()->padding().empty())
+                    if(!are_layouts_different && !_fortran_order && tensor.info()->padding().empty() && !is_f32_to_f16)
                     {
                         // If tensor has no padding read directly from stream.
                         _fs.read(reinterpret_cast<char *>(tensor.buffer()), tensor.info()->total_size());
@@ -508,7 +512,16 @@ public:
                         {
                             Coordinates dst(id);
                             arm_compute::permute(dst, perm);
-                            _fs.read(reinterpret_cast<char *>(tensor.ptr_to_element(dst)), tensor.info()->element_size());
+                            if(is_f32_to_f16)
+                            {
+                                float value = 0.f;
+                                _fs.read(reinterpret_cast<char *>(&value), sizeof(float));
+                                *reinterpret_cast<half *>(tensor.ptr_to_element(dst)) = half(value);
+                            }
+                            else
+                            {
+                                _fs.read(reinterpret_cast<char *>(tensor.ptr_to_element(dst)), tensor.info()->element_size());
+                            }
                         });
                     }
 